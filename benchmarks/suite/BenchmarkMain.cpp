@@ -0,0 +1,19 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include <benchmark/benchmark.h>
+
+/*
+ * Run with --benchmark_format=json or --benchmark_out=<file> to get
+ * machine-readable results, then compare two result files with
+ * compare_benchmarks.py.
+ */
+BENCHMARK_MAIN();
@@ -0,0 +1,212 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include "BenchmarkUtil.h"
+
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/util/SineStarFactory.h>
+#include <geos/io/WKBReader.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/GEOSException.h>
+#include <geos/util/GeometricShapeFactory.h>
+
+#include <fstream>
+#include <random>
+#include <sstream>
+
+using namespace geos::geom;
+
+namespace benchutil {
+
+namespace {
+
+// Corpus files, relative to GEOS_BENCH_XMLTEST_DIR
+const char* const corpusFiles[] = {
+    "general/TestOverlayAA.xml",
+    "general/TestOverlayLA.xml",
+    "general/TestNGOverlayA.xml",
+    "general/TestRelateAA.xml",
+    "general/TestValid.xml",
+    "general/TestValid2.xml",
+    "general/TestValid2-big.xml",
+    "general/TestBuffer.xml",
+    "general/TestUnaryUnion.xml",
+    "robust/TestRobustOverlayFixed.xml",
+    "robust/TestRobustRelate.xml",
+    "misc/TestBufferExternal-1.xml",
+    "misc/stmlf-20061020.xml",
+};
+
+/*
+ * Appends the content of the <a> and <b> elements of an XML test file
+ * which parse as WKT or hex WKB.
+ */
+void
+readCorpusFile(const std::string& path, std::vector<std::unique_ptr<Geometry>>& geoms)
+{
+    std::ifstream in(path);
+    if(!in) {
+        return;
+    }
+    std::stringstream buf;
+    buf << in.rdbuf();
+    const std::string xml = buf.str();
+
+    geos::io::WKTReader wktReader(factory());
+    geos::io::WKBReader wkbReader(factory());
+
+    for(const char* tag : { "a", "b" }) {
+        const std::string open = std::string("<") + tag + ">";
+        const std::string close = std::string("</") + tag + ">";
+        std::size_t pos = 0;
+        while((pos = xml.find(open, pos)) != std::string::npos) {
+            pos += open.size();
+            std::size_t end = xml.find(close, pos);
+            if(end == std::string::npos) {
+                break;
+            }
+            std::string text = xml.substr(pos, end - pos);
+            pos = end;
+            try {
+                geoms.push_back(wktReader.read(text));
+            }
+            catch(const geos::util::GEOSException&) {
+                try {
+                    std::istringstream hex(text);
+                    geoms.push_back(wkbReader.readHEX(hex));
+                }
+                catch(const geos::util::GEOSException&) {
+                    // Neither WKT nor WKB, e.g. a file reference
+                }
+            }
+        }
+    }
+}
+
+const std::vector<std::unique_ptr<Geometry>>&
+allCorpus()
+{
+    static std::vector<std::unique_ptr<Geometry>> geoms;
+    static bool loaded = false;
+    if(!loaded) {
+        for(const char* file : corpusFiles) {
+            readCorpusFile(std::string(GEOS_BENCH_XMLTEST_DIR) + "/" + file, geoms);
+        }
+        loaded = true;
+    }
+    return geoms;
+}
+
+} // anonymous namespace
+
+const GeometryFactory&
+factory()
+{
+    static GeometryFactory::Ptr fact = GeometryFactory::create();
+    return *fact;
+}
+
+std::unique_ptr<Polygon>
+sineStar(const Coordinate& centre, double size, int numPts, int numArms)
+{
+    util::SineStarFactory gsf(&factory());
+    gsf.setCentre(centre);
+    gsf.setSize(size);
+    gsf.setNumPoints(numPts);
+    gsf.setNumArms(numArms);
+    gsf.setArmLengthRatio(0.3);
+    return gsf.createSineStar();
+}
+
+std::unique_ptr<Polygon>
+circle(const Coordinate& centre, double size, int numPts)
+{
+    geos::util::GeometricShapeFactory gsf(&factory());
+    gsf.setCentre(centre);
+    gsf.setSize(size);
+    gsf.setNumPoints(numPts);
+    return gsf.createCircle();
+}
+
+std::vector<std::unique_ptr<Geometry>>
+starGrid(int nSide, int ptsPerStar)
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.reserve(static_cast<std::size_t>(nSide * nSide));
+    for(int i = 0; i < nSide; i++) {
+        for(int j = 0; j < nSide; j++) {
+            geoms.push_back(sineStar(Coordinate(i, j), 1.5, ptsPerStar));
+        }
+    }
+    return geoms;
+}
+
+std::vector<Coordinate>
+randomCoords(std::size_t n, double extent, unsigned seed)
+{
+    std::default_random_engine e(seed);
+    std::uniform_real_distribution<> dis(0, extent);
+
+    std::vector<Coordinate> coords(n);
+    for(Coordinate& c : coords) {
+        c.x = dis(e);
+        c.y = dis(e);
+    }
+    return coords;
+}
+
+std::vector<std::unique_ptr<Geometry>>
+randomSegments(std::size_t n, double segLen, double extent, unsigned seed)
+{
+    std::default_random_engine e(seed);
+    std::uniform_real_distribution<> dis(0, extent);
+    std::uniform_real_distribution<> delta(-segLen / 2, segLen / 2);
+
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.reserve(n);
+    for(std::size_t i = 0; i < n; i++) {
+        Coordinate p0(dis(e), dis(e));
+        Coordinate p1(p0.x + delta(e), p0.y + delta(e));
+        auto seq = new CoordinateArraySequence(std::vector<Coordinate> { p0, p1 });
+        geoms.emplace_back(factory().createLineString(seq));
+    }
+    return geoms;
+}
+
+std::unique_ptr<Geometry>
+randomPoints(std::size_t n, double extent, unsigned seed)
+{
+    std::vector<Coordinate> coords = randomCoords(n, extent, seed);
+    return std::unique_ptr<Geometry>(factory().createMultiPoint(coords));
+}
+
+std::vector<const Geometry*>
+corpus(std::size_t maxPoints)
+{
+    std::vector<const Geometry*> geoms;
+    for(const auto& g : allCorpus()) {
+        if(g->getNumPoints() <= maxPoints) {
+            geoms.push_back(g.get());
+        }
+    }
+    return geoms;
+}
+
+std::string
+corpusLabel(std::size_t maxPoints)
+{
+    return "corpus<=" + std::to_string(maxPoints) + "pts";
+}
+
+} // namespace benchutil
@@ -0,0 +1,69 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Polygon.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Synthetic and corpus inputs shared by the benchmark suite.
+ *
+ * All generators are deterministic so that runs on different builds
+ * can be compared.
+ */
+namespace benchutil {
+
+const geos::geom::GeometryFactory& factory();
+
+/// A sine star with numPts vertices
+std::unique_ptr<geos::geom::Polygon>
+sineStar(const geos::geom::Coordinate& centre, double size, int numPts, int numArms = 8);
+
+/// A circle with numPts vertices
+std::unique_ptr<geos::geom::Polygon>
+circle(const geos::geom::Coordinate& centre, double size, int numPts);
+
+/// An nSide x nSide grid of overlapping sine stars of ptsPerStar vertices
+std::vector<std::unique_ptr<geos::geom::Geometry>>
+starGrid(int nSide, int ptsPerStar);
+
+/// n pseudo-random coordinates in [0, extent]^2
+std::vector<geos::geom::Coordinate>
+randomCoords(std::size_t n, double extent = 100.0, unsigned seed = 12345);
+
+/// n pseudo-random segments of length at most segLen in [0, extent]^2
+std::vector<std::unique_ptr<geos::geom::Geometry>>
+randomSegments(std::size_t n, double segLen, double extent = 100.0, unsigned seed = 12345);
+
+/// n pseudo-random points in [0, extent]^2, as a MultiPoint
+std::unique_ptr<geos::geom::Geometry>
+randomPoints(std::size_t n, double extent = 100.0, unsigned seed = 12345);
+
+/**
+ * The A and B geometries of the XML test corpora having at most
+ * maxPoints vertices, in file order. The corpora are read once.
+ */
+std::vector<const geos::geom::Geometry*>
+corpus(std::size_t maxPoints);
+
+/// Short label of a corpus size bucket, for reporting
+std::string corpusLabel(std::size_t maxPoints);
+
+} // namespace benchutil
@@ -0,0 +1,87 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include "BenchmarkUtil.h"
+
+#include <geos/operation/buffer/BufferOp.h>
+#include <geos/operation/buffer/BufferParameters.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace geos::geom;
+using geos::operation::buffer::BufferOp;
+using geos::operation::buffer::BufferParameters;
+
+static void
+BM_BufferPolygon(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(star->buffer(1.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BufferPolygon)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_BufferPolygonNegative(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(star->buffer(-1.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BufferPolygonNegative)->Arg(100)->Arg(10000);
+
+static void
+BM_BufferLines(benchmark::State& state)
+{
+    auto coll = benchutil::factory().buildGeometry(
+                    benchutil::randomSegments(static_cast<std::size_t>(state.range(0)), 10.0));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(coll->buffer(0.5));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BufferLines)->Arg(100)->Arg(1000);
+
+static void
+BM_BufferPoints(benchmark::State& state)
+{
+    auto points = benchutil::randomPoints(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(points->buffer(1.0, 8));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BufferPoints)->Arg(100)->Arg(1000);
+
+static void
+BM_BufferSingleSided(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    auto ring = star->getExteriorRing()->clone();
+    BufferParameters params;
+    params.setSingleSided(true);
+
+    for(auto _ : state) {
+        BufferOp op(ring.get(), params);
+        std::unique_ptr<Geometry> result(op.getResultGeometry(1.0));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BufferSingleSided)->Arg(100)->Arg(10000);
@@ -0,0 +1,268 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include "BenchmarkUtil.h"
+
+#include <geos/algorithm/construct/MaximumInscribedCircle.h>
+#include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
+#include <geos/algorithm/distance/DiscreteFrechetDistance.h>
+#include <geos/algorithm/distance/IndexedHausdorffDistance.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/operation/distance/DistanceOp.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace geos::geom;
+
+static void
+BM_DistancePolygonPolygon(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(250, 0), 100, numPts, 5);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(geos::operation::distance::DistanceOp::distance(*a, *b));
+    }
+}
+BENCHMARK(BM_DistancePolygonPolygon)->Arg(100)->Arg(1000);
+
+// Stars 5 units apart by their envelopes, tested against a distance
+// just above theirs when the second argument is 1, just below otherwise
+static void
+BM_IsWithinDistance(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(105, 0), 100, numPts, 5);
+    double dist = geos::operation::distance::DistanceOp::distance(*a, *b);
+    dist *= state.range(1) ? 1.1 : 0.9;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(a->isWithinDistance(b.get(), dist));
+    }
+}
+BENCHMARK(BM_IsWithinDistance)->Args({100, 0})->Args({100, 1})->Args({1000, 0})->Args({1000, 1})
+->Args({100000, 0})->Args({100000, 1});
+
+static void
+BM_PreparedIsWithinDistance(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto prep = geos::geom::prep::PreparedGeometryFactory::prepare(a.get());
+    auto b = benchutil::sineStar(Coordinate(105, 0), 100, 100, 5);
+    double dist = geos::operation::distance::DistanceOp::distance(*a, *b);
+    dist *= state.range(1) ? 1.1 : 0.9;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(prep->isWithinDistance(b.get(), dist));
+    }
+}
+BENCHMARK(BM_PreparedIsWithinDistance)->Args({1000, 0})->Args({1000, 1})->Args({100000, 0})->Args({100000, 1});
+
+static void
+BM_IndexedFacetDistance(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(250, 0), 100, numPts, 5);
+
+    for(auto _ : state) {
+        geos::operation::distance::IndexedFacetDistance ifd(a.get());
+        benchmark::DoNotOptimize(ifd.distance(b.get()));
+    }
+}
+BENCHMARK(BM_IndexedFacetDistance)->Arg(100)->Arg(1000)->Arg(100000);
+
+static void
+BM_IndexedFacetDistancePoints(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    geos::operation::distance::IndexedFacetDistance ifd(star.get());
+    std::vector<std::unique_ptr<Point>> points;
+    for(const Coordinate& c : benchutil::randomCoords(1000, 400.0)) {
+        points.emplace_back(benchutil::factory().createPoint(Coordinate(c.x - 200, c.y - 200)));
+    }
+
+    for(auto _ : state) {
+        double d = 0;
+        for(const auto& p : points) {
+            d += ifd.distance(p.get());
+        }
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+BENCHMARK(BM_IndexedFacetDistancePoints)->Arg(100)->Arg(10000);
+
+static void
+BM_PreparedDistancePoints(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    auto line = star->getBoundary();
+    auto prep = geos::geom::prep::PreparedGeometryFactory::prepare(line.get());
+    std::vector<std::unique_ptr<Point>> points;
+    for(const Coordinate& c : benchutil::randomCoords(10000, 400.0)) {
+        points.emplace_back(benchutil::factory().createPoint(Coordinate(c.x - 200, c.y - 200)));
+    }
+
+    for(auto _ : state) {
+        double d = 0;
+        for(const auto& p : points) {
+            d += prep->distance(p.get());
+        }
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+BENCHMARK(BM_PreparedDistancePoints)->Arg(100)->Arg(10000);
+
+// Points along a track when the argument is odd, random points otherwise
+static void
+preparedDistanceArrays(benchmark::State& state, bool isWithin)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0) & ~1));
+    auto line = star->getBoundary();
+    auto prep = geos::geom::prep::PreparedGeometryFactory::prepare(line.get());
+    std::vector<double> x;
+    std::vector<double> y;
+    if(state.range(0) & 1) {
+        for(int i = 0; i < 10000; i++) {
+            double angle = 2 * M_PI * i / 10000;
+            x.push_back(110 * std::cos(angle));
+            y.push_back(110 * std::sin(angle));
+        }
+    }
+    else {
+        for(const Coordinate& c : benchutil::randomCoords(10000, 400.0)) {
+            x.push_back(c.x - 200);
+            y.push_back(c.y - 200);
+        }
+    }
+    std::vector<double> distances(x.size());
+    std::unique_ptr<bool[]> results(new bool[x.size()]);
+
+    for(auto _ : state) {
+        if(isWithin) {
+            prep->isWithinDistance(x.data(), y.data(), x.size(), 5.0, results.get());
+        }
+        else {
+            prep->distance(x.data(), y.data(), x.size(), distances.data());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(x.size()));
+}
+
+static void
+BM_PreparedDistancePointArrays(benchmark::State& state)
+{
+    preparedDistanceArrays(state, false);
+}
+BENCHMARK(BM_PreparedDistancePointArrays)->Arg(100)->Arg(10000)->Arg(10001);
+
+static void
+BM_PreparedDistanceWithinPointArrays(benchmark::State& state)
+{
+    preparedDistanceArrays(state, true);
+}
+BENCHMARK(BM_PreparedDistanceWithinPointArrays)->Arg(100)->Arg(10000)->Arg(10001);
+
+static void
+BM_DiscreteHausdorffDistance(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(10, 0), 100, numPts, 5);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(
+            geos::algorithm::distance::DiscreteHausdorffDistance::distance(*a, *b));
+    }
+}
+BENCHMARK(BM_DiscreteHausdorffDistance)->Arg(100)->Arg(1000);
+
+static void
+BM_IndexedHausdorffDistance(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(10, 0), 100, numPts, 5);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(
+            geos::algorithm::distance::IndexedHausdorffDistance::distance(*a, *b));
+    }
+}
+BENCHMARK(BM_IndexedHausdorffDistance)->Arg(100)->Arg(1000)->Arg(100000);
+
+static void
+BM_DiscreteFrechetDistance(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(10, 0), 100, numPts, 5);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(
+            geos::algorithm::distance::DiscreteFrechetDistance::distance(*a, *b));
+    }
+}
+BENCHMARK(BM_DiscreteFrechetDistance)->Arg(100)->Arg(1000);
+
+static void
+BM_DiscreteFrechetIsWithinDistance(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(1, 0), 100, numPts, 5);
+    double dist = geos::algorithm::distance::DiscreteFrechetDistance::distance(*a, *b);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(
+            geos::algorithm::distance::DiscreteFrechetDistance::isWithinDistance(*a, *b, dist));
+    }
+}
+BENCHMARK(BM_DiscreteFrechetIsWithinDistance)->Arg(1000)->Arg(10000);
+
+static void
+BM_MaximumInscribedCircle(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        geos::algorithm::construct::MaximumInscribedCircle mic(star.get(), 0.01);
+        benchmark::DoNotOptimize(mic.getCenter());
+    }
+}
+BENCHMARK(BM_MaximumInscribedCircle)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void
+BM_MaximumInscribedCircles(benchmark::State& state)
+{
+    auto stars = benchutil::starGrid(32, static_cast<int>(state.range(0)));
+    std::vector<const Geometry*> polygonals;
+    for(const auto& g : stars) {
+        polygonals.push_back(g.get());
+    }
+    std::vector<Coordinate> centers;
+    std::vector<double> radii;
+
+    for(auto _ : state) {
+        geos::algorithm::construct::MaximumInscribedCircle::getCenters(polygonals, 0.0001, centers, radii);
+        benchmark::DoNotOptimize(centers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(polygonals.size()));
+}
+BENCHMARK(BM_MaximumInscribedCircles)->Arg(16)->Arg(256);
@@ -0,0 +1,83 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include "BenchmarkUtil.h"
+
+#include <geos/io/WKBReader.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+
+using namespace geos::geom;
+
+static void
+BM_WKTRead(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    geos::io::WKTWriter writer;
+    std::string wkt = writer.write(star.get());
+    geos::io::WKTReader reader(benchutil::factory());
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(reader.read(wkt));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * wkt.size()));
+}
+BENCHMARK(BM_WKTRead)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_WKTWrite(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    geos::io::WKTWriter writer;
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(writer.write(star.get()));
+    }
+}
+BENCHMARK(BM_WKTWrite)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_WKBRead(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    std::stringstream out;
+    geos::io::WKBWriter writer;
+    writer.write(*star, out);
+    const std::string wkb = out.str();
+    geos::io::WKBReader reader(benchutil::factory());
+
+    for(auto _ : state) {
+        std::istringstream in(wkb);
+        benchmark::DoNotOptimize(reader.read(in));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * wkb.size()));
+}
+BENCHMARK(BM_WKBRead)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_WKBWrite(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    geos::io::WKBWriter writer;
+
+    for(auto _ : state) {
+        std::stringstream out;
+        writer.write(*star, out);
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_WKBWrite)->Arg(100)->Arg(10000)->Arg(100000);
@@ -0,0 +1,132 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include "BenchmarkUtil.h"
+
+#include <geos/geom/Envelope.h>
+#include <geos/index/ItemVisitor.h>
+#include <geos/index/quadtree/Quadtree.h>
+#include <geos/index/strtree/SimpleSTRtree.h>
+#include <geos/index/strtree/STRtree.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace geos::geom;
+
+namespace {
+
+std::vector<Envelope>
+randomEnvelopes(std::size_t n, unsigned seed)
+{
+    std::vector<Envelope> envs;
+    envs.reserve(n);
+    for(const Coordinate& c : benchutil::randomCoords(n, 1000.0, seed)) {
+        envs.emplace_back(c.x, c.x + 1.0, c.y, c.y + 1.0);
+    }
+    return envs;
+}
+
+struct CountVisitor : public geos::index::ItemVisitor {
+    std::size_t count = 0;
+    void
+    visitItem(void*) override
+    {
+        count++;
+    }
+};
+
+template<typename Index>
+void
+buildIndex(benchmark::State& state)
+{
+    auto envs = randomEnvelopes(static_cast<std::size_t>(state.range(0)), 1);
+
+    for(auto _ : state) {
+        Index index;
+        for(Envelope& e : envs) {
+            index.insert(&e, &e);
+        }
+        // Trees are built lazily on first query
+        Envelope q(0, 1, 0, 1);
+        CountVisitor v;
+        index.query(&q, v);
+        benchmark::DoNotOptimize(v.count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Index>
+void
+queryIndex(benchmark::State& state)
+{
+    auto envs = randomEnvelopes(static_cast<std::size_t>(state.range(0)), 1);
+    auto queries = randomEnvelopes(1000, 2);
+    Index index;
+    for(Envelope& e : envs) {
+        index.insert(&e, &e);
+    }
+
+    for(auto _ : state) {
+        CountVisitor v;
+        for(const Envelope& q : queries) {
+            index.query(&q, v);
+        }
+        benchmark::DoNotOptimize(v.count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+} // anonymous namespace
+
+static void
+BM_STRtreeBuild(benchmark::State& state)
+{
+    buildIndex<geos::index::strtree::STRtree>(state);
+}
+BENCHMARK(BM_STRtreeBuild)->Arg(1000)->Arg(100000);
+
+static void
+BM_SimpleSTRtreeBuild(benchmark::State& state)
+{
+    buildIndex<geos::index::strtree::SimpleSTRtree>(state);
+}
+BENCHMARK(BM_SimpleSTRtreeBuild)->Arg(1000)->Arg(100000);
+
+static void
+BM_QuadtreeBuild(benchmark::State& state)
+{
+    buildIndex<geos::index::quadtree::Quadtree>(state);
+}
+BENCHMARK(BM_QuadtreeBuild)->Arg(1000)->Arg(100000);
+
+static void
+BM_STRtreeQuery(benchmark::State& state)
+{
+    queryIndex<geos::index::strtree::STRtree>(state);
+}
+BENCHMARK(BM_STRtreeQuery)->Arg(1000)->Arg(100000);
+
+static void
+BM_SimpleSTRtreeQuery(benchmark::State& state)
+{
+    queryIndex<geos::index::strtree::SimpleSTRtree>(state);
+}
+BENCHMARK(BM_SimpleSTRtreeQuery)->Arg(1000)->Arg(100000);
+
+static void
+BM_QuadtreeQuery(benchmark::State& state)
+{
+    queryIndex<geos::index::quadtree::Quadtree>(state);
+}
+BENCHMARK(BM_QuadtreeQuery)->Arg(1000)->Arg(100000);
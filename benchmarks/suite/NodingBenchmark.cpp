@@ -0,0 +1,108 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include "BenchmarkUtil.h"
+
+#include <geos/geom/PrecisionModel.h>
+#include <geos/noding/IntersectionAdder.h>
+#include <geos/noding/MCIndexNoder.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/snapround/SnapRoundingNoder.h>
+#include <geos/algorithm/LineIntersector.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace geos::geom;
+using geos::noding::NodedSegmentString;
+using geos::noding::SegmentString;
+
+namespace {
+
+std::vector<std::unique_ptr<CoordinateSequence>>
+segmentCoords(std::size_t n)
+{
+    std::vector<std::unique_ptr<CoordinateSequence>> coords;
+    for(const auto& g : benchutil::randomSegments(n, 10.0)) {
+        coords.push_back(g->getCoordinates());
+    }
+    return coords;
+}
+
+std::vector<SegmentString*>
+segmentStrings(const std::vector<std::unique_ptr<CoordinateSequence>>& coords)
+{
+    std::vector<SegmentString*> ss;
+    ss.reserve(coords.size());
+    for(const auto& c : coords) {
+        ss.push_back(new NodedSegmentString(c->clone().release(), nullptr));
+    }
+    return ss;
+}
+
+template<typename F>
+void
+runNoder(benchmark::State& state, F&& computeNodes)
+{
+    auto coords = segmentCoords(static_cast<std::size_t>(state.range(0)));
+
+    for(auto _ : state) {
+        state.PauseTiming();
+        std::vector<SegmentString*> ss = segmentStrings(coords);
+        state.ResumeTiming();
+
+        std::size_t numNoded = computeNodes(ss);
+        benchmark::DoNotOptimize(numNoded);
+
+        state.PauseTiming();
+        for(SegmentString* s : ss) {
+            delete s;
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // anonymous namespace
+
+static void
+BM_MCIndexNoder(benchmark::State& state)
+{
+    runNoder(state, [](std::vector<SegmentString*>& ss) {
+        geos::algorithm::LineIntersector li;
+        geos::noding::IntersectionAdder adder(li);
+        geos::noding::MCIndexNoder noder(&adder);
+        noder.computeNodes(&ss);
+        std::unique_ptr<std::vector<SegmentString*>> noded(noder.getNodedSubstrings());
+        std::size_t n = noded->size();
+        for(SegmentString* s : *noded) {
+            delete s;
+        }
+        return n;
+    });
+}
+BENCHMARK(BM_MCIndexNoder)->Arg(1000)->Arg(10000);
+
+static void
+BM_SnapRoundingNoder(benchmark::State& state)
+{
+    runNoder(state, [](std::vector<SegmentString*>& ss) {
+        PrecisionModel pm(1000.0);
+        geos::noding::snapround::SnapRoundingNoder noder(&pm);
+        noder.computeNodes(&ss);
+        std::unique_ptr<std::vector<SegmentString*>> noded(noder.getNodedSubstrings());
+        std::size_t n = noded->size();
+        for(SegmentString* s : *noded) {
+            delete s;
+        }
+        return n;
+    });
+}
+BENCHMARK(BM_SnapRoundingNoder)->Arg(1000)->Arg(10000);
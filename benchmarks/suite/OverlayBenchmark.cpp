@@ -0,0 +1,147 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include "BenchmarkUtil.h"
+
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+
+#include <benchmark/benchmark.h>
+
+#include <stdexcept>
+
+using namespace geos::geom;
+using geos::operation::overlayng::OverlayNG;
+using geos::operation::overlayng::OverlayNGRobust;
+
+namespace {
+
+void
+overlayStars(benchmark::State& state, int opCode)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(10, 10), 100, numPts, 5);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(OverlayNGRobust::Overlay(a.get(), b.get(), opCode));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+
+} // anonymous namespace
+
+static void
+BM_OverlayIntersection(benchmark::State& state)
+{
+    overlayStars(state, OverlayNG::INTERSECTION);
+}
+BENCHMARK(BM_OverlayIntersection)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_OverlayUnion(benchmark::State& state)
+{
+    overlayStars(state, OverlayNG::UNION);
+}
+BENCHMARK(BM_OverlayUnion)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_OverlayDifference(benchmark::State& state)
+{
+    overlayStars(state, OverlayNG::DIFFERENCE);
+}
+BENCHMARK(BM_OverlayDifference)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_OverlaySymDifference(benchmark::State& state)
+{
+    overlayStars(state, OverlayNG::SYMDIFFERENCE);
+}
+BENCHMARK(BM_OverlaySymDifference)->Arg(100)->Arg(10000);
+
+// Union of an N x N grid of overlapping stars
+static void
+BM_UnaryUnionGrid(benchmark::State& state)
+{
+    auto coll = benchutil::factory().buildGeometry(
+                    benchutil::starGrid(static_cast<int>(state.range(0)), 100));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(coll->Union());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_UnaryUnionGrid)->Arg(5)->Arg(20)->Arg(50);
+
+// Self-union of each corpus geometry
+static void
+BM_CorpusUnaryUnion(benchmark::State& state)
+{
+    auto geoms = benchutil::corpus(static_cast<std::size_t>(state.range(0)));
+    state.SetLabel(benchutil::corpusLabel(static_cast<std::size_t>(state.range(0))));
+
+    for(auto _ : state) {
+        for(const Geometry* g : geoms) {
+            try {
+                benchmark::DoNotOptimize(OverlayNGRobust::Union(g));
+            }
+            catch(const std::exception&) {
+                // Some corpus inputs are invalid on purpose
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(geoms.size()));
+}
+BENCHMARK(BM_CorpusUnaryUnion)->Arg(10)->Arg(100)->Arg(1000000);
+
+// Intersection of consecutive corpus geometries
+static void
+BM_CorpusIntersection(benchmark::State& state)
+{
+    auto geoms = benchutil::corpus(static_cast<std::size_t>(state.range(0)));
+    state.SetLabel(benchutil::corpusLabel(static_cast<std::size_t>(state.range(0))));
+
+    for(auto _ : state) {
+        for(std::size_t i = 1; i < geoms.size(); i++) {
+            try {
+                benchmark::DoNotOptimize(
+                    OverlayNGRobust::Overlay(geoms[i - 1], geoms[i], OverlayNG::INTERSECTION));
+            }
+            catch(const std::exception&) {
+                // Some corpus inputs are invalid on purpose
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(geoms.size()));
+}
+BENCHMARK(BM_CorpusIntersection)->Arg(10)->Arg(100)->Arg(1000000);
+
+// As BM_CorpusIntersection, falling back directly to snap-rounding
+static void
+BM_CorpusIntersectionFast(benchmark::State& state)
+{
+    auto geoms = benchutil::corpus(static_cast<std::size_t>(state.range(0)));
+    state.SetLabel(benchutil::corpusLabel(static_cast<std::size_t>(state.range(0))));
+
+    for(auto _ : state) {
+        for(std::size_t i = 1; i < geoms.size(); i++) {
+            try {
+                benchmark::DoNotOptimize(
+                    OverlayNGRobust::OverlayFast(geoms[i - 1], geoms[i], OverlayNG::INTERSECTION));
+            }
+            catch(const std::exception&) {
+                // Some corpus inputs are invalid on purpose
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(geoms.size()));
+}
+BENCHMARK(BM_CorpusIntersectionFast)->Arg(10)->Arg(100)->Arg(1000000);
@@ -0,0 +1,118 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include "BenchmarkUtil.h"
+
+#include <geos/geom/Point.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace geos::geom;
+using geos::geom::prep::PreparedGeometryFactory;
+
+namespace {
+
+std::vector<std::unique_ptr<Point>>
+randomPointGeoms(std::size_t n)
+{
+    std::vector<std::unique_ptr<Point>> points;
+    points.reserve(n);
+    for(const Coordinate& c : benchutil::randomCoords(n, 200.0)) {
+        points.emplace_back(benchutil::factory().createPoint(Coordinate(c.x - 100, c.y - 100)));
+    }
+    return points;
+}
+
+} // anonymous namespace
+
+static void
+BM_IntersectsPolygonPolygon(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(10, 10), 100, numPts, 5);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(a->intersects(b.get()));
+    }
+}
+BENCHMARK(BM_IntersectsPolygonPolygon)->Arg(100)->Arg(10000);
+
+static void
+BM_RelatePolygonPolygon(benchmark::State& state)
+{
+    const int numPts = static_cast<int>(state.range(0));
+    auto a = benchutil::sineStar(Coordinate(0, 0), 100, numPts);
+    auto b = benchutil::sineStar(Coordinate(10, 10), 100, numPts, 5);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(a->relate(b.get()));
+    }
+}
+BENCHMARK(BM_RelatePolygonPolygon)->Arg(100)->Arg(10000);
+
+static void
+BM_ContainsPoints(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    auto points = randomPointGeoms(1000);
+
+    for(auto _ : state) {
+        std::size_t n = 0;
+        for(const auto& p : points) {
+            n += star->contains(p.get());
+        }
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+BENCHMARK(BM_ContainsPoints)->Arg(100)->Arg(10000);
+
+static void
+BM_PreparedContainsPoints(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    auto prep = PreparedGeometryFactory::prepare(star.get());
+    auto points = randomPointGeoms(1000);
+
+    for(auto _ : state) {
+        std::size_t n = 0;
+        for(const auto& p : points) {
+            n += prep->contains(p.get());
+        }
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+BENCHMARK(BM_PreparedContainsPoints)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_PreparedIntersectsPolygons(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    auto prep = PreparedGeometryFactory::prepare(star.get());
+    std::vector<std::unique_ptr<Polygon>> circles;
+    for(const Coordinate& c : benchutil::randomCoords(100, 200.0)) {
+        circles.push_back(benchutil::circle(Coordinate(c.x - 100, c.y - 100), 5, 32));
+    }
+
+    for(auto _ : state) {
+        std::size_t n = 0;
+        for(const auto& c : circles) {
+            n += prep->intersects(c.get());
+        }
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(circles.size()));
+}
+BENCHMARK(BM_PreparedIntersectsPolygons)->Arg(100)->Arg(10000);
@@ -0,0 +1,200 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include "BenchmarkUtil.h"
+
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/simplify/CoverageSimplifier.h>
+#include <geos/simplify/DouglasPeuckerSimplifier.h>
+#include <geos/simplify/MultiResolutionSimplifier.h>
+#include <geos/simplify/TopologyPreservingSimplifier.h>
+#include <geos/simplify/VWSimplifier.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace geos::geom;
+using geos::simplify::CoverageSimplifier;
+using geos::simplify::DouglasPeuckerSimplifier;
+using geos::simplify::MultiResolutionSimplifier;
+using geos::simplify::TopologyPreservingSimplifier;
+using geos::simplify::VWSimplifier;
+
+static void
+BM_SimplifyDP(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(DouglasPeuckerSimplifier::simplify(star.get(), 1.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimplifyDP)->Arg(1000)->Arg(100000);
+
+static void
+BM_SimplifyTopologyPreserving(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(TopologyPreservingSimplifier::simplify(star.get(), 1.0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimplifyTopologyPreserving)->Arg(1000)->Arg(100000);
+
+// arguments: number of points, preserve topology
+static void
+BM_SimplifyVW(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        VWSimplifier simp(star.get());
+        simp.setDistanceTolerance(1.0);
+        simp.setPreserveTopology(state.range(1) != 0);
+        benchmark::DoNotOptimize(simp.getResultGeometry());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimplifyVW)->Args({1000, 0})->Args({100000, 0})->Args({1000, 1})->Args({100000, 1});
+
+// keeps a hundredth of the points
+static void
+BM_SimplifyVWMaxVertices(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        VWSimplifier simp(star.get());
+        simp.setMaxVertices(static_cast<std::size_t>(state.range(0) / 100));
+        simp.setPreserveTopology(true);
+        benchmark::DoNotOptimize(simp.getResultGeometry());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimplifyVWMaxVertices)->Arg(100000);
+
+// A grid of square cells whose sides zigzag, each side being
+// generated once so adjacent cells share their vertices exactly
+static std::vector<std::unique_ptr<Geometry>>
+zigzagGrid(int nSide, int ptsPerSide)
+{
+    auto side = [ptsPerSide](const Coordinate& p0, const Coordinate& p1) {
+        std::vector<Coordinate> pts;
+        for(int i = 0; i < ptsPerSide; i++) {
+            double t = static_cast<double>(i) / ptsPerSide;
+            double offset = (i % 2 == 0) ? 0 : 0.05;
+            pts.emplace_back(p0.x + t * (p1.x - p0.x) + offset * (p1.y - p0.y),
+                             p0.y + t * (p1.y - p0.y) - offset * (p1.x - p0.x));
+        }
+        return pts;
+    };
+
+    std::vector<std::unique_ptr<Geometry>> cells;
+    for(int i = 0; i < nSide; i++) {
+        for(int j = 0; j < nSide; j++) {
+            Coordinate c00(i, j), c10(i + 1, j), c11(i + 1, j + 1), c01(i, j + 1);
+            std::vector<Coordinate> ring = side(c00, c10);
+            auto right = side(c10, c11);
+            ring.insert(ring.end(), right.begin(), right.end());
+            auto top = side(c01, c11);
+            ring.push_back(c11);
+            ring.insert(ring.end(), top.rbegin(), top.rend() - 1);
+            auto left = side(c00, c01);
+            ring.push_back(c01);
+            ring.insert(ring.end(), left.rbegin(), left.rend() - 1);
+            ring.push_back(c00);
+            auto shell = benchutil::factory().createLinearRing(
+                             benchutil::factory().getCoordinateSequenceFactory()->create(std::move(ring)));
+            cells.push_back(benchutil::factory().createPolygon(std::move(shell)));
+        }
+    }
+    return cells;
+}
+
+static void
+BM_SimplifyCoverageTopologyPreserving(benchmark::State& state)
+{
+    auto cells = zigzagGrid(30, 100);
+
+    for(auto _ : state) {
+        for(const auto& cell : cells) {
+            benchmark::DoNotOptimize(TopologyPreservingSimplifier::simplify(cell.get(), 0.1));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(cells.size()));
+}
+BENCHMARK(BM_SimplifyCoverageTopologyPreserving);
+
+// argument: number of threads
+static void
+BM_SimplifyCoverage(benchmark::State& state)
+{
+    auto cells = zigzagGrid(30, 100);
+    std::vector<const Geometry*> coverage;
+    for(const auto& cell : cells) {
+        coverage.push_back(cell.get());
+    }
+
+    for(auto _ : state) {
+        CoverageSimplifier simp(coverage);
+        simp.setDistanceTolerance(0.1);
+        simp.setNumThreads(static_cast<unsigned int>(state.range(0)));
+        benchmark::DoNotOptimize(simp.getResult());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(cells.size()));
+}
+BENCHMARK(BM_SimplifyCoverage)->Arg(1)->Arg(4)->UseRealTime();
+
+// the tolerances of 15 zoom levels, halving at each level
+static std::vector<double>
+zoomTolerances()
+{
+    std::vector<double> tolerances;
+    for(int z = 0; z < 15; z++) {
+        tolerances.push_back(10.0 / (1 << z));
+    }
+    return tolerances;
+}
+
+static void
+BM_SimplifyLevelsDP(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    auto line = star->getExteriorRing()->clone();
+    auto tolerances = zoomTolerances();
+
+    for(auto _ : state) {
+        for(double tolerance : tolerances) {
+            benchmark::DoNotOptimize(DouglasPeuckerSimplifier::simplify(line.get(), tolerance));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimplifyLevelsDP)->Arg(1000)->Arg(100000);
+
+static void
+BM_SimplifyLevelsMultiResolution(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+    auto line = star->getExteriorRing()->clone();
+    auto tolerances = zoomTolerances();
+
+    for(auto _ : state) {
+        MultiResolutionSimplifier simp(line.get());
+        benchmark::DoNotOptimize(simp.getResultGeometries(tolerances));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimplifyLevelsMultiResolution)->Arg(1000)->Arg(100000);
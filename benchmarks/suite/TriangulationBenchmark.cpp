@@ -0,0 +1,107 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include "BenchmarkUtil.h"
+
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/triangulate/CompactDelaunayTriangulator.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/PolygonTriangulator.h>
+#include <geos/triangulate/VoronoiDiagramBuilder.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace geos::geom;
+using geos::triangulate::CompactDelaunayTriangulator;
+using geos::triangulate::DelaunayTriangulationBuilder;
+using geos::triangulate::PolygonTriangulator;
+using geos::triangulate::VoronoiDiagramBuilder;
+
+static void
+BM_DelaunayTriangulation(benchmark::State& state, bool isHilbertOrder)
+{
+    CoordinateArraySequence seq(new std::vector<Coordinate>(
+                                    benchutil::randomCoords(static_cast<std::size_t>(state.range(0)))));
+
+    for(auto _ : state) {
+        DelaunayTriangulationBuilder builder;
+        builder.setHilbertOrder(isHilbertOrder);
+        builder.setSites(seq);
+        benchmark::DoNotOptimize(&builder.getSubdivision());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_DelaunayTriangulation, lexicographic, false)->Arg(1000)->Arg(100000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_DelaunayTriangulation, hilbert, true)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+static void
+BM_CompactDelaunayTriangulation(benchmark::State& state)
+{
+    CoordinateArraySequence seq(new std::vector<Coordinate>(
+                                    benchutil::randomCoords(static_cast<std::size_t>(state.range(0)))));
+
+    for(auto _ : state) {
+        CompactDelaunayTriangulator cdt(seq);
+        benchmark::DoNotOptimize(cdt.getNumTriangles());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CompactDelaunayTriangulation)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+static void
+BM_VoronoiDiagram(benchmark::State& state, bool isHilbertOrder)
+{
+    CoordinateArraySequence seq(new std::vector<Coordinate>(
+                                    benchutil::randomCoords(static_cast<std::size_t>(state.range(0)))));
+
+    for(auto _ : state) {
+        VoronoiDiagramBuilder builder;
+        builder.setHilbertOrder(isHilbertOrder);
+        builder.setSites(seq);
+        benchmark::DoNotOptimize(builder.getDiagram(benchutil::factory()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_VoronoiDiagram, lexicographic, false)->Arg(1000)->Arg(100000);
+BENCHMARK_CAPTURE(BM_VoronoiDiagram, hilbert, true)->Arg(1000)->Arg(100000);
+
+static void
+BM_OrderedVoronoiDiagram(benchmark::State& state)
+{
+    CoordinateArraySequence seq(new std::vector<Coordinate>(
+                                    benchutil::randomCoords(static_cast<std::size_t>(state.range(0)))));
+
+    for(auto _ : state) {
+        VoronoiDiagramBuilder builder;
+        builder.setOrdered(true);
+        builder.setSites(seq);
+        benchmark::DoNotOptimize(builder.getDiagram(benchutil::factory()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_OrderedVoronoiDiagram)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+static void
+BM_PolygonTriangulation(benchmark::State& state, bool isDelaunay)
+{
+    auto poly = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        PolygonTriangulator triangulator(*poly);
+        triangulator.setDelaunay(isDelaunay);
+        benchmark::DoNotOptimize(triangulator.getNumTriangles());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_PolygonTriangulation, earClipping, false)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_CAPTURE(BM_PolygonTriangulation, delaunay, true)->Arg(1000)->Arg(10000)->Arg(100000);
@@ -0,0 +1,139 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+#include "BenchmarkUtil.h"
+
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/operation/valid/IsValidOp.h>
+#include <geos/operation/valid/MakeValid.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+using namespace geos::geom;
+using geos::operation::valid::IsValidOp;
+using geos::operation::valid::MakeValid;
+
+static void
+BM_IsValidPolygon(benchmark::State& state)
+{
+    auto star = benchutil::sineStar(Coordinate(0, 0), 100, static_cast<int>(state.range(0)));
+
+    for(auto _ : state) {
+        IsValidOp op(star.get());
+        benchmark::DoNotOptimize(op.isValid());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IsValidPolygon)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void
+BM_IsValidPolygonWithHoles(benchmark::State& state)
+{
+    const int numHoles = static_cast<int>(state.range(0));
+    const int side = static_cast<int>(std::ceil(std::sqrt(numHoles)));
+    auto shell = benchutil::circle(Coordinate(0, 0), 4.0 * side, 1000);
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    for(int i = 0; i < numHoles; i++) {
+        double x = 2.0 * (i % side) - side + 1;
+        double y = 2.0 * (i / side) - side + 1;
+        auto hole = benchutil::circle(Coordinate(x, y), 1.0, 32);
+        holes.push_back(benchutil::factory().createLinearRing(hole->getExteriorRing()->getCoordinates()));
+    }
+    auto poly = benchutil::factory().createPolygon(
+                    benchutil::factory().createLinearRing(shell->getExteriorRing()->getCoordinates()),
+                    std::move(holes));
+
+    for(auto _ : state) {
+        IsValidOp op(poly.get());
+        benchmark::DoNotOptimize(op.isValid());
+    }
+}
+BENCHMARK(BM_IsValidPolygonWithHoles)->Arg(10)->Arg(100)->Arg(1000);
+
+static void
+BM_IsValidStarGrid(benchmark::State& state)
+{
+    auto coll = benchutil::factory().buildGeometry(
+                    benchutil::starGrid(static_cast<int>(state.range(0)), 100));
+
+    for(auto _ : state) {
+        IsValidOp op(coll.get());
+        benchmark::DoNotOptimize(op.isValid());
+    }
+}
+BENCHMARK(BM_IsValidStarGrid)->Arg(5)->Arg(20);
+
+static void
+BM_CorpusIsValid(benchmark::State& state)
+{
+    auto geoms = benchutil::corpus(static_cast<std::size_t>(state.range(0)));
+    state.SetLabel(benchutil::corpusLabel(static_cast<std::size_t>(state.range(0))));
+
+    for(auto _ : state) {
+        std::size_t n = 0;
+        for(const Geometry* g : geoms) {
+            IsValidOp op(g);
+            n += op.isValid();
+        }
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(geoms.size()));
+}
+BENCHMARK(BM_CorpusIsValid)->Arg(10)->Arg(100)->Arg(1000000);
+
+static void
+BM_CorpusIsValidBatch(benchmark::State& state)
+{
+    auto geoms = benchutil::corpus(1000000);
+    state.SetLabel(benchutil::corpusLabel(1000000));
+    std::vector<int> errors;
+    std::vector<Coordinate> locations;
+
+    for(auto _ : state) {
+        IsValidOp::validate(geoms, false, static_cast<unsigned int>(state.range(0)), errors, locations);
+        benchmark::DoNotOptimize(errors.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(geoms.size()));
+}
+BENCHMARK(BM_CorpusIsValidBatch)->Arg(1)->Arg(4)->UseRealTime();
+
+// A ring joining every third point of a circle, crossing itself
+// along its whole length
+static std::unique_ptr<Polygon>
+crossingStar(int numPts)
+{
+    std::vector<Coordinate> pts;
+    for(int i = 0; i <= numPts; i++) {
+        double angle = 2 * M_PI * ((3 * i) % numPts) / numPts;
+        pts.emplace_back(100 * std::cos(angle), 100 * std::sin(angle));
+    }
+    auto seq = benchutil::factory().getCoordinateSequenceFactory()->create(std::move(pts));
+    return benchutil::factory().createPolygon(benchutil::factory().createLinearRing(std::move(seq)));
+}
+
+static void
+BM_MakeValidCrossingStar(benchmark::State& state)
+{
+    auto poly = crossingStar(static_cast<int>(state.range(1)));
+    MakeValid makeValid;
+    makeValid.setMethod(static_cast<MakeValid::Method>(state.range(0)));
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(makeValid.build(poly.get()));
+    }
+}
+BENCHMARK(BM_MakeValidCrossingStar)->Args({MakeValid::LINEWORK, 100})->Args({MakeValid::EVEN_ODD, 100})
+->Args({MakeValid::WINDING, 100})->Args({MakeValid::LINEWORK, 1000})->Args({MakeValid::EVEN_ODD, 1000})
+->Args({MakeValid::WINDING, 1000});
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+#
+# This file is part of project GEOS (http://trac.osgeo.org/geos/)
+#
+# Compares two JSON result files of geos_benchmarks, e.g.
+#
+#   geos_benchmarks --benchmark_out=base.json --benchmark_out_format=json
+#   (rebuild)
+#   geos_benchmarks --benchmark_out=new.json --benchmark_out_format=json
+#   compare_benchmarks.py base.json new.json --threshold 10
+#
+# Prints the relative change of each benchmark present in both files
+# and exits with status 1 if any got slower by more than the threshold.
+#
+
+import argparse
+import json
+import sys
+
+
+def load(path, metric):
+    with open(path) as f:
+        data = json.load(f)
+    results = {}
+    for b in data.get('benchmarks', []):
+        # With --benchmark_repetitions only compare the aggregates
+        if b.get('run_type') == 'iteration' and 'repetitions' in b and b['repetitions'] > 1:
+            continue
+        if b.get('run_type') == 'aggregate' and b.get('aggregate_name') != 'median':
+            continue
+        name = b.get('run_name', b['name'])
+        results[name] = b[metric]
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two geos_benchmarks JSON result files')
+    parser.add_argument('baseline', help='JSON results of the reference build')
+    parser.add_argument('contender', help='JSON results of the build to check')
+    parser.add_argument('--metric', default='real_time', choices=['real_time', 'cpu_time'],
+                        help='time measure to compare (default: real_time)')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='slowdown in percent reported as a regression (default: 5)')
+    parser.add_argument('--filter', default='',
+                        help='only compare benchmarks whose name contains this string')
+    args = parser.parse_args()
+
+    base = load(args.baseline, args.metric)
+    new = load(args.contender, args.metric)
+
+    names = [n for n in base if n in new and args.filter in n]
+    if not names:
+        print('No common benchmarks to compare')
+        return 0
+
+    only = [n for n in sorted(set(base) ^ set(new)) if args.filter in n]
+    width = max(len(n) for n in names + only)
+    print('{:<{w}}  {:>14}  {:>14}  {:>8}'.format('Benchmark', 'Baseline', 'Contender', 'Change', w=width))
+
+    regressions = []
+    for name in names:
+        change = 100.0 * (new[name] - base[name]) / base[name] if base[name] > 0 else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = '  improved'
+        print('{:<{w}}  {:>14.1f}  {:>14.1f}  {:>+7.1f}%{}'.format(
+            name, base[name], new[name], change, flag, w=width))
+
+    for name in only:
+        print('{:<{w}}  only in {}'.format(name, 'baseline' if name in base else 'contender', w=width))
+
+    if regressions:
+        print('\n{} benchmark(s) slower by more than {}%'.format(len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -40,6 +40,7 @@
 #define GEOSWKBReader geos::io::WKBReader
 #define GEOSWKBWriter geos::io::WKBWriter
 typedef struct GEOSBufParams_t GEOSBufferParams;
+typedef struct GEOSMakeValidParams_t GEOSMakeValidParams;
 
 #include "geos_c.h"
 
@@ -245,6 +246,13 @@ extern "C" {
         return GEOSisValidDetail_r(handle, g, flags, reason, location);
     }
 
+    int
+    GEOSisValidBatch(const Geometry* const* geoms, unsigned int ngeoms, int flags,
+                     unsigned int nthreads, int* errors, double* x, double* y)
+    {
+        return GEOSisValidBatch_r(handle, geoms, ngeoms, flags, nthreads, errors, x, y);
+    }
+
 //-----------------------------------------------------------------
 // general purpose
 //-----------------------------------------------------------------
@@ -267,6 +275,12 @@ extern "C" {
         return GEOSDistance_r(handle, g1, g2, dist);
     }
 
+    char
+    GEOSDistanceWithin(const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return GEOSDistanceWithin_r(handle, g1, g2, dist);
+    }
+
     int
     GEOSDistanceIndexed(const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -297,6 +311,12 @@ extern "C" {
         return GEOSFrechetDistanceDensify_r(handle, g1, g2, densifyFrac, dist);
     }
 
+    char
+    GEOSFrechetDistanceWithin(const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return GEOSFrechetDistanceWithin_r(handle, g1, g2, dist);
+    }
+
     int
     GEOSArea(const Geometry* g, double* area)
     {
@@ -461,6 +481,13 @@ extern "C" {
         return GEOSMaximumInscribedCircle_r(handle, g, tolerance);
     }
 
+    int
+    GEOSMaximumInscribedCircles(const Geometry* const* geoms, unsigned int ngeoms, double tolerance,
+                                unsigned int nthreads, double* x, double* y, double* radius)
+    {
+        return GEOSMaximumInscribedCircles_r(handle, geoms, ngeoms, tolerance, nthreads, x, y, radius);
+    }
+
     Geometry*
     GEOSLargestEmptyCircle(const Geometry* g, const Geometry* boundary, double tolerance)
     {
@@ -485,6 +512,12 @@ extern "C" {
         return GEOSMinimumClearance_r(handle, g, d);
     }
 
+    char
+    GEOSMinimumClearanceAtLeast(const Geometry* g, double clearance)
+    {
+        return GEOSMinimumClearanceAtLeast_r(handle, g, clearance);
+    }
+
     Geometry*
     GEOSDifference(const Geometry* g1, const Geometry* g2)
     {
@@ -788,12 +821,42 @@ extern "C" {
         return GEOSMakeValid_r(handle, g);
     }
 
+    GEOSMakeValidParams*
+    GEOSMakeValidParams_create()
+    {
+        return GEOSMakeValidParams_create_r(handle);
+    }
+
+    void
+    GEOSMakeValidParams_destroy(GEOSMakeValidParams* p)
+    {
+        return GEOSMakeValidParams_destroy_r(handle, p);
+    }
+
+    int
+    GEOSMakeValidParams_setMethod(GEOSMakeValidParams* p, int method)
+    {
+        return GEOSMakeValidParams_setMethod_r(handle, p, method);
+    }
+
+    Geometry*
+    GEOSMakeValidWithParams(const Geometry* g, const GEOSMakeValidParams* p)
+    {
+        return GEOSMakeValidWithParams_r(handle, g, p);
+    }
+
     Geometry*
     GEOSLineMerge(const Geometry* g)
     {
         return GEOSLineMerge_r(handle, g);
     }
 
+    Geometry*
+    GEOSLineMergeDirected(const Geometry* g)
+    {
+        return GEOSLineMergeDirected_r(handle, g);
+    }
+
     Geometry*
     GEOSReverse(const Geometry* g)
     {
@@ -1005,12 +1068,39 @@ extern "C" {
         return GEOSGeom_clone_r(handle, g);
     }
 
+    int
+    GEOSGeom_createFromGeoArrow(int type, int hasZ,
+                                const double* x, const double* y, const double* z,
+                                unsigned int stride, unsigned int ncoords,
+                                const int* geomOffsets, const int* partOffsets, const int* ringOffsets,
+                                unsigned int ngeoms, Geometry** geoms)
+    {
+        return GEOSGeom_createFromGeoArrow_r(handle, type, hasZ, x, y, z, stride, ncoords,
+                                             geomOffsets, partOffsets, ringOffsets, ngeoms, geoms);
+    }
+
+    int
+    GEOSGeom_toGeoArrow(const Geometry* const* geoms, unsigned int ngeoms, int includeZ,
+                        int* type, double** coords, unsigned int* ncoords,
+                        int** geomOffsets, int** partOffsets, int** ringOffsets)
+    {
+        return GEOSGeom_toGeoArrow_r(handle, geoms, ngeoms, includeZ, type, coords, ncoords,
+                                     geomOffsets, partOffsets, ringOffsets);
+    }
+
     GEOSGeometry*
     GEOSGeom_setPrecision(const GEOSGeometry* g, double gridSize, int flags)
     {
         return GEOSGeom_setPrecision_r(handle, g, gridSize, flags);
     }
 
+    int
+    GEOSGeom_setPrecisionLayer(const GEOSGeometry* const* geoms, unsigned int ngeoms,
+                               double gridSize, unsigned int nthreads, GEOSGeometry** results)
+    {
+        return GEOSGeom_setPrecisionLayer_r(handle, geoms, ngeoms, gridSize, nthreads, results);
+    }
+
     double
     GEOSGeom_getPrecision(const GEOSGeometry* g)
     {
@@ -1061,6 +1151,26 @@ extern "C" {
         return GEOSTopologyPreserveSimplify_r(handle, g, tolerance);
     }
 
+    Geometry*
+    GEOSSimplifyVW(const Geometry* g, double tolerance, unsigned int maxVertices,
+                   int preserveTopology)
+    {
+        return GEOSSimplifyVW_r(handle, g, tolerance, maxVertices, preserveTopology);
+    }
+
+    Geometry*
+    GEOSCoverageSimplify(const Geometry* g, double tolerance, unsigned int nthreads)
+    {
+        return GEOSCoverageSimplify_r(handle, g, tolerance, nthreads);
+    }
+
+    int
+    GEOSSimplifyLevels(const Geometry* g, const double* tolerances, unsigned int ntolerances,
+                       int method, Geometry** results)
+    {
+        return GEOSSimplifyLevels_r(handle, g, tolerances, ntolerances, method, results);
+    }
+
 
     /* WKT Reader */
     WKTReader*
@@ -1310,6 +1420,27 @@ extern "C" {
         return GEOSPreparedDistance_r(handle, g1, g2, dist);
     }
 
+    char
+    GEOSPreparedDistanceWithin(const geos::geom::prep::PreparedGeometry* g1, const Geometry* g2, double dist)
+    {
+        return GEOSPreparedDistanceWithin_r(handle, g1, g2, dist);
+    }
+
+    int
+    GEOSPreparedDistancePoints(const geos::geom::prep::PreparedGeometry* g1,
+                               const double* x, const double* y, unsigned int n, double* distances)
+    {
+        return GEOSPreparedDistancePoints_r(handle, g1, x, y, n, distances);
+    }
+
+    int
+    GEOSPreparedDistanceWithinPoints(const geos::geom::prep::PreparedGeometry* g1,
+                                     const double* x, const double* y, unsigned int n,
+                                     double dist, char* results)
+    {
+        return GEOSPreparedDistanceWithinPoints_r(handle, g1, x, y, n, dist, results);
+    }
+
     GEOSSTRtree*
     GEOSSTRtree_create(size_t nodeCapacity)
     {
@@ -44,6 +44,8 @@
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/io/WKBWriter.h>
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/GeoArrowWriter.h>
 #include <geos/algorithm/BoundaryNodeRule.h>
 #include <geos/algorithm/MinimumBoundingCircle.h>
 #include <geos/algorithm/MinimumDiameter.h>
@@ -52,8 +54,11 @@
 #include <geos/algorithm/construct/LargestEmptyCircle.h>
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
 #include <geos/algorithm/distance/DiscreteFrechetDistance.h>
+#include <geos/simplify/CoverageSimplifier.h>
 #include <geos/simplify/DouglasPeuckerSimplifier.h>
+#include <geos/simplify/MultiResolutionSimplifier.h>
 #include <geos/simplify/TopologyPreservingSimplifier.h>
+#include <geos/simplify/VWSimplifier.h>
 #include <geos/noding/GeometryNoder.h>
 #include <geos/noding/Noder.h>
 #include <geos/operation/buffer/BufferBuilder.h>
@@ -79,12 +84,15 @@
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/precision/GeometryPrecisionReducer.h>
+#include <geos/precision/LayerPrecisionReducer.h>
 #include <geos/linearref/LengthIndexedLine.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
 #include <geos/util.h>
 #include <geos/util/IllegalArgumentException.h>
+#include <geos/util/CancellationToken.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/OperationStats.h>
 #include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/util/Machine.h>
 #include <geos/version.h>
@@ -95,6 +103,7 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <chrono>
 #include <cstring>
 #include <fstream>
 #include <iostream>
@@ -112,6 +121,7 @@
 #define GEOSPreparedGeometry geos::geom::prep::PreparedGeometry
 #define GEOSCoordSequence geos::geom::CoordinateSequence
 #define GEOSBufferParams geos::operation::buffer::BufferParameters
+#define GEOSMakeValidParams geos::operation::valid::MakeValid
 #define GEOSSTRtree geos::index::strtree::SimpleSTRtree
 #define GEOSWKTReader geos::io::WKTReader
 #define GEOSWKTWriter geos::io::WKTWriter
@@ -150,6 +160,10 @@ using geos::io::WKTReader;
 using geos::io::WKTWriter;
 using geos::io::WKBReader;
 using geos::io::WKBWriter;
+using geos::io::GeoArrowArray;
+using geos::io::GeoArrowBuffers;
+using geos::io::GeoArrowReader;
+using geos::io::GeoArrowWriter;
 
 using geos::algorithm::distance::DiscreteFrechetDistance;
 using geos::algorithm::distance::DiscreteHausdorffDistance;
@@ -180,6 +194,14 @@ typedef struct GEOSContextHandle_HS {
     int WKBOutputDims;
     int WKBByteOrder;
     int initialized;
+    geos::util::CancellationToken interruptToken;
+    GEOSContextInterruptCallback* interruptCallback;
+    void* interruptData;
+    double timeout;
+    bool statsEnabled;
+    geos::util::OperationStats pendingStats;
+    geos::util::OperationStats lastStats;
+    geos::util::OperationStats cumulativeStats;
 
     GEOSContextHandle_HS()
         :
@@ -189,7 +211,11 @@ typedef struct GEOSContextHandle_HS {
         noticeData(nullptr),
         errorMessageOld(nullptr),
         errorMessageNew(nullptr),
-        errorData(nullptr)
+        errorData(nullptr),
+        interruptCallback(nullptr),
+        interruptData(nullptr),
+        timeout(0.0),
+        statsEnabled(false)
     {
         memset(msgBuffer, 0, sizeof(msgBuffer));
         geomFactory = GeometryFactory::getDefaultInstance();
@@ -200,6 +226,37 @@ typedef struct GEOSContextHandle_HS {
         initialized = 1;
     }
 
+    GEOSContextInterruptCallback*
+    setInterruptCallback(GEOSContextInterruptCallback* cb, void* userData)
+    {
+        GEOSContextInterruptCallback* f = interruptCallback;
+        interruptCallback = cb;
+        interruptData = userData;
+        interruptToken.setCallback(cb ? &checkInterruptCallback : nullptr, this);
+
+        return f;
+    }
+
+    static bool
+    checkInterruptCallback(void* extHandle)
+    {
+        GEOSContextHandle_HS* handle = static_cast<GEOSContextHandle_HS*>(extHandle);
+        return handle->interruptCallback(handle->interruptData) != 0;
+    }
+
+    // Returns the token to make current while running an operation,
+    // starting the operation time budget unless called from within
+    // another operation of this context.
+    geos::util::CancellationToken*
+    startOperation()
+    {
+        if(timeout > 0 && geos::util::CancellationScope::current() != &interruptToken) {
+            interruptToken.setTimeout(std::chrono::duration_cast<geos::util::CancellationToken::Clock::duration>(
+                                          std::chrono::duration<double>(timeout)));
+        }
+        return &interruptToken;
+    }
+
     GEOSMessageHandler
     setNoticeHandler(GEOSMessageHandler nf)
     {
@@ -289,6 +346,40 @@ typedef struct GEOSContextHandle_HS {
     }
 } GEOSContextHandleInternal_t;
 
+// Installs the interruption token of a context, and its statistics
+// collector when enabled, for the duration of an operation.
+// Operations recording nothing (e.g. GEOSGeom_destroy_r) leave the
+// statistics of the last operation untouched.
+class ContextOperationScope {
+public:
+    explicit ContextOperationScope(GEOSContextHandleInternal_t* p_handle)
+        : handle(p_handle)
+        , recording(p_handle && p_handle->statsEnabled &&
+                    geos::util::CancellationScope::current() != &p_handle->interruptToken)
+        , cancellation(p_handle ? p_handle->startOperation()
+                       : geos::util::CancellationScope::current())
+        , stats(recording ? &p_handle->pendingStats : geos::util::OperationStats::current())
+    {
+        if(recording) {
+            handle->pendingStats.reset();
+        }
+    }
+
+    ~ContextOperationScope()
+    {
+        if(recording && !handle->pendingStats.isEmpty()) {
+            handle->lastStats = handle->pendingStats;
+            handle->cumulativeStats.merge(handle->pendingStats);
+        }
+    }
+
+private:
+    GEOSContextHandleInternal_t* handle;
+    bool recording;
+    geos::util::CancellationScope cancellation;
+    geos::util::OperationStatsScope stats;
+};
+
 // CAPI_ItemVisitor is used internally by the CAPI STRtree
 // wrappers. It's defined here just to keep it out of the
 // extern "C" block.
@@ -339,6 +430,24 @@ gstrdup(std::string const& str)
     return gstrdup_s(str.c_str(), str.size());
 }
 
+// Copy a vector into a buffer to be released with GEOSFree,
+// or return nullptr if the vector is empty.
+template<typename T>
+T*
+mallocCopy(const std::vector<T>& v)
+{
+    if(v.empty()) {
+        return nullptr;
+    }
+
+    T* out = static_cast<T*>(malloc(v.size() * sizeof(T)));
+    if(nullptr == out) {
+        throw(std::runtime_error("Failed to allocate memory for buffer copy"));
+    }
+    std::memcpy(out, v.data(), v.size() * sizeof(T));
+    return out;
+}
+
 } // namespace anonymous
 
 // Execute a lambda, using the given context handle to process errors.
@@ -361,6 +470,7 @@ inline auto execute(
     }
 
     try {
+        ContextOperationScope scope(handle);
         return f();
     } catch (const std::exception& e) {
         handle->ERROR_MESSAGE("%s", e.what());
@@ -385,6 +495,7 @@ inline auto execute(GEOSContextHandle_t extHandle, F&& f) -> decltype(f()) {
     }
 
     try {
+        ContextOperationScope scope(handle);
         return f();
     } catch (const std::exception& e) {
         handle->ERROR_MESSAGE("%s", e.what());
@@ -401,6 +512,8 @@ template<typename F, typename std::enable_if<std::is_void<decltype(std::declval<
 inline void execute(GEOSContextHandle_t extHandle, F&& f) {
     GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
     try {
+        // Some callers (GEOSGeom_destroy) do not require an initialized context
+        ContextOperationScope scope(handle);
         f();
     } catch (const std::exception& e) {
         handle->ERROR_MESSAGE("%s", e.what());
@@ -478,6 +591,93 @@ extern "C" {
         return handle->setErrorHandler(ef, userData);
     }
 
+    GEOSContextInterruptCallback*
+    GEOSContext_setInterruptCallback_r(GEOSContextHandle_t extHandle, GEOSContextInterruptCallback* cb, void* userData)
+    {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return nullptr;
+        }
+
+        return handle->setInterruptCallback(cb, userData);
+    }
+
+    void
+    GEOSContext_interruptRequest_r(GEOSContextHandle_t extHandle)
+    {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        handle->interruptToken.request();
+    }
+
+    void
+    GEOSContext_interruptCancel_r(GEOSContextHandle_t extHandle)
+    {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        handle->interruptToken.cancel();
+    }
+
+    void
+    GEOSContext_setTimeout_r(GEOSContextHandle_t extHandle, double seconds)
+    {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return;
+        }
+
+        handle->timeout = seconds;
+        if(seconds <= 0) {
+            handle->interruptToken.clearDeadline();
+        }
+    }
+
+    void
+    GEOSContext_setStatsEnabled_r(GEOSContextHandle_t extHandle, int enabled)
+    {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return;
+        }
+
+        handle->statsEnabled = (enabled != 0);
+    }
+
+    int
+    GEOSContext_getStat_r(GEOSContextHandle_t extHandle, int stat, int cumulative, double* value)
+    {
+        using geos::util::OperationStats;
+
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return 0;
+        }
+
+        const OperationStats& stats = cumulative ? handle->cumulativeStats : handle->lastStats;
+        if(stat >= GEOS_STAT_TIME_NODING && stat < GEOS_STAT_TIME_NODING + OperationStats::NUM_PHASES) {
+            *value = stats.getTime(static_cast<OperationStats::Phase>(stat - GEOS_STAT_TIME_NODING));
+            return 1;
+        }
+        if(stat >= GEOS_STAT_SEGMENTS_NODED && stat < GEOS_STAT_SEGMENTS_NODED + OperationStats::NUM_COUNTERS) {
+            *value = static_cast<double>(stats.getCount(
+                                             static_cast<OperationStats::Counter>(stat - GEOS_STAT_SEGMENTS_NODED)));
+            return 1;
+        }
+
+        handle->ERROR_MESSAGE("Unknown operation statistic %d", stat);
+        return 0;
+    }
+
+    void
+    GEOSContext_resetStats_r(GEOSContextHandle_t extHandle)
+    {
+        GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return;
+        }
+
+        handle->lastStats.reset();
+        handle->cumulativeStats.reset();
+    }
+
     void
     finishGEOS_r(GEOSContextHandle_t extHandle)
     {
@@ -759,6 +959,32 @@ extern "C" {
         });
     }
 
+    int
+    GEOSisValidBatch_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms,
+                       unsigned int ngeoms, int flags, unsigned int nthreads,
+                       int* errors, double* x, double* y)
+    {
+        using geos::operation::valid::IsValidOp;
+
+        return execute(extHandle, 0, [&]() {
+            std::vector<const Geometry*> geomList(geoms, geoms + ngeoms);
+            std::vector<int> errorTypes;
+            std::vector<geos::geom::Coordinate> locations;
+            IsValidOp::validate(geomList, (flags & GEOSVALID_ALLOW_SELFTOUCHING_RING_FORMING_HOLE) != 0,
+                                nthreads, errorTypes, locations);
+            for(std::size_t i = 0; i < ngeoms; i++) {
+                errors[i] = errorTypes[i];
+                if(x) {
+                    x[i] = locations[i].x;
+                }
+                if(y) {
+                    y[i] = locations[i].y;
+                }
+            }
+            return 1;
+        });
+    }
+
 //-----------------------------------------------------------------
 // general purpose
 //-----------------------------------------------------------------
@@ -788,6 +1014,14 @@ extern "C" {
         });
     }
 
+    char
+    GEOSDistanceWithin_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return execute(extHandle, 2, [&]() {
+            return g1->isWithinDistance(g2, dist);
+        });
+    }
+
     int
     GEOSDistanceIndexed_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -835,6 +1069,14 @@ extern "C" {
         });
     }
 
+    char
+    GEOSFrechetDistanceWithin_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return execute(extHandle, 2, [&]() {
+            return DiscreteFrechetDistance::isWithinDistance(*g1, *g2, dist);
+        });
+    }
+
     int
     GEOSArea_r(GEOSContextHandle_t extHandle, const Geometry* g, double* area)
     {
@@ -1202,6 +1444,27 @@ extern "C" {
         });
     }
 
+    int
+    GEOSMaximumInscribedCircles_r(GEOSContextHandle_t extHandle, const Geometry* const* geoms,
+                                  unsigned int ngeoms, double tolerance,
+                                  unsigned int nthreads,
+                                  double* x, double* y, double* radius)
+    {
+        return execute(extHandle, 0, [&]() {
+            std::vector<const Geometry*> polygonals(geoms, geoms + ngeoms);
+            std::vector<geos::geom::Coordinate> centers;
+            std::vector<double> radii;
+            geos::algorithm::construct::MaximumInscribedCircle::getCenters(polygonals, tolerance, centers, radii,
+                    nthreads);
+            for(std::size_t i = 0; i < ngeoms; i++) {
+                x[i] = centers[i].x;
+                y[i] = centers[i].y;
+                radius[i] = radii[i];
+            }
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSLargestEmptyCircle_r(GEOSContextHandle_t extHandle, const Geometry* g, const GEOSGeometry* boundary, double tolerance)
     {
@@ -1246,6 +1509,15 @@ extern "C" {
         });
     }
 
+    char
+    GEOSMinimumClearanceAtLeast_r(GEOSContextHandle_t extHandle, const Geometry* g, double clearance)
+    {
+        return execute(extHandle, 2, [&]() {
+            geos::precision::MinimumClearance mc(g);
+            return mc.isAtLeast(clearance);
+        });
+    }
+
 
     Geometry*
     GEOSDifference_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
@@ -1926,6 +2198,51 @@ extern "C" {
         });
     }
 
+    GEOSMakeValidParams*
+    GEOSMakeValidParams_create_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, [&]() {
+            return new GEOSMakeValidParams();
+        });
+    }
+
+    void
+    GEOSMakeValidParams_destroy_r(GEOSContextHandle_t extHandle, GEOSMakeValidParams* p)
+    {
+        (void)extHandle;
+        delete p;
+    }
+
+    int
+    GEOSMakeValidParams_setMethod_r(GEOSContextHandle_t extHandle,
+                                    GEOSMakeValidParams* p, int method)
+    {
+        using geos::operation::valid::MakeValid;
+
+        return execute(extHandle, 0, [&]() {
+            if(method < MakeValid::LINEWORK || method > MakeValid::WINDING) {
+                throw IllegalArgumentException("Invalid make valid method");
+            }
+            p->setMethod(static_cast<MakeValid::Method>(method));
+            return 1;
+        });
+    }
+
+    Geometry*
+    GEOSMakeValidWithParams_r(GEOSContextHandle_t extHandle, const Geometry* g,
+                              const GEOSMakeValidParams* p)
+    {
+        using geos::operation::valid::MakeValid;
+
+        return execute(extHandle, [&]() {
+            MakeValid makeValid;
+            makeValid.setMethod(p->getMethod());
+            auto out = makeValid.build(g);
+            out->setSRID(g->getSRID());
+            return out.release();
+        });
+    }
+
     Geometry*
     GEOSPolygonizer_getCutEdges_r(GEOSContextHandle_t extHandle, const Geometry* const* g, unsigned int ngeoms)
     {
@@ -2041,6 +2358,26 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSLineMergeDirected_r(GEOSContextHandle_t extHandle, const Geometry* g)
+    {
+        using geos::operation::linemerge::LineMerger;
+
+        return execute(extHandle, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            const GeometryFactory* gf = handle->geomFactory;
+            LineMerger lmrgr(true);
+            lmrgr.add(g);
+
+            auto lines = lmrgr.getMergedLineStrings();
+
+            auto out = gf->buildGeometry(std::move(lines));
+            out->setSRID(g->getSRID());
+
+            return out.release();
+        });
+    }
+
     Geometry*
     GEOSReverse_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
@@ -2435,6 +2772,62 @@ extern "C" {
         });
     }
 
+    int
+    GEOSGeom_createFromGeoArrow_r(GEOSContextHandle_t extHandle, int type, int hasZ,
+                                  const double* x, const double* y, const double* z,
+                                  unsigned int stride, unsigned int ncoords,
+                                  const int* geomOffsets, const int* partOffsets, const int* ringOffsets,
+                                  unsigned int ngeoms, Geometry** geoms)
+    {
+        static_assert(sizeof(int) == sizeof(int32_t), "GeoArrow offsets must be 32-bit");
+
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+
+            GeoArrowBuffers buffers;
+            buffers.type = static_cast<geos::geom::GeometryTypeId>(type);
+            buffers.hasZ = (hasZ != 0);
+            buffers.x = x;
+            buffers.y = y;
+            buffers.z = z;
+            buffers.stride = stride;
+            buffers.numCoords = ncoords;
+            buffers.geomOffsets = reinterpret_cast<const int32_t*>(geomOffsets);
+            buffers.partOffsets = reinterpret_cast<const int32_t*>(partOffsets);
+            buffers.ringOffsets = reinterpret_cast<const int32_t*>(ringOffsets);
+            buffers.numGeoms = ngeoms;
+
+            GeoArrowReader reader(*handle->geomFactory);
+            auto result = reader.read(buffers);
+            for(std::size_t i = 0; i < result.size(); i++) {
+                geoms[i] = result[i].release();
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSGeom_toGeoArrow_r(GEOSContextHandle_t extHandle,
+                          const Geometry* const* geoms, unsigned int ngeoms, int includeZ,
+                          int* type, double** coords, unsigned int* ncoords,
+                          int** geomOffsets, int** partOffsets, int** ringOffsets)
+    {
+        return execute(extHandle, 0, [&]() {
+            std::vector<const Geometry*> input(geoms, geoms + ngeoms);
+
+            GeoArrowWriter writer(includeZ ? 3 : 2, true);
+            GeoArrowArray arr = writer.write(input);
+
+            *type = static_cast<int>(arr.type);
+            *ncoords = static_cast<unsigned int>(arr.getNumCoordinates());
+            *coords = mallocCopy(arr.coords);
+            *geomOffsets = reinterpret_cast<int*>(mallocCopy(arr.geomOffsets));
+            *partOffsets = reinterpret_cast<int*>(mallocCopy(arr.partOffsets));
+            *ringOffsets = reinterpret_cast<int*>(mallocCopy(arr.ringOffsets));
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSGeom_setPrecision_r(GEOSContextHandle_t extHandle, const GEOSGeometry* g,
                             double gridSize, int flags)
@@ -2470,6 +2863,33 @@ extern "C" {
         });
     }
 
+    int
+    GEOSGeom_setPrecisionLayer_r(GEOSContextHandle_t extHandle, const GEOSGeometry* const* geoms,
+                                 unsigned int ngeoms, double gridSize, unsigned int nthreads,
+                                 GEOSGeometry** results)
+    {
+        using namespace geos::geom;
+        using geos::precision::LayerPrecisionReducer;
+
+        return execute(extHandle, 0, [&]() {
+            std::unique_ptr<PrecisionModel> newpm;
+            if(gridSize != 0) {
+                newpm.reset(new PrecisionModel(1.0 / std::abs(gridSize)));
+            }
+            else {
+                newpm.reset(new PrecisionModel());
+            }
+            LayerPrecisionReducer reducer(*newpm);
+            reducer.setChangePrecisionModel(true);
+            reducer.setNumThreads(nthreads);
+            auto reduced = reducer.reduce(std::vector<const Geometry*>(geoms, geoms + ngeoms));
+            for(std::size_t i = 0; i < reduced.size(); i++) {
+                results[i] = reduced[i].release();
+            }
+            return 1;
+        });
+    }
+
     double
     GEOSGeom_getPrecision_r(GEOSContextHandle_t extHandle, const GEOSGeometry* g)
     {
@@ -2574,6 +2994,78 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSSimplifyVW_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance,
+                     unsigned int maxVertices, int preserveTopology)
+    {
+        using namespace geos::simplify;
+
+        return execute(extHandle, [&]() {
+            VWSimplifier simp(g1);
+            simp.setDistanceTolerance(tolerance);
+            if(maxVertices > 0) {
+                simp.setMaxVertices(maxVertices);
+            }
+            simp.setPreserveTopology(preserveTopology != 0);
+            Geometry::Ptr g3(simp.getResultGeometry());
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
+    Geometry*
+    GEOSCoverageSimplify_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance,
+                           unsigned int nthreads)
+    {
+        using namespace geos::simplify;
+
+        return execute(extHandle, [&]() {
+            std::vector<const Geometry*> coverage;
+            for(std::size_t i = 0; i < g1->getNumGeometries(); i++) {
+                coverage.push_back(g1->getGeometryN(i));
+            }
+            CoverageSimplifier simp(coverage);
+            simp.setDistanceTolerance(tolerance);
+            simp.setNumThreads(nthreads);
+            auto simplified = simp.getResult();
+
+            const GeometryFactory* gf = g1->getFactory();
+            Geometry::Ptr g3;
+            if(g1->getGeometryTypeId() == geos::geom::GEOS_MULTIPOLYGON) {
+                g3 = gf->createMultiPolygon(std::move(simplified));
+            }
+            else {
+                g3 = gf->createGeometryCollection(std::move(simplified));
+            }
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
+    int
+    GEOSSimplifyLevels_r(GEOSContextHandle_t extHandle, const Geometry* g1,
+                         const double* tolerances, unsigned int ntolerances, int method,
+                         Geometry** results)
+    {
+        using namespace geos::simplify;
+
+        return execute(extHandle, 0, [&]() {
+            if(method != GEOS_SIMPLIFY_DOUGLAS_PEUCKER && method != GEOS_SIMPLIFY_VISVALINGAM_WHYATT) {
+                throw IllegalArgumentException("Invalid simplify method");
+            }
+            MultiResolutionSimplifier simp(g1, method == GEOS_SIMPLIFY_VISVALINGAM_WHYATT
+                                           ? MultiResolutionSimplifier::VISVALINGAM_WHYATT
+                                           : MultiResolutionSimplifier::DOUGLAS_PEUCKER);
+            auto levels = simp.getResultGeometries(
+                              std::vector<double>(tolerances, tolerances + ntolerances));
+            for(std::size_t i = 0; i < levels.size(); i++) {
+                levels[i]->setSRID(g1->getSRID());
+                results[i] = levels[i].release();
+            }
+            return 1;
+        });
+    }
+
 
     /* WKT Reader */
     WKTReader*
@@ -2962,6 +3454,44 @@ extern "C" {
         });
     }
 
+    char
+    GEOSPreparedDistanceWithin_r(GEOSContextHandle_t extHandle,
+                                 const geos::geom::prep::PreparedGeometry* pg,
+                                 const Geometry* g, double dist)
+    {
+        return execute(extHandle, 2, [&]() {
+            return pg->isWithinDistance(g, dist);
+        });
+    }
+
+    int
+    GEOSPreparedDistancePoints_r(GEOSContextHandle_t extHandle,
+                                 const geos::geom::prep::PreparedGeometry* pg,
+                                 const double* x, const double* y, unsigned int n,
+                                 double* distances)
+    {
+        return execute(extHandle, 0, [&]() {
+            pg->distance(x, y, n, distances);
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedDistanceWithinPoints_r(GEOSContextHandle_t extHandle,
+                                       const geos::geom::prep::PreparedGeometry* pg,
+                                       const double* x, const double* y, unsigned int n,
+                                       double dist, char* results)
+    {
+        return execute(extHandle, 0, [&]() {
+            std::unique_ptr<bool[]> isWithin(new bool[n]);
+            pg->isWithinDistance(x, y, n, dist, isWithin.get());
+            for(unsigned int i = 0; i < n; i++) {
+                results[i] = isWithin[i] ? 1 : 0;
+            }
+            return 1;
+        });
+    }
+
 //-----------------------------------------------------------------
 // STRtree
 //-----------------------------------------------------------------
@@ -3401,7 +3931,8 @@ extern "C" {
             if(env) {
                 builder.setClipEnvelope(env->getEnvelopeInternal());
             }
-            if(onlyEdges) {
+            builder.setOrdered((onlyEdges & GEOS_VORONOI_PRESERVE_ORDER) != 0);
+            if(onlyEdges & GEOS_VORONOI_ONLY_EDGES) {
                 Geometry* out = builder.getDiagramEdges(*g1->getFactory()).release();
                 out->setSRID(g1->getSRID());
                 return out;
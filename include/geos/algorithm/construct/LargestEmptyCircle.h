@@ -125,6 +125,7 @@ private:
     */
     double distanceToConstraints(const geom::Coordinate& c);
     double distanceToConstraints(double x, double y);
+    void distanceToConstraints(const std::vector<geom::Coordinate>& pts, std::vector<double>& dists);
     void compute();
 
     /* private class */
@@ -28,6 +28,7 @@
 
 #include <memory>
 #include <queue>
+#include <vector>
 
 
 
@@ -108,6 +109,27 @@ public:
     */
     static std::unique_ptr<geom::LineString> getRadiusLine(const geom::Geometry* polygonal, double tolerance);
 
+    /**
+    * Computes the center points and radii of the Maximum Inscribed Circles
+    * of many polygonal geometries, up to a given tolerance distance.
+    *
+    * No geometry is built for the results, which matters when the
+    * circles of a large number of small polygons are computed, as for
+    * label placement.
+    *
+    * The circles are computed over numThreads threads, one polygonal
+    * geometry at a time. 0 uses one thread per core.
+    *
+    * @param polygonals the polygonal geometries
+    * @param tolerance the distance tolerance for computing the center points
+    * @param centers receives the center point of each circle
+    * @param radii receives the radius of each circle
+    * @param numThreads the number of threads
+    */
+    static void getCenters(const std::vector<const geom::Geometry*>& polygonals, double tolerance,
+                           std::vector<geom::Coordinate>& centers, std::vector<double>& radii,
+                           unsigned int numThreads = 1);
+
 private:
 
     /* private members */
@@ -124,6 +146,7 @@ private:
     /* private methods */
     double distanceToBoundary(const geom::Coordinate& c);
     double distanceToBoundary(double x, double y);
+    void distanceToBoundary(const std::vector<geom::Coordinate>& pts, std::vector<double>& dists);
     void compute();
 
     /* private class */
@@ -102,6 +102,11 @@ namespace distance { // geos::algorithm::distance
  *   DFD(A, B)  = 200
  *   DFD(A, B') = 282.842712474619
  * </pre>
+ *
+ * The distance is computed row by row over the coupling of the points,
+ * and whether it is within a given distance by propagating the reachable
+ * couplings only, stopping as soon as none is left.
+ * Both use memory linear in the number of points.
  */
 class GEOS_DLL DiscreteFrechetDistance {
 public:
@@ -112,6 +117,18 @@ public:
     static double distance(const geom::Geometry& g0,
                            const geom::Geometry& g1, double densifyFrac);
 
+    /**
+     * Tests whether the discrete Frechet distance between two
+     * geometries is less than or equal to a given distance.
+     *
+     * @param g0 a geometry
+     * @param g1 a geometry
+     * @param maxDistance the distance to test
+     * @return true if DFD(g0, g1) <= maxDistance
+     */
+    static bool isWithinDistance(const geom::Geometry& g0,
+                                 const geom::Geometry& g1, double maxDistance);
+
     DiscreteFrechetDistance(const geom::Geometry& p_g0,
                             const geom::Geometry& p_g1)
         :
@@ -147,6 +164,17 @@ public:
         return ptDist.getDistance();
     }
 
+    /**
+     * Tests whether the distance is less than or equal to a given
+     * distance, without computing the distance.
+     * The test ends as soon as no coupling of the points within the
+     * distance can be extended, which is fast for dissimilar curves.
+     *
+     * @param maxDistance the distance to test
+     * @return true if the distance is within maxDistance
+     */
+    bool isWithinDistance(double maxDistance);
+
     const std::array<geom::Coordinate, 2>
     getCoordinates() const
     {
@@ -156,8 +184,7 @@ public:
 private:
     geom::Coordinate getSegementAt(const geom::CoordinateSequence& seq, size_t index);
 
-    PointPairDistance& getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, size_t i, size_t j,
-                                         const geom::CoordinateSequence& p, const geom::CoordinateSequence& q);
+    std::vector<geom::Coordinate> getPoints(const geom::Geometry& geom);
 
     void compute(const geom::Geometry& discreteGeom, const geom::Geometry& geom);
 
@@ -0,0 +1,136 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/algorithm/distance/PointPairDistance.h> // for composition
+#include <geos/geom/Coordinate.h> // for composition
+
+#include <array>
+
+namespace geos {
+namespace geom {
+class Geometry;
+}
+namespace operation {
+namespace distance {
+class FacetSequence;
+class IndexedFacetDistance;
+}
+}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace distance { // geos::algorithm::distance
+
+/** \brief
+ * Computes the Hausdorff distance between the facets of two geometries,
+ * measured along the whole length of their segments rather than at
+ * their vertices only.
+ *
+ * The facets are the segments and points of the components, so for
+ * polygonal inputs the distance is the one between the boundaries,
+ * as with {@link DiscreteHausdorffDistance}.
+ *
+ * Distances to the other geometry are found with an
+ * {@link operation::distance::IndexedFacetDistance}, which makes the
+ * vertex distances, equal to the discrete Hausdorff distance, cost
+ * O(n log n) instead of O(n^2).
+ * The segments of each geometry are then searched by branch-and-bound:
+ * a segment is split while the distance along it may exceed the largest
+ * distance found by more than the tolerance. The distance along a
+ * segment is bounded by the distance of its endpoints to the facets
+ * nearest to them, which prunes at once the segments running along
+ * the other geometry.
+ *
+ * The result is within the tolerance of the exact Hausdorff distance,
+ * and never smaller than the discrete one:
+ * <pre>
+ *    DHD(a, b) <= IHD(a, b) <= HD(a, b) <= IHD(a, b) + tolerance
+ * </pre>
+ * By default, the tolerance is a billionth of the diagonal of the
+ * envelope of the inputs.
+ * The distance is 0 if either input is empty.
+ */
+class GEOS_DLL IndexedHausdorffDistance {
+public:
+
+    static double distance(const geom::Geometry& g0,
+                           const geom::Geometry& g1);
+
+    static double distance(const geom::Geometry& g0,
+                           const geom::Geometry& g1, double tolerance);
+
+    IndexedHausdorffDistance(const geom::Geometry& p_g0,
+                             const geom::Geometry& p_g1)
+        :
+        g0(p_g0),
+        g1(p_g1),
+        ptDist(),
+        tolerance(0.0)
+    {}
+
+    /**
+     * Sets the largest amount by which the computed distance may
+     * be less than the exact Hausdorff distance.
+     * A value of 0 selects the default tolerance.
+     *
+     * @param p_tolerance the distance tolerance
+     */
+    void setTolerance(double p_tolerance);
+
+    double distance();
+
+    /**
+     * Computes the largest distance from a point of the first geometry
+     * to the second geometry.
+     *
+     * @return the oriented Hausdorff distance
+     */
+    double orientedDistance();
+
+    /**
+     * Gets the point of one geometry and the nearest point of the other
+     * which are separated by the computed distance.
+     */
+    const std::array<geom::Coordinate, 2>
+    getCoordinates() const
+    {
+        return ptDist.getCoordinates();
+    }
+
+private:
+
+    void computeOrientedDistance(const geom::Geometry& g,
+                                 const operation::distance::IndexedFacetDistance& other,
+                                 double tol);
+
+    double computeTolerance() const;
+
+    const geom::Geometry& g0;
+
+    const geom::Geometry& g1;
+
+    PointPairDistance ptDist;
+
+    double tolerance;
+
+    // Declare type as noncopyable
+    IndexedHausdorffDistance(const IndexedHausdorffDistance& other) = delete;
+    IndexedHausdorffDistance& operator=(const IndexedHausdorffDistance& rhs) = delete;
+};
+
+} // geos::algorithm::distance
+} // geos::algorithm
+} // geos
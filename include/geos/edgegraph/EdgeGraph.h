@@ -16,11 +16,11 @@
 #pragma once
 
 #include <geos/edgegraph/HalfEdge.h>
+#include <geos/geom/CoordinateHashMap.h>
 
 #include <geos/export.h>
 #include <string>
 #include <cassert>
-#include <map>
 #include <array>
 #include <memory>
 #include <vector>
@@ -60,7 +60,7 @@ class GEOS_DLL EdgeGraph {
 private:
 
     std::deque<HalfEdge> edges;
-    std::map<geom::Coordinate, HalfEdge*> vertexMap;
+    geom::CoordinateHashMap<HalfEdge*> vertexMap;
 
     HalfEdge* create(const geom::Coordinate& p0, const geom::Coordinate& p1);
 
@@ -117,6 +117,11 @@ public:
     */
     static bool isValidEdge(const geom::Coordinate& orig, const geom::Coordinate& dest);
 
+    /**
+    * Gets an edge out of each vertex, in vertex coordinate order.
+    *
+    * @param edgesOut the edges are push_back'ed here
+    */
     void getVertexEdges(std::vector<const HalfEdge*>& edgesOut);
 
     /**
@@ -0,0 +1,305 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_COORDINATEHASHMAP_H
+#define GEOS_GEOM_COORDINATEHASHMAP_H
+
+#include <geos/geom/Coordinate.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos::geom
+
+/**
+ * \brief
+ * A hash map from Coordinate to values, using open addressing.
+ *
+ * Keys are compared in 2D, as with Coordinate::equals2D. The entries are
+ * stored contiguously in insertion order, and a table of entry indexes
+ * probed linearly finds them, so a lookup touches little memory and
+ * allocates nothing.
+ *
+ * Iteration follows the insertion order, which does not depend on the
+ * hashing, so results built from it are deterministic. Erasing an entry
+ * moves the last one into its place.
+ *
+ * This is meant as the vertex index of graphs, where std::map lookups
+ * were a bottleneck.
+ */
+template<typename T>
+class CoordinateHashMap {
+
+public:
+
+    typedef std::pair<Coordinate, T> value_type;
+    typedef typename std::vector<value_type>::iterator iterator;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+    CoordinateHashMap()
+        : mask(0)
+    {}
+
+    std::size_t
+    size() const
+    {
+        return entries.size();
+    }
+
+    bool
+    empty() const
+    {
+        return entries.empty();
+    }
+
+    void
+    clear()
+    {
+        entries.clear();
+        slots.clear();
+        mask = 0;
+    }
+
+    /// Makes room for n entries without rehashing
+    void
+    reserve(std::size_t n)
+    {
+        entries.reserve(n);
+        std::size_t tableSize = MIN_TABLE_SIZE;
+        while(tableSize < 2 * n) {
+            tableSize *= 2;
+        }
+        if(tableSize > slots.size()) {
+            rehash(tableSize);
+        }
+    }
+
+    iterator
+    begin()
+    {
+        return entries.begin();
+    }
+
+    iterator
+    end()
+    {
+        return entries.end();
+    }
+
+    const_iterator
+    begin() const
+    {
+        return entries.begin();
+    }
+
+    const_iterator
+    end() const
+    {
+        return entries.end();
+    }
+
+    /**
+     * Returns the value at a location, or null if there is none.
+     *
+     * The pointer is invalidated by any later insert, which may
+     * reallocate the entries, and by any later erase, which may move
+     * the last entry into the place of the erased one.
+     */
+    T*
+    find(const Coordinate& pt)
+    {
+        if(slots.empty()) {
+            return nullptr;
+        }
+        std::size_t entry = slots[findSlot(pt)];
+        return entry == EMPTY ? nullptr : &entries[entry].second;
+    }
+
+    const T*
+    find(const Coordinate& pt) const
+    {
+        return const_cast<CoordinateHashMap*>(this)->find(pt);
+    }
+
+    /**
+     * Adds a value at a location, unless there is one already.
+     *
+     * Adding an entry may reallocate the entries, so it invalidates the
+     * pointers and references to values and the iterators obtained before.
+     *
+     * @return the value at the location, and whether it was added; the
+     * pointer is invalidated by any later insert or erase
+     */
+    std::pair<T*, bool>
+    insert(const Coordinate& pt, const T& value)
+    {
+        // keep the table at most half full
+        if(2 * (entries.size() + 1) > slots.size()) {
+            rehash(slots.empty() ? MIN_TABLE_SIZE : 2 * slots.size());
+        }
+        std::size_t slot = findSlot(pt);
+        if(slots[slot] != EMPTY) {
+            return std::make_pair(&entries[slots[slot]].second, false);
+        }
+        slots[slot] = entries.size();
+        entries.emplace_back(pt, value);
+        return std::make_pair(&entries.back().second, true);
+    }
+
+    /**
+     * Returns the value at a location, adding a default one if there
+     * is none.
+     *
+     * The reference is invalidated by any later insert, which may
+     * reallocate the entries, and by any later erase, which may move
+     * the last entry into the place of the erased one.
+     */
+    T&
+    operator[](const Coordinate& pt)
+    {
+        return *insert(pt, T()).first;
+    }
+
+    /**
+     * Removes the value at a location.
+     *
+     * The last entry is moved into the place of the removed one, so
+     * this invalidates the pointers and references to values and the
+     * iterators obtained before.
+     *
+     * @return whether there was one
+     */
+    bool
+    erase(const Coordinate& pt)
+    {
+        if(slots.empty()) {
+            return false;
+        }
+        std::size_t slot = findSlot(pt);
+        std::size_t entry = slots[slot];
+        if(entry == EMPTY) {
+            return false;
+        }
+        removeSlot(slot);
+
+        std::size_t last = entries.size() - 1;
+        if(entry != last) {
+            std::size_t lastSlot = hash(entries[last].first) & mask;
+            while(slots[lastSlot] != last) {
+                lastSlot = (lastSlot + 1) & mask;
+            }
+            slots[lastSlot] = entry;
+            entries[entry] = std::move(entries[last]);
+        }
+        entries.pop_back();
+        return true;
+    }
+
+private:
+
+    static constexpr std::size_t EMPTY = std::numeric_limits<std::size_t>::max();
+
+    static constexpr std::size_t MIN_TABLE_SIZE = 16;
+
+    std::vector<value_type> entries;
+
+    // indexes into entries, or EMPTY; the size is a power of two
+    std::vector<std::size_t> slots;
+
+    std::size_t mask;
+
+    static std::uint64_t
+    bits(double d)
+    {
+        // -0.0 equals 0.0, so it must hash alike
+        if(d == 0.0) {
+            d = 0.0;
+        }
+        std::uint64_t b;
+        std::memcpy(&b, &d, sizeof(b));
+        return b;
+    }
+
+    static std::size_t
+    hash(const Coordinate& pt)
+    {
+        std::uint64_t h = bits(pt.x) * 0x9e3779b97f4a7c15ULL ^ bits(pt.y);
+        // finalizer of MurmurHash3, so that the low bits depend on all others
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+    std::size_t
+    findSlot(const Coordinate& pt) const
+    {
+        std::size_t slot = hash(pt) & mask;
+        while(slots[slot] != EMPTY && !entries[slots[slot]].first.equals2D(pt)) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void
+    rehash(std::size_t tableSize)
+    {
+        slots.assign(tableSize, EMPTY);
+        mask = tableSize - 1;
+        for(std::size_t i = 0; i < entries.size(); i++) {
+            std::size_t slot = hash(entries[i].first) & mask;
+            while(slots[slot] != EMPTY) {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = i;
+        }
+    }
+
+    // Empties a slot, shifting back the entries probed past it
+    void
+    removeSlot(std::size_t slot)
+    {
+        std::size_t next = slot;
+        for(;;) {
+            next = (next + 1) & mask;
+            if(slots[next] == EMPTY) {
+                break;
+            }
+            // an entry stays if its home slot is cyclically in (slot, next]
+            std::size_t home = hash(entries[slots[next]].first) & mask;
+            bool stays = slot <= next ? (slot < home && home <= next)
+                         : (slot < home || home <= next);
+            if(!stays) {
+                slots[slot] = slots[next];
+                slot = next;
+            }
+        }
+        slots[slot] = EMPTY;
+    }
+};
+
+template<typename T>
+constexpr std::size_t CoordinateHashMap<T>::EMPTY;
+
+template<typename T>
+constexpr std::size_t CoordinateHashMap<T>::MIN_TABLE_SIZE;
+
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_COORDINATEHASHMAP_H
@@ -181,6 +181,23 @@ public:
      */
     double distance(const geom::Geometry* g) const override;
 
+    /**
+     * Default implementation.
+     */
+    bool isWithinDistance(const geom::Geometry* g, double dist) const override;
+
+    /**
+     * Default implementation.
+     */
+    void distance(const double* x, const double* y, std::size_t n,
+                  double* distances) const override;
+
+    /**
+     * Default implementation.
+     */
+    void isWithinDistance(const double* x, const double* y, std::size_t n,
+                          double maxDistance, bool* results) const override;
+
     std::string toString();
 
 };
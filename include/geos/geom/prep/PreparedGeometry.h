@@ -19,6 +19,7 @@
 #ifndef GEOS_GEOM_PREP_PREPAREDGEOMETRY_H
 #define GEOS_GEOM_PREP_PREPAREDGEOMETRY_H
 
+#include <cstddef>
 #include <vector>
 #include <memory>
 #include <geos/export.h>
@@ -216,6 +217,49 @@ public:
      *
      */
     virtual double distance(const geom::Geometry* geom) const = 0;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} is within a given
+     * distance of the given geometry.
+     *
+     * The test stops as soon as the answer is known, which is
+     * cheaper than comparing the result of distance().
+     * The result is false if either geometry is empty.
+     *
+     * @param geom the Geometry to test
+     * @param dist the distance to test
+     * @return true if the geometries are within the distance
+     */
+    virtual bool isWithinDistance(const geom::Geometry* geom, double dist) const = 0;
+
+    /** \brief
+     * Compute the minimum distance between the base {@link Geometry} and
+     * each of a set of points.
+     *
+     * The points are given as raw coordinate arrays, so that no
+     * geometry is created for them.
+     * The distance is infinite if the base geometry is empty.
+     *
+     * @param x the X ordinates of the points
+     * @param y the Y ordinates of the points
+     * @param n the number of points
+     * @param distances receives the distance of each point
+     */
+    virtual void distance(const double* x, const double* y, std::size_t n,
+                          double* distances) const = 0;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} is within a given
+     * distance of each of a set of points.
+     *
+     * @param x the X ordinates of the points
+     * @param y the Y ordinates of the points
+     * @param n the number of points
+     * @param maxDistance the distance to test
+     * @param results receives true for each point within the distance
+     */
+    virtual void isWithinDistance(const double* x, const double* y, std::size_t n,
+                                  double maxDistance, bool* results) const = 0;
 };
 
 
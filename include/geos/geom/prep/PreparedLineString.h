@@ -60,6 +60,11 @@ public:
     bool intersects(const geom::Geometry* g) const override;
     std::unique_ptr<geom::CoordinateSequence> nearestPoints(const geom::Geometry* g) const override;
     double distance(const geom::Geometry* g) const override;
+    bool isWithinDistance(const geom::Geometry* g, double dist) const override;
+    void distance(const double* x, const double* y, std::size_t n,
+                  double* distances) const override;
+    void isWithinDistance(const double* x, const double* y, std::size_t n,
+                          double maxDistance, bool* results) const override;
     operation::distance::IndexedFacetDistance* getIndexedFacetDistance() const;
 
 };
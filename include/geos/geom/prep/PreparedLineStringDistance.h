@@ -20,6 +20,8 @@
 #ifndef GEOS_GEOM_PREP_PREPAREDLINESTRINGDISTANCE_H
 #define GEOS_GEOM_PREP_PREPAREDLINESTRINGDISTANCE_H
 
+#include <cstddef>
+
 namespace geos {
 namespace geom { // geos::geom
 namespace prep { // geos::geom::prep
@@ -41,6 +43,13 @@ public:
 
     double distance(const geom::Geometry* g) const;
 
+    bool isWithinDistance(const geom::Geometry* g, double maxDistance) const;
+
+    void distance(const double* x, const double* y, std::size_t n, double* distances) const;
+
+    void isWithinDistance(const double* x, const double* y, std::size_t n,
+                          double maxDistance, bool* results) const;
+
 protected:
 
     const PreparedLineString& prepLine;
@@ -71,6 +71,11 @@ public:
     bool covers(const geom::Geometry* g) const override;
     bool intersects(const geom::Geometry* g) const override;
     double distance(const geom::Geometry* g) const override;
+    bool isWithinDistance(const geom::Geometry* g, double dist) const override;
+    void distance(const double* x, const double* y, std::size_t n,
+                  double* distances) const override;
+    void isWithinDistance(const double* x, const double* y, std::size_t n,
+                          double maxDistance, bool* results) const override;
 
 };
 
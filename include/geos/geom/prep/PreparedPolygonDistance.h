@@ -30,6 +30,8 @@ namespace geos {
     }
 }
 
+#include <cstddef>
+
 namespace geos {
 namespace geom { // geos::geom
 namespace prep { // geos::geom::prep
@@ -51,6 +53,13 @@ public:
 
     double distance(const geom::Geometry* g) const;
 
+    bool isWithinDistance(const geom::Geometry* g, double maxDistance) const;
+
+    void distance(const double* x, const double* y, std::size_t n, double* distances) const;
+
+    void isWithinDistance(const double* x, const double* y, std::size_t n,
+                          double maxDistance, bool* results) const;
+
 protected:
 
     const PreparedPolygon& prepPoly;
@@ -27,6 +27,7 @@
 #include <string>
 
 #include <geos/geom/Coordinate.h> // for CoordinateLessThen
+#include <geos/geom/CoordinateHashMap.h>
 #include <geos/geomgraph/Node.h> // for testInvariant
 
 #include <geos/inline.h>
@@ -125,6 +126,9 @@ public:
 
 private:
 
+    // finds the nodes by coordinate, as nodeMap iterates them in order
+    geom::CoordinateHashMap<Node*> nodeIndex;
+
     // Declare type as noncopyable
     NodeMap(const NodeMap& other) = delete;
     NodeMap& operator=(const NodeMap& rhs) = delete;
@@ -130,6 +130,9 @@ public:
     std::pair<const void*, const void*> nearestNeighbour();
     bool isWithinDistance(double maxDistance);
 
+    /* Nearest pair of items closer than maxDistance, or a pair of nulls if none is */
+    std::pair<const void*, const void*> nearestNeighbour(double maxDistance);
+
 
 private:
 
@@ -142,12 +145,15 @@ private:
 
     std::pair<const void*, const void*> nearestNeighbour(SimpleSTRpair* p_initPair);
     std::pair<const void*, const void*> nearestNeighbour(SimpleSTRpair* p_initPair, double maxDistance);
+    SimpleSTRpair* nearestPair(SimpleSTRpair* p_initPair, double maxDistance);
 
     bool isWithinDistance(SimpleSTRpair* p_initPair, double maxDistance);
 
     void expandToQueue(SimpleSTRpair* pair, STRpairQueue&, double minDistance);
     void expand(SimpleSTRnode* nodeComposite, SimpleSTRnode* nodeOther,
         bool isFlipped, STRpairQueue& priQ, double minDistance);
+    void addToQueue(SimpleSTRnode* p_node1, SimpleSTRnode* p_node2,
+        STRpairQueue& priQ, double minDistance);
 
 
 };
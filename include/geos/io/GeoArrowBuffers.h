@@ -0,0 +1,131 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Geometry.h> // for GeometryTypeId
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geos {
+namespace io { // geos::io
+
+/**
+ * \brief A non-owning view of geometries stored in GeoArrow-style
+ *        columnar buffers.
+ *
+ * All geometries in a column share a single type. Coordinates are held
+ * in one or more double buffers, and the nesting of the geometry is
+ * described by up to three levels of offset arrays:
+ *
+ * | type            | geomOffsets     | partOffsets   | ringOffsets   |
+ * |-----------------|-----------------|---------------|---------------|
+ * | Point           | -               | -             | -             |
+ * | LineString      | into coords     | -             | -             |
+ * | Polygon         | into rings      | -             | into coords   |
+ * | MultiPoint      | into coords     | -             | -             |
+ * | MultiLineString | into parts      | into coords   | -             |
+ * | MultiPolygon    | into parts      | into rings    | into coords   |
+ *
+ * Every offset array holds one more entry than the number of
+ * items it describes, so that item `i` spans `[offsets[i], offsets[i+1])`.
+ *
+ * Coordinate ordinates are addressed as `x[i * stride]`, `y[i * stride]`
+ * and `z[i * stride]`. Interleaved buffers (`x0 y0 x1 y1 ...`) are
+ * described with `y = x + 1` and `stride = 2` (or `z = x + 2` and
+ * `stride = 3`), separated buffers with `stride = 1`.
+ *
+ * An empty Point is represented by NaN ordinates.
+ */
+struct GEOS_DLL GeoArrowBuffers {
+
+    GeoArrowBuffers()
+        : type(geom::GEOS_POINT)
+        , hasZ(false)
+        , x(nullptr)
+        , y(nullptr)
+        , z(nullptr)
+        , stride(2)
+        , numCoords(0)
+        , geomOffsets(nullptr)
+        , partOffsets(nullptr)
+        , ringOffsets(nullptr)
+        , numGeoms(0)
+    {}
+
+    /// Type shared by all geometries of the column
+    geom::GeometryTypeId type;
+
+    /// Whether `z` holds a third ordinate
+    bool hasZ;
+
+    const double* x;
+    const double* y;
+    const double* z;
+
+    /// Distance, in doubles, between two consecutive values of an ordinate
+    std::size_t stride;
+
+    /// Number of coordinates addressable through x, y (and z)
+    std::size_t numCoords;
+
+    const int32_t* geomOffsets;
+    const int32_t* partOffsets;
+    const int32_t* ringOffsets;
+
+    /// Number of geometries in the column
+    std::size_t numGeoms;
+};
+
+/**
+ * \brief Geometries encoded into owned GeoArrow-style columnar buffers.
+ *
+ * Produced by GeoArrowWriter. When interleaved, `coords` holds
+ * `x0 y0 [z0] x1 y1 [z1] ...`; otherwise it holds all x values,
+ * followed by all y values (and then all z values).
+ */
+struct GEOS_DLL GeoArrowArray {
+
+    GeoArrowArray()
+        : type(geom::GEOS_POINT)
+        , hasZ(false)
+        , interleaved(true)
+        , numGeoms(0)
+    {}
+
+    geom::GeometryTypeId type;
+    bool hasZ;
+    bool interleaved;
+    std::size_t numGeoms;
+
+    std::vector<double> coords;
+    std::vector<int32_t> geomOffsets;
+    std::vector<int32_t> partOffsets;
+    std::vector<int32_t> ringOffsets;
+
+    /// Number of coordinates stored in the array
+    std::size_t
+    getNumCoordinates() const
+    {
+        return coords.size() / (hasZ ? 3 : 2);
+    }
+
+    /// Returns a view of the array, valid as long as the array is not modified
+    GeoArrowBuffers buffers() const;
+};
+
+} // namespace geos::io
+} // namespace geos
+
@@ -0,0 +1,98 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoArrowBuffers.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class GeometryFactory;
+class LinearRing;
+class LineString;
+class Point;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io { // geos::io
+
+/**
+ * \class GeoArrowReader
+ *
+ * \brief Builds Geometry objects directly from GeoArrow-style columnar
+ *        coordinate and offset buffers.
+ *
+ * This avoids the round trip through WKB when geometries are already
+ * held in columnar form. Offsets are validated once per column, after
+ * which coordinates are copied straight into the coordinate sequences
+ * of the created geometries.
+ *
+ * Ordinates are passed through the PrecisionModel of the factory.
+ *
+ * @see GeoArrowBuffers for the description of the buffer layout.
+ */
+class GEOS_DLL GeoArrowReader {
+
+public:
+
+    GeoArrowReader(const geom::GeometryFactory& f);
+
+    /// Initialize reader with default GeometryFactory.
+    GeoArrowReader();
+
+    /**
+     * \brief Reads all geometries of a column.
+     *
+     * @param buffers the column to read
+     * @return one geometry per entry of the column
+     * @throws ParseException if the buffers are inconsistent
+     */
+    std::vector<std::unique_ptr<geom::Geometry>> read(const GeoArrowBuffers& buffers) const;
+
+private:
+
+    const geom::GeometryFactory& factory;
+
+    std::unique_ptr<geom::Geometry> readGeometry(const GeoArrowBuffers& b, std::size_t i) const;
+
+    std::unique_ptr<geom::Point> readPoint(const GeoArrowBuffers& b, std::size_t coordIndex) const;
+
+    std::unique_ptr<geom::LineString> readLineString(const GeoArrowBuffers& b,
+            const int32_t* offsets, std::size_t i) const;
+
+    std::unique_ptr<geom::LinearRing> readLinearRing(const GeoArrowBuffers& b,
+            const int32_t* offsets, std::size_t i) const;
+
+    std::unique_ptr<geom::Polygon> readPolygon(const GeoArrowBuffers& b,
+            const int32_t* polyOffsets, std::size_t i) const;
+
+    std::unique_ptr<geom::CoordinateSequence> readCoordinates(const GeoArrowBuffers& b,
+            std::size_t start, std::size_t end) const;
+
+    // Declare type as noncopyable
+    GeoArrowReader(const GeoArrowReader& other) = delete;
+    GeoArrowReader& operator=(const GeoArrowReader& rhs) = delete;
+};
+
+} // namespace geos::io
+} // namespace geos
+
@@ -0,0 +1,116 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoArrowBuffers.h>
+
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class LineString;
+class Point;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io { // geos::io
+
+/**
+ * \class GeoArrowWriter
+ *
+ * \brief Writes a collection of geometries into GeoArrow-style
+ *        columnar buffers.
+ *
+ * All geometries must belong to the same family (points, lines or
+ * polygons). If a column mixes single and multi geometries of a family,
+ * the single geometries are written as one-part multi geometries.
+ * Null geometries are written as empty geometries.
+ *
+ * @see GeoArrowBuffers for the description of the buffer layout.
+ */
+class GEOS_DLL GeoArrowWriter {
+
+public:
+
+    /**
+     * @param dims output dimension (2 or 3)
+     * @param interleaved whether coordinates are written interleaved
+     *        (`x0 y0 x1 y1 ...`) or as separate ordinate planes
+     */
+    GeoArrowWriter(int dims = 2, bool interleaved = true);
+
+    /// Returns the output dimension used by the writer.
+    int
+    getOutputDimension() const
+    {
+        return outputDimension;
+    }
+
+    /**
+     * Sets the output dimension used by the writer.
+     *
+     * @param newOutputDimension Supported values are 2 or 3.
+     *        Note that 3 indicates up to 3 dimensions will be
+     *        written but 2D geometries will still be encoded as
+     *        such, with a NaN z ordinate.
+     */
+    void setOutputDimension(int newOutputDimension);
+
+    bool
+    isInterleaved() const
+    {
+        return interleaved;
+    }
+
+    void
+    setInterleaved(bool newInterleaved)
+    {
+        interleaved = newInterleaved;
+    }
+
+    /**
+     * \brief Writes the given geometries into columnar buffers.
+     *
+     * @param geoms the geometries to write, nullptr entries are allowed
+     * @throws util::IllegalArgumentException if the geometries
+     *         cannot share a single column type
+     */
+    GeoArrowArray write(const std::vector<const geom::Geometry*>& geoms) const;
+
+private:
+
+    int outputDimension;
+    bool interleaved;
+
+    static geom::GeometryTypeId columnType(const std::vector<const geom::Geometry*>& geoms);
+
+    void writePoint(const geom::Point* p, GeoArrowArray& out) const;
+
+    void writeLineString(const geom::LineString* ls, std::vector<int32_t>& offsets,
+                         GeoArrowArray& out) const;
+
+    void writePolygon(const geom::Polygon* poly, std::vector<int32_t>& offsets,
+                      GeoArrowArray& out) const;
+
+    void writeCoordinates(const geom::CoordinateSequence& cs, GeoArrowArray& out) const;
+};
+
+} // namespace geos::io
+} // namespace geos
+
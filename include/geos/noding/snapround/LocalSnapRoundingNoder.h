@@ -0,0 +1,111 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/geom/Envelope.h>
+#include <geos/noding/Noder.h>
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class PrecisionModel;
+}
+namespace noding {
+class NodedSegmentString;
+}
+}
+
+namespace geos {
+namespace noding { // geos::noding
+namespace snapround { // geos::noding::snapround
+
+/**
+ * \brief
+ * Nodes in floating precision, and snap-rounds only the regions
+ * where floating noding fails.
+ *
+ * The input is first noded with a {@link noding::MCIndexNoder}.
+ * The noded edges are then checked as a
+ * {@link noding::FastNodingValidator} would, collecting the envelope of
+ * every pair of segments which are not correctly noded.
+ * Only the segments near those pairs are then snap-rounded with a
+ * {@link SnapRoundingNoder}, so the other coordinates keep their full
+ * precision.
+ *
+ * The vertices shared by the snap-rounded segments and the others are
+ * rounded in both, so that the edges still meet there. As rounding may
+ * in turn make segments cross outside the regions, the result is checked
+ * again, and the regions are grown around the new failures up to
+ * MAX_TRIES times. If the noding is still not valid then,
+ * a {@link util::TopologyException} is thrown.
+ *
+ * The noded edges keep the data of the input segment strings.
+ */
+class GEOS_DLL LocalSnapRoundingNoder : public Noder {
+
+public:
+
+    /// Number of times the snap-rounded regions are grown
+    static constexpr int MAX_TRIES = 4;
+
+    /**
+     * Creates a noder snap-rounding to the grid of a precision model.
+     *
+     * @param pm the precision model of the snap-rounded regions
+     */
+    LocalSnapRoundingNoder(const geom::PrecisionModel* pm);
+
+    ~LocalSnapRoundingNoder() override;
+
+    void computeNodes(std::vector<SegmentString*>* inputSegStrings) override;
+
+    /**
+     * @return newly allocated noded edges; the caller takes ownership
+     */
+    std::vector<SegmentString*>* getNodedSubstrings() const override;
+
+    /**
+     * Gets the number of input segments which were snap-rounded
+     * by the last call to computeNodes.
+     */
+    std::size_t
+    getNumSnapRounded() const
+    {
+        return numSnapRounded;
+    }
+
+private:
+
+    const geom::PrecisionModel* pm;
+
+    std::vector<std::unique_ptr<NodedSegmentString>> nodedEdges;
+
+    std::size_t numSnapRounded;
+
+    std::vector<std::unique_ptr<NodedSegmentString>> snapRoundRegions(
+        const std::vector<std::unique_ptr<NodedSegmentString>>& edges,
+        const std::vector<geom::Envelope>& regions);
+
+    // Declare type as noncopyable
+    LocalSnapRoundingNoder(const LocalSnapRoundingNoder& other) = delete;
+    LocalSnapRoundingNoder& operator=(const LocalSnapRoundingNoder& rhs) = delete;
+};
+
+} // namespace geos::noding::snapround
+} // namespace geos::noding
+} // namespace geos
@@ -95,6 +95,12 @@ public:
      * Test whether two geometries lie within a given distance of
      * each other.
      *
+     * Geometries whose envelopes are farther apart than the distance
+     * are rejected at once. Large geometries are tested by searching
+     * the facets of one against an index of the facets of the other,
+     * stopping at the first pair within the distance, and then for
+     * one containing a component of the other.
+     *
      * @param g0 a {@link geom::Geometry}
      * @param g1 another {@link geom::Geometry}
      * @param distance the distance to test
@@ -181,6 +187,8 @@ private:
 
     void computeMinDistance();
 
+    static bool isContainedIn(const geom::Geometry& g, const geom::Geometry& polygonal);
+
     void computeContainmentDistance();
 
     void computeInside(std::vector<std::unique_ptr<GeometryLocation>> & locs,
@@ -39,7 +39,6 @@ private:
     static void addFacetSequences(const geom::Geometry* geom,
                                   const geom::CoordinateSequence* pts,
                                   std::vector<FacetSequence> & sections);
-    static std::vector<FacetSequence> computeFacetSequences(const geom::Geometry* g);
 
     class FacetSequenceTree : public geos::index::strtree::STRtree {
     public:
@@ -54,6 +53,12 @@ private:
     };
 
 public:
+    /** \brief
+     * Return the FacetSequences of the linear and point components of
+     * the supplied Geometry.
+     */
+    static std::vector<FacetSequence> computeFacetSequences(const geom::Geometry* g);
+
     /** \brief
      * Return a tree of FacetSequences constructed from the supplied Geometry.
      *
@@ -58,9 +58,7 @@ public:
     /// distance to the polygon boundaries.
     ///
     /// \param g a Geometry, which may be of any type.
-    IndexedFacetDistance(const geom::Geometry* g) :
-        cachedTree(FacetSequenceTreeBuilder::build(g))
-    {}
+    IndexedFacetDistance(const geom::Geometry* g);
 
     /// \brief Computes the distance between facets of two geometries.
     ///
@@ -86,6 +84,77 @@ public:
     /// \return the computed distance
     double distance(const geom::Geometry* g) const;
 
+    /// \brief Computes the distance from the base geometry to a point.
+    ///
+    /// This is faster than the distance to a Point geometry, since no
+    /// index is built for the query.
+    ///
+    /// \param pt the point to compute the distance to
+    ///
+    /// \return the computed distance
+    double distance(const geom::Coordinate& pt) const;
+
+    /// \brief Tests whether the facets of the base geometry are within
+    /// a given distance of the facets of a geometry.
+    ///
+    /// The search stops as soon as a pair of facets within the distance
+    /// is found, or as soon as the envelope distance of the remaining
+    /// candidates exceeds the distance.
+    /// As with distance(const geom::Geometry*), polygons are not
+    /// tested for containment.
+    ///
+    /// \param g the geometry to test
+    /// \param maxDistance the distance to test
+    ///
+    /// \return true if the facet distance is at most maxDistance
+    bool isWithinDistance(const geom::Geometry* g, double maxDistance) const;
+
+    /// \brief Tests whether the base geometry is within a given distance
+    /// of a point.
+    ///
+    /// Only the facets in the envelope of the distance around the point
+    /// are visited, which is faster than computing the distance when
+    /// the distance is small.
+    ///
+    /// \param pt the point to test
+    /// \param maxDistance the distance to test
+    ///
+    /// \return true if the distance to the point is at most maxDistance
+    bool isWithinDistance(const geom::Coordinate& pt, double maxDistance) const;
+
+    /// \brief Finds the facet sequence of the base geometry nearest to a point.
+    ///
+    /// The facet sequence is owned by this object.
+    ///
+    /// \param pt the point to find the nearest facets of
+    ///
+    /// \return the nearest facet sequence
+    const FacetSequence* nearestFacet(const geom::Coordinate& pt) const;
+
+    /// \brief Computes the distances from the base geometry to a batch
+    /// of points.
+    ///
+    /// The facets near the batch are found with a single index query,
+    /// which is faster than separate queries for points lying close
+    /// together, such as the cells of a grid refinement.
+    ///
+    /// \param pts the points to compute the distance to
+    /// \param distances receives the distance of each point
+    void distance(const std::vector<geom::Coordinate>& pts, std::vector<double>& distances) const;
+
+    /// \brief Computes the distances from the base geometry to an array
+    /// of points.
+    ///
+    /// Runs of consecutive points lying close together, such as
+    /// positions along a track, are queried as a batch.
+    /// Other points are queried one by one.
+    ///
+    /// \param x the X ordinates of the points
+    /// \param y the Y ordinates of the points
+    /// \param n the number of points
+    /// \param distances receives the distance of each point
+    void distance(const double* x, const double* y, std::size_t n, double* distances) const;
+
     /// \brief Computes the nearest locations on the base geometry and the given geometry.
     ///
     /// \param g the geometry to compute the nearest location to
@@ -99,8 +168,17 @@ public:
     std::vector<geom::Coordinate> nearestPoints(const geom::Geometry* g) const;
 
 private:
+    // facets per point above which a batch is queried point by point
+    static constexpr std::size_t MAX_BATCH_SCAN_FACETS = 256;
+
+    // largest number of consecutive points of an array queried as a batch
+    static constexpr std::size_t MAX_ARRAY_BATCH_SIZE = 32;
+
     std::unique_ptr<geos::index::strtree::STRtree> cachedTree;
 
+    // largest distance between the points of an array batch
+    double batchSpread;
+
 };
 }
 }
@@ -20,8 +20,9 @@
 #define GEOS_OP_LINEMERGE_LINEMERGER_H
 
 #include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateHashMap.h>
 #include <geos/geom/LineString.h>
-#include <geos/operation/linemerge/LineMergeGraph.h> // for composition
 
 #include <memory>
 #include <vector>
@@ -37,15 +38,6 @@ namespace geom {
 class GeometryFactory;
 class Geometry;
 }
-namespace planargraph {
-class Node;
-}
-namespace operation {
-namespace linemerge {
-class EdgeString;
-class LineMergeDirectedEdge;
-}
-}
 }
 
 
@@ -64,6 +56,9 @@ namespace linemerge { // geos::operation::linemerge
  * The direction of each merged LineString will be that of the majority
  * of the LineStrings from which it was derived.
  *
+ * If the merger is directed, lines are only sewn together when they
+ * have the same direction, and the merged LineStrings keep it.
+ *
  * Any dimension of Geometry is handled.
  * The constituent linework is extracted to form the edges.
  * The edges must be correctly noded; that is, they must only meet
@@ -72,19 +67,55 @@ namespace linemerge { // geos::operation::linemerge
  * The LineMerger will still run on incorrectly noded input
  * but will not form polygons from incorrected noded edges.
  *
+ * The input lines are not copied. They are kept in a flat graph whose
+ * nodes are found by hashing their coordinate, so memory stays linear
+ * in the number of lines. The merged LineStrings come out in the same
+ * order as from the planar graph the merger used before: by start node
+ * coordinate, then by the angle of the first edge.
+ *
  */
 class GEOS_DLL LineMerger {
 
 private:
 
-    LineMergeGraph graph;
+    struct MergeNode {
+        geom::Coordinate pt;
+        // out edges are outEdges[outStart, outStart + degree)
+        std::size_t outStart;
+        std::size_t degree;
+        bool isMarked;
+    };
 
-    std::vector<std::unique_ptr<geom::LineString>> mergedLineStrings;
+    struct MergeEdge {
+        const geom::LineString* line;
+        std::size_t fromNode;
+        std::size_t toNode;
+        // the second distinct point from each end
+        geom::Coordinate fromDirPt;
+        geom::Coordinate toDirPt;
+        bool isMarked;
+    };
+
+    bool isDirected;
+
+    std::vector<MergeNode> nodes;
+
+    std::vector<MergeEdge> edges;
+
+    geom::CoordinateHashMap<std::size_t> nodeIndex;
 
-    std::vector<EdgeString*> edgeStrings;
+    // directed edges out of each node, sorted by angle: edge * 2 for the
+    // edge direction, edge * 2 + 1 for the opposite one
+    std::vector<std::size_t> outEdges;
+
+    std::vector<std::unique_ptr<geom::LineString>> mergedLineStrings;
 
     const geom::GeometryFactory* factory;
 
+    std::size_t getNode(const geom::Coordinate& pt);
+
+    void buildOutEdges();
+
     void merge();
 
     void buildEdgeStringsForObviousStartNodes();
@@ -95,12 +126,21 @@ private:
 
     void buildEdgeStringsForNonDegree2Nodes();
 
-    void buildEdgeStringsStartingAt(planargraph::Node* node);
+    void buildEdgeStringsStartingAt(std::size_t node);
+
+    std::unique_ptr<geom::LineString> buildEdgeStringStartingWith(std::size_t start);
 
-    EdgeString* buildEdgeStringStartingWith(LineMergeDirectedEdge* start);
+    std::size_t getNext(std::size_t dirEdge) const;
 
 public:
-    LineMerger();
+
+    /**
+     * Creates a merger.
+     *
+     * @param directed whether only lines with the same direction are merged
+     */
+    LineMerger(bool directed = false);
+
     ~LineMerger();
 
     /**
@@ -120,6 +160,7 @@ public:
      *
      * Any dimension of Geometry may be added; the constituent
      * linework will be extracted.
+     * The geometry must outlive the merger.
      */
     void add(const geom::Geometry* geometry);
 
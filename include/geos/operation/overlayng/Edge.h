@@ -147,6 +147,15 @@ public:
     bool relativeDirection(const Edge* edge2) const;
     int dimension(int geomIndex) const;
 
+    /**
+    * Gets the change in depth from the left side to the right side
+    * of the edge for an input geometry, summed over the merged edges.
+    */
+    int getDepthDelta(int geomIndex) const
+    {
+        return geomIndex == 0 ? aDepthDelta : bDepthDelta;
+    }
+
     /**
     * Merges an edge into this edge,
     * updating the topology info accordingly.
@@ -17,9 +17,9 @@
 #include <geos/export.h>
 #include <geos/operation/overlayng/OverlayEdge.h>
 #include <geos/operation/overlayng/OverlayLabel.h>
+#include <geos/geom/CoordinateHashMap.h>
 #include <geos/geom/CoordinateSequence.h>
 
-#include <map>
 #include <vector>
 #include <deque>
 
@@ -56,7 +56,7 @@ class GEOS_DLL OverlayGraph {
 private:
 
     // Members
-    std::map<Coordinate, OverlayEdge*> nodeMap;
+    geom::CoordinateHashMap<OverlayEdge*> nodeMap;
     std::vector<OverlayEdge*> edges;
 
     // Locally store the OverlayEdge and OverlayLabel
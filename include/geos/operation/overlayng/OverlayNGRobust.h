@@ -153,6 +153,23 @@ public:
     static std::unique_ptr<Geometry> Overlay(
         const Geometry* geom0, const Geometry* geom1, int opCode);
 
+    /**
+    * Performs an overlay operation, snap-rounding only the regions
+    * where floating noding fails.
+    *
+    * The input is noded in floating precision, and the segments near
+    * incorrectly noded intersections are then snap-rounded to the grid
+    * determined by PrecisionUtil::safeScale, with a
+    * noding::snapround::LocalSnapRoundingNoder. The other coordinates
+    * keep their full precision, and the overlay is computed only once.
+    * If the regions cannot be noded that way, the overlay is computed
+    * with snap-rounding of all the coordinates.
+    * Inputs which do not fail floating noding give the same result
+    * as with Overlay().
+    */
+    static std::unique_ptr<Geometry> OverlayFast(
+        const Geometry* geom0, const Geometry* geom1, int opCode);
+
     static std::unique_ptr<Geometry> overlaySnapTries(
         const Geometry* geom0, const Geometry* geom1, int opCode);
 
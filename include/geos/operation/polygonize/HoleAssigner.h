@@ -20,7 +20,7 @@
 #define GEOS_OP_POLYGONIZE_HOLEASSIGNER_H
 
 #include <geos/operation/polygonize/EdgeRing.h>
-#include <geos/index/strtree/STRtree.h>
+#include <geos/index/strtree/SimpleSTRtree.h>
 
 #include <vector>
 
@@ -33,6 +33,10 @@ namespace polygonize {
  *
  * Uses spatial indexing to improve performance of shell lookup.
  *
+ * The holes are tested against their candidate shells over several
+ * threads, with the tests against each shell made by one thread only,
+ * so that the point locator of each shell is only built once.
+ *
  * @author mdavis
  */
 class GEOS_DLL HoleAssigner {
@@ -41,24 +45,27 @@ public:
      * Assigns hole rings to shell rings
      * @param holes list of hole rings to assign
      * @param shells list of shell rings
+     * @param numThreads the number of threads, or 0 for one per core
      */
-    static void assignHolesToShells(std::vector<EdgeRing*> & holes, std::vector<EdgeRing*> & shells);
+    static void assignHolesToShells(std::vector<EdgeRing*> & holes, std::vector<EdgeRing*> & shells,
+                                    unsigned int numThreads = 1);
 
 private:
-    explicit HoleAssigner(std::vector<EdgeRing*> & shells) : m_shells(shells) {
+    HoleAssigner(std::vector<EdgeRing*> & shells, unsigned int numThreads)
+        : m_shells(shells)
+        , m_numThreads(numThreads)
+    {
         buildIndex();
     }
 
     void assignHolesToShells(std::vector<EdgeRing*> & holes);
-    void assignHoleToShell(EdgeRing* holeER);
-    std::vector<EdgeRing*> findShells(const geom::Envelope & ringEnv);
-
-    EdgeRing* findEdgeRingContaining(EdgeRing* testER);
+    std::vector<std::size_t> findShells(const geom::Envelope & ringEnv);
 
     void buildIndex();
 
     std::vector<EdgeRing*>& m_shells;
-    geos::index::strtree::STRtree m_shellIndex;
+    unsigned int m_numThreads;
+    geos::index::strtree::SimpleSTRtree m_shellIndex;
 };
 }
 }
@@ -23,7 +23,12 @@
 #include <geos/export.h>
 
 #include <geos/planargraph/PlanarGraph.h> // for inheritance
+#include <geos/planargraph/Node.h> // for composition
+#include <geos/operation/polygonize/EdgeRing.h> // for composition
+#include <geos/operation/polygonize/PolygonizeDirectedEdge.h> // for composition
+#include <geos/operation/polygonize/PolygonizeEdge.h> // for composition
 
+#include <deque>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -197,12 +202,11 @@ private:
 
     EdgeRing* findEdgeRing(PolygonizeDirectedEdge* startDE);
 
-    /* Tese are for memory management */
-    std::vector<planargraph::Edge*> newEdges;
-    std::vector<planargraph::DirectedEdge*> newDirEdges;
-    std::vector<planargraph::Node*> newNodes;
-    std::vector<EdgeRing*> newEdgeRings;
-    std::vector<geom::CoordinateSequence*> newCoords;
+    /* Tese are for memory management, allocated in std::deque for memory locality */
+    std::deque<PolygonizeEdge> newEdges;
+    std::deque<PolygonizeDirectedEdge> newDirEdges;
+    std::deque<planargraph::Node> newNodes;
+    std::deque<EdgeRing> newEdgeRings;
 };
 
 } // namespace geos::operation::polygonize
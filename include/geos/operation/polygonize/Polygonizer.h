@@ -108,9 +108,9 @@ private:
      */
     void polygonize();
 
-    static void findValidRings(const std::vector<EdgeRing*>& edgeRingList,
-                               std::vector<EdgeRing*>& validEdgeRingList,
-                               std::vector<std::unique_ptr<geom::LineString>>& invalidRingList);
+    void findValidRings(const std::vector<EdgeRing*>& edgeRingList,
+                        std::vector<EdgeRing*>& validEdgeRingList,
+                        std::vector<std::unique_ptr<geom::LineString>>& invalidRingList);
 
     void findShellsAndHoles(const std::vector<EdgeRing*>& edgeRingList);
 
@@ -122,6 +122,7 @@ private:
 
     bool extractOnlyPolygonal;
     bool computed;
+    unsigned int numThreads;
 
 protected:
 
@@ -188,6 +189,17 @@ public:
      */
     void add(const geom::Geometry* g);
 
+    /**
+     * Sets the number of threads the rings are validated and the holes
+     * assigned to shells over. 0 uses one thread per core.
+     * The default is 1.
+     */
+    void
+    setNumThreads(unsigned int p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     /** \brief
      * Gets the list of polygons formed by the polygonization.
      *
@@ -25,6 +25,8 @@
 
 #include <geos/operation/valid/TopologyValidationError.h> // for inlined destructor
 
+#include <vector>
+
 // Forward declarations
 namespace geos {
 namespace util {
@@ -81,6 +83,19 @@ private:
     void checkValid(const geom::GeometryCollection* gc);
     void checkConsistentArea(geomgraph::GeometryGraph* graph);
 
+    /**
+     * Tests whether a ring has enough points and no intersection
+     * other than the vertices shared by consecutive segments,
+     * using a monotone chain index and stopping at the first
+     * intersection found.
+     * Such a ring is valid, as is a polygon having it as its only
+     * ring, so no topology graph needs to be built for them.
+     *
+     * @param ring the ring to test
+     * @return true if the ring is known to be simple
+     */
+    static bool isSimpleRing(const geom::LinearRing* ring);
+
 
     /**
      * Check that there is no ring which self-intersects
@@ -192,6 +207,30 @@ public:
      */
     static bool isValid(const geom::Geometry& geom);
 
+    /** \brief
+     * Validates a batch of geometries, spread over several threads.
+     *
+     * For each geometry, errors receives the type of its validation error
+     * (a TopologyValidationError::errorEnum value), or -1 if it is valid,
+     * and locations the location of the error, or a null coordinate.
+     *
+     * The calling thread takes part in the validation. The
+     * util::CancellationToken current for it applies to all the threads,
+     * so its callback may be called from any of them. The first exception
+     * thrown stops the validation and is rethrown once all threads are done.
+     *
+     * @param geoms the geometries to validate
+     * @param p_isSelfTouchingRingFormingHoleValid see setSelfTouchingRingFormingHoleValid()
+     * @param numThreads the number of threads to use, 0 for one per hardware thread
+     * @param errors receives the error type of each geometry
+     * @param locations receives the error location of each geometry
+     */
+    static void validate(const std::vector<const geom::Geometry*>& geoms,
+                         bool p_isSelfTouchingRingFormingHoleValid,
+                         unsigned int numThreads,
+                         std::vector<int>& errors,
+                         std::vector<geom::Coordinate>& locations);
+
     IsValidOp(const geom::Geometry* geom)
         :
         parentGeometry(geom),
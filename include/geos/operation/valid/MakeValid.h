@@ -52,11 +52,33 @@ namespace valid { // geos::operation::valid
  * In case of full or partial dimensional collapses, the output geometry may be a collection of lower-to-equal dimension geometries or a geometry of lower dimension.
  *
  * Single polygons may become multi-geometries in case of self-intersections.
+ *
+ * Polygonal inputs are repaired with one of the methods of MakeValid::Method.
+ * The default, LINEWORK, nodes the rings and combines the faces by repeated
+ * overlay, keeping collapsed rings as lines and points.
+ * EVEN_ODD and WINDING node the rings once, build a single overlay graph and
+ * label each face of it with its winding number, which is much faster.
+ * They drop the parts of the rings which collapse to lines or points,
+ * so their result is always polygonal.
  */
 class GEOS_DLL MakeValid {
 
 public:
 
+    /** \brief
+     * The rules deciding which faces of the noded rings are interior.
+     */
+    enum Method {
+        /// Faces are combined by symmetric difference of the rings,
+        /// the original algorithm
+        LINEWORK,
+        /// Faces enclosed by an odd number of rings are interior
+        EVEN_ODD,
+        /// Faces with a non-zero winding number are interior, with shells
+        /// counted positive and holes negative
+        WINDING
+    };
+
     /** \brief
      * Create a MakeValid object.
      */
@@ -64,8 +86,23 @@ public:
 
     ~MakeValid() = default;
 
+    /** \brief Sets the method used to repair polygonal inputs. */
+    void setMethod(Method p_method)
+    {
+        method = p_method;
+    }
+
+    Method getMethod() const
+    {
+        return method;
+    }
+
     /** \brief Return a valid version of the input geometry. */
     std::unique_ptr<geom::Geometry> build(const geom::Geometry* geom);
+
+private:
+
+    Method method = LINEWORK;
 };
 
 } // namespace geos::operation::valid
@@ -18,6 +18,7 @@
 
 #include <geos/export.h>
 #include <geos/geom/Coordinate.h> // for use in container
+#include <geos/geom/CoordinateHashMap.h>
 
 #include <map>
 #include <vector>
@@ -44,12 +45,17 @@ namespace planargraph { // geos.planargraph
  * \brief
  * A map of Node, indexed by the coordinate of the node.
  *
+ * The nodes are iterated in coordinate order, and looked up through a
+ * hash index, so the container must only be modified through the
+ * NodeMap.
+ *
  */
 class GEOS_DLL NodeMap {
 public:
     typedef std::map<geom::Coordinate, Node*, geom::CoordinateLessThen> container;
 private:
     container nodeMap;
+    geom::CoordinateHashMap<Node*> nodeIndex;
 public:
     /**
      * \brief Constructs a NodeMap without any Nodes.
@@ -0,0 +1,137 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_PRECISION_LAYERPRECISIONREDUCER_H
+#define GEOS_PRECISION_LAYERPRECISIONREDUCER_H
+
+#include <geos/export.h>
+
+#include <memory> // for unique_ptr
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class PrecisionModel;
+}
+}
+
+namespace geos {
+namespace precision { // geos.precision
+
+/** \brief
+ * Reduces the precision of a set of geometries together, so that the
+ * boundaries they share stay shared.
+ *
+ * GeometryPrecisionReducer snap-rounds each geometry against its own
+ * vertices and intersections only, so two polygons of a coverage may
+ * round a common edge differently and leave gaps or overlaps.
+ *
+ * Here the hot pixels, the grid cells holding a vertex or an
+ * intersection of any geometry of the layer, are computed once for the
+ * whole layer. The layer is partitioned into strips of about the same
+ * number of vertices, each with its own HotPixelIndex, and the strips
+ * are processed over several threads. Each geometry is then rebuilt by
+ * a snap-rounding overlay which snaps its segments to the hot pixels of
+ * the whole layer, so segments shared by several geometries are rounded
+ * identically.
+ *
+ * Polygonal geometries stay valid, and collapsed components are removed,
+ * as with GeometryPrecisionReducer::reduce using the area reducer.
+ * Lines and points are rounded pointwise. The polygons of a
+ * GeometryCollection which also holds other components are reduced
+ * together in the same way, and returned in a GeometryCollection
+ * followed by the reduced other components.
+ */
+class GEOS_DLL LayerPrecisionReducer {
+
+public:
+
+    /**
+     * Convenience method reducing the precision of a layer, keeping the
+     * precision models of the geometries.
+     *
+     * @param geoms the geometries of the layer
+     * @param pm the precision model to round to
+     * @return the reduced geometries, in the order of the input
+     */
+    static std::vector<std::unique_ptr<geom::Geometry>> reduce(
+                const std::vector<const geom::Geometry*>& geoms,
+                const geom::PrecisionModel& pm);
+
+    /**
+     * Creates a reducer for a precision model.
+     *
+     * @param pm the precision model to round to, which must outlive the reducer
+     */
+    LayerPrecisionReducer(const geom::PrecisionModel& pm)
+        : targetPM(pm)
+        , changePrecisionModel(false)
+        , numThreads(1)
+    {}
+
+    /**
+     * Sets whether the results use the precision model of the reduction
+     * instead of that of the input geometries. The default is false.
+     */
+    void
+    setChangePrecisionModel(bool change)
+    {
+        changePrecisionModel = change;
+    }
+
+    /**
+     * Sets the number of threads, and of strips the layer is split into.
+     * 0 uses one thread per core. The default is 1.
+     */
+    void
+    setNumThreads(unsigned int p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
+    /**
+     * Reduces the precision of the geometries of a layer.
+     *
+     * @param geoms the geometries of the layer
+     * @return the reduced geometries, in the order of the input
+     */
+    std::vector<std::unique_ptr<geom::Geometry>> reduce(
+                const std::vector<const geom::Geometry*>& geoms);
+
+private:
+
+    const geom::PrecisionModel& targetPM;
+
+    bool changePrecisionModel;
+
+    unsigned int numThreads;
+
+    // Declare type as noncopyable
+    LayerPrecisionReducer(const LayerPrecisionReducer& other) = delete;
+    LayerPrecisionReducer& operator=(const LayerPrecisionReducer& rhs) = delete;
+};
+
+} // namespace geos.precision
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_PRECISION_LAYERPRECISIONREDUCER_H
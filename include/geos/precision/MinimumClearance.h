@@ -53,6 +53,20 @@ public:
      * or <tt>LINESTRING EMPTY</tt> if no Minimum Clearance distance exists
      */
     std::unique_ptr<geom::LineString> getLine();
+
+    /**
+     * Tests whether the Minimum Clearance distance is at least
+     * a given distance.
+     *
+     * Unless the distance has already been computed, only the pairs of
+     * facets closer than the given distance are searched, which is much
+     * faster than computing the distance when it is small.
+     *
+     * @param clearance the distance to test
+     * @return true if no two distinct vertices, nor a vertex and a
+     * segment, are closer than the distance
+     */
+    bool isAtLeast(double clearance);
 };
 }
 }
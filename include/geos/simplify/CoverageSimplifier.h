@@ -0,0 +1,123 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_COVERAGESIMPLIFIER_H
+#define GEOS_SIMPLIFY_COVERAGESIMPLIFIER_H
+
+#include <geos/export.h>
+
+#include <memory> // for unique_ptr
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/** \brief
+ * Simplifies a polygonal coverage, keeping the boundaries shared by
+ * adjacent polygons identical.
+ *
+ * A coverage is a set of polygonal geometries whose interiors do not
+ * overlap, and which share the vertices of their common boundaries.
+ * Simplifying each polygon on its own, as TopologyPreservingSimplifier
+ * does, lets shared boundaries diverge into gaps and overlaps.
+ *
+ * Here the rings of the coverage are split into edges at the nodes,
+ * the vertices where more than two boundaries meet.
+ * Each edge is simplified once with the Douglas-Peucker algorithm,
+ * and the polygons are rebuilt from the simplified edges.
+ *
+ * The simplified edges are then checked against a LineSegmentIndex
+ * over all the edges. An edge which crosses or touches another one,
+ * sweeps over a vertex of another one, or collapses a ring is
+ * simplified again with half the tolerance, and left unchanged after
+ * a few attempts. The result is thus a valid coverage if the input is.
+ *
+ * Edges are simplified and checked over several threads if requested.
+ */
+class GEOS_DLL CoverageSimplifier {
+
+public:
+
+    static std::vector<std::unique_ptr<geom::Geometry>> simplify(
+                const std::vector<const geom::Geometry*>& coverage,
+                double tolerance);
+
+    /**
+     * Creates a simplifier for a coverage.
+     *
+     * @param p_coverage polygonal geometries forming a coverage
+     */
+    CoverageSimplifier(const std::vector<const geom::Geometry*>& p_coverage)
+        : coverage(p_coverage)
+        , distanceTolerance(0.0)
+        , numThreads(1)
+    {}
+
+    /** \brief
+     * Sets the distance tolerance for the simplification.
+     *
+     * The tolerance value must be non-negative.
+     *
+     * @param tolerance the approximation tolerance to use
+     */
+    void setDistanceTolerance(double tolerance);
+
+    /**
+     * Sets the number of threads which simplify the edges.
+     * 0 uses one thread per core. The default is 1.
+     */
+    void
+    setNumThreads(unsigned int p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
+    /**
+     * Gets the simplified geometries, in the order of the input.
+     *
+     * @throws util::IllegalArgumentException if a geometry is not polygonal
+     */
+    std::vector<std::unique_ptr<geom::Geometry>> getResult();
+
+private:
+
+    std::vector<const geom::Geometry*> coverage;
+
+    double distanceTolerance;
+
+    unsigned int numThreads;
+
+    // Declare type as noncopyable
+    CoverageSimplifier(const CoverageSimplifier& other) = delete;
+    CoverageSimplifier& operator=(const CoverageSimplifier& rhs) = delete;
+};
+
+} // namespace geos::simplify
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_SIMPLIFY_COVERAGESIMPLIFIER_H
@@ -61,6 +61,22 @@ public:
         const CoordsVect& nPts,
         double distanceTolerance);
 
+    /** \brief
+     * Computes for each point the largest tolerance at which it is
+     * removed.
+     *
+     * Simplifying with a tolerance keeps exactly the points whose
+     * significance is greater than the tolerance, so any level of
+     * simplification can be extracted from a single computation.
+     * The significance of a point is the distance at which it splits
+     * its section, capped by the significance of the points splitting
+     * the enclosing sections. The endpoints are always kept.
+     *
+     * @param nPts the points of the line
+     * @return the significance of each point
+     */
+    static std::vector<double> computeSignificance(const CoordsVect& nPts);
+
     DouglasPeuckerLineSimplifier(const CoordsVect& nPts);
 
     /** \brief
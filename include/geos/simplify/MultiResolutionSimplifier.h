@@ -0,0 +1,113 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_MULTIRESOLUTIONSIMPLIFIER_H
+#define GEOS_SIMPLIFY_MULTIRESOLUTIONSIMPLIFIER_H
+
+#include <geos/export.h>
+
+#include <memory> // for unique_ptr
+#include <unordered_map>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/** \brief
+ * Simplifies a Geometry at many tolerances, from a significance
+ * computed once for each vertex.
+ *
+ * The significance of a vertex is the tolerance beyond which the
+ * simplification removes it: the Douglas-Peucker split distance, capped
+ * by those of the enclosing sections, or the Visvalingam-Whyatt effective
+ * area at removal. It is computed in a single pass over the lines, and
+ * each level is then extracted in linear time by keeping the vertices
+ * more significant than its tolerance.
+ *
+ * Each level is the same as the result of DouglasPeuckerSimplifier or
+ * of VWSimplifier without topology preservation, including the repair
+ * of polygonal results.
+ */
+class GEOS_DLL MultiResolutionSimplifier {
+
+public:
+
+    enum Method {
+        /// Douglas-Peucker, as DouglasPeuckerSimplifier
+        DOUGLAS_PEUCKER,
+        /// Visvalingam-Whyatt, as VWSimplifier
+        VISVALINGAM_WHYATT
+    };
+
+    /**
+     * Computes the significance of the vertices of a geometry.
+     *
+     * @param geom the geometry to simplify, which must outlive the simplifier
+     * @param method the simplification algorithm
+     */
+    MultiResolutionSimplifier(const geom::Geometry* geom,
+                              Method method = DOUGLAS_PEUCKER);
+
+    ~MultiResolutionSimplifier();
+
+    /**
+     * Gets the geometry simplified with a distance tolerance.
+     *
+     * @param tolerance the approximation tolerance, which must be non-negative
+     * @return the simplified geometry
+     */
+    std::unique_ptr<geom::Geometry> getResultGeometry(double tolerance) const;
+
+    /**
+     * Gets the geometry simplified with each of several tolerances,
+     * for instance one per zoom level.
+     *
+     * @param tolerances the approximation tolerances
+     * @return a simplified geometry per tolerance
+     */
+    std::vector<std::unique_ptr<geom::Geometry>> getResultGeometries(
+                const std::vector<double>& tolerances) const;
+
+private:
+
+    const geom::Geometry* inputGeom;
+
+    Method method;
+
+    // the significance of the points of each line of the input
+    std::unordered_map<const geom::Geometry*, std::vector<double>> significance;
+
+    // Declare type as noncopyable
+    MultiResolutionSimplifier(const MultiResolutionSimplifier& other) = delete;
+    MultiResolutionSimplifier& operator=(const MultiResolutionSimplifier& rhs) = delete;
+};
+
+} // namespace geos::simplify
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_SIMPLIFY_MULTIRESOLUTIONSIMPLIFIER_H
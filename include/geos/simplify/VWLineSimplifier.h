@@ -0,0 +1,210 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_VWLINESIMPLIFIER_H
+#define GEOS_SIMPLIFY_VWLINESIMPLIFIER_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h> // for composition
+#include <geos/geom/LineSegment.h> // for composition
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+}
+namespace simplify {
+class LineSegmentIndex;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/** \brief
+ * Simplifies a set of lines with the Visvalingam-Whyatt algorithm.
+ *
+ * Vertices are removed in order of increasing effective area, the area
+ * of the triangle they form with their neighbours. All the vertices of
+ * all the lines are kept in one indexed min-heap, so removing a vertex
+ * and updating the areas of its neighbours costs O(log n), and the
+ * whole simplification O(n log n).
+ *
+ * Removal stops once the smallest effective area is at least the
+ * square of the distance tolerance and the lines have no more
+ * vertices than the vertex budget, whichever comes last.
+ * The endpoints of the lines are never removed. Closed lines keep their
+ * first vertex and at least four points, so rings stay rings.
+ *
+ * When topology is preserved, a vertex is kept if removing it would make
+ * the line cross or touch another segment, or sweep over another vertex.
+ * The current segments of all the lines are kept in a LineSegmentIndex
+ * for these checks. A vertex refused this way is tried again when one
+ * of its neighbours is removed.
+ */
+class GEOS_DLL VWLineSimplifier {
+
+public:
+
+    /**
+     * Simplifies a single line with a distance tolerance.
+     *
+     * @param pts the coordinates of the line
+     * @param distanceTolerance the square root of the area tolerance
+     * @return the simplified coordinates
+     */
+    static std::unique_ptr<geom::Coordinate::Vect> simplify(
+        const geom::Coordinate::Vect& pts,
+        double distanceTolerance);
+
+    VWLineSimplifier();
+
+    ~VWLineSimplifier();
+
+    /**
+     * Adds a line to simplify.
+     *
+     * @param pts the coordinates of the line, which are copied
+     * @return the index of the line
+     */
+    std::size_t add(const geom::CoordinateSequence& pts);
+
+    std::size_t add(const geom::Coordinate::Vect& pts);
+
+    /**
+     * Adds a point which the simplified lines must not sweep over
+     * when topology is preserved.
+     */
+    void addObstacle(const geom::Coordinate& pt);
+
+    /**
+     * Sets the distance tolerance. Vertices with an effective area
+     * smaller than its square are removed.
+     * The tolerance value must be non-negative.
+     */
+    void setDistanceTolerance(double tolerance);
+
+    /**
+     * Sets the largest number of points of the simplified lines,
+     * counting the closing point of closed lines.
+     * The budget cannot be met if the endpoints of the lines exceed it.
+     */
+    void
+    setMaxVertices(std::size_t p_maxVertices)
+    {
+        maxVertices = p_maxVertices;
+    }
+
+    /**
+     * Sets whether removing a vertex may change the topology of the lines.
+     * The default is false.
+     */
+    void
+    setPreserveTopology(bool p_isPreserveTopology)
+    {
+        isPreserveTopology = p_isPreserveTopology;
+    }
+
+    /// Simplifies the lines added so far
+    void simplify();
+
+    /// Gets the number of points of the simplified lines
+    std::size_t
+    getNumVertices() const
+    {
+        return numVertices;
+    }
+
+    /// Gets the simplified coordinates of a line
+    std::unique_ptr<geom::Coordinate::Vect> getCoordinates(std::size_t line) const;
+
+    /**
+     * Gets for each point of a line the largest effective area removed
+     * up to its removal, or infinity if the last simplify() kept it.
+     *
+     * Vertices are removed in the same order whatever the tolerance,
+     * so simplifying without vertex budget or topology preservation
+     * keeps the points whose significance is at least the square of
+     * the distance tolerance. Simplifying once with an infinite
+     * tolerance thus gives every level of simplification.
+     *
+     * @param line the index of the line
+     * @return the significance of each point, in the order they were added
+     */
+    std::vector<double> getSignificance(std::size_t line) const;
+
+private:
+
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    struct Line {
+        std::size_t start;
+        std::size_t numPoints;
+        std::size_t numVertices;
+        std::size_t minVertices;
+        bool isClosed;
+    };
+
+    class AreaHeap;
+
+    double computeArea(std::size_t v) const;
+
+    bool isFixed(std::size_t v) const;
+
+    bool isTopologyPreserved(std::size_t v) const;
+
+    void remove(std::size_t v);
+
+    void updateArea(std::size_t v, AreaHeap& heap);
+
+    std::vector<Line> lines;
+    std::vector<geom::Coordinate> pts;
+    std::vector<std::size_t> lineOf;
+    std::vector<std::size_t> prev;
+    std::vector<std::size_t> next;
+    std::vector<double> area;
+    std::vector<double> significance;
+
+    // the segment from each vertex to the next one, and the obstacles,
+    // for the topology checks
+    std::vector<geom::LineSegment> segments;
+    std::vector<geom::LineSegment> obstacles;
+    std::unique_ptr<LineSegmentIndex> segmentIndex;
+
+    double areaTolerance;
+    std::size_t maxVertices;
+    bool isPreserveTopology;
+    std::size_t numVertices;
+
+    // Declare type as noncopyable
+    VWLineSimplifier(const VWLineSimplifier& other) = delete;
+    VWLineSimplifier& operator=(const VWLineSimplifier& rhs) = delete;
+};
+
+} // namespace geos::simplify
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_SIMPLIFY_VWLINESIMPLIFIER_H
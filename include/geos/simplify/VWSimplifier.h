@@ -0,0 +1,117 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_VWSIMPLIFIER_H
+#define GEOS_SIMPLIFY_VWSIMPLIFIER_H
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <limits>
+#include <memory> // for unique_ptr
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/** \brief
+ * Simplifies a Geometry using the Visvalingam-Whyatt algorithm.
+ *
+ * Vertices are removed in order of increasing effective area, which is
+ * the area of the triangle formed by a vertex and its neighbours,
+ * until the smallest one is at least the square of the distance tolerance.
+ * A vertex budget may be set instead of, or on top of, the tolerance.
+ * The budget is shared by all the lines of the geometry, so the vertices
+ * are taken where they matter least, whichever line they belong to.
+ *
+ * By default, polygonal results are made valid as with
+ * DouglasPeuckerSimplifier, and lines may cross after simplification.
+ * When topology is preserved, a vertex is only removed if the result
+ * does not cross or touch any other line of the geometry, or sweep over
+ * one of its points. Polygons then keep their holes, and rings which
+ * are disjoint stay disjoint, without the need of a final repair.
+ *
+ * Endpoints of lines and the start point of rings are never removed,
+ * and rings keep at least 4 points.
+ */
+class GEOS_DLL VWSimplifier {
+
+public:
+
+    static std::unique_ptr<geom::Geometry> simplify(
+        const geom::Geometry* geom,
+        double tolerance);
+
+    VWSimplifier(const geom::Geometry* geom);
+
+    /** \brief
+     * Sets the distance tolerance for the simplification.
+     *
+     * Vertices with an effective area smaller than the square of the
+     * tolerance are removed.
+     * The tolerance value must be non-negative. A tolerance value
+     * of zero is effectively a no-op.
+     *
+     * @param tolerance the approximation tolerance to use
+     */
+    void setDistanceTolerance(double tolerance);
+
+    /** \brief
+     * Sets the largest number of points of the result.
+     *
+     * The points of all the lines and rings of the geometry are counted,
+     * closing points included. The points which are never removed are
+     * kept even if they exceed the budget.
+     *
+     * @param maxVertices the vertex budget
+     */
+    void
+    setMaxVertices(std::size_t p_maxVertices)
+    {
+        maxVertices = p_maxVertices;
+    }
+
+    /** \brief
+     * Sets whether the simplification must keep the lines of the
+     * geometry from crossing or touching each other.
+     *
+     * @param isPreserveTopology true to preserve the topology
+     */
+    void
+    setPreserveTopology(bool p_isPreserveTopology)
+    {
+        isPreserveTopology = p_isPreserveTopology;
+    }
+
+    std::unique_ptr<geom::Geometry> getResultGeometry();
+
+private:
+
+    const geom::Geometry* inputGeom;
+
+    double distanceTolerance;
+
+    std::size_t maxVertices;
+
+    bool isPreserveTopology;
+};
+
+} // namespace geos::simplify
+} // namespace geos
+
+#endif // GEOS_SIMPLIFY_VWSIMPLIFIER_H
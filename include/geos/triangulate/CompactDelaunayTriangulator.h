@@ -0,0 +1,201 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class GeometryCollection;
+class GeometryFactory;
+class MultiLineString;
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * Computes the Delaunay triangulation of a set of sites into a compact,
+ * index-based half-edge representation.
+ *
+ * Where a quadedge::QuadEdgeSubdivision allocates a quartet of linked
+ * edges (each holding a Vertex) per edge, this representation stores
+ * two integer arrays with one entry per half-edge:
+ *
+ *  - getTriangleVertices()[e] is the index of the site the half-edge
+ *    `e` starts from. Half-edges 3t, 3t+1 and 3t+2 form triangle t,
+ *    in counter-clockwise order.
+ *  - getHalfEdges()[e] is the index of the opposite half-edge in the
+ *    adjacent triangle, or NONE when `e` is on the convex hull.
+ *
+ * This is about 48 bytes per site, against roughly ten times that
+ * for a QuadEdgeSubdivision, and traversals only touch contiguous
+ * arrays. Site indexes refer to the input order.
+ *
+ * The triangulation is computed with a sweep-hull algorithm: sites are
+ * added in order of distance from a seed triangle, each one connected
+ * to the visible part of the convex hull and made Delaunay by edge
+ * flips. Duplicate sites are ignored, and no tolerance is applied.
+ * Unlike the QuadEdgeSubdivision, there is no enclosing frame, so the
+ * triangles cover exactly the convex hull of the sites.
+ *
+ * The algorithm is ported from the Delaunator library by Mapbox,
+ * under the ISC License (see COPYING).
+ */
+class GEOS_DLL CompactDelaunayTriangulator {
+
+public:
+
+    /// Half-edge or site index standing for "none"
+    static constexpr std::uint32_t NONE = UINT32_MAX;
+
+    /**
+     * Creates a triangulator for the XY ordinates of a sequence.
+     *
+     * @param sites the sites to triangulate
+     */
+    explicit CompactDelaunayTriangulator(const geom::CoordinateSequence& sites);
+
+    /**
+     * Creates a triangulator for interleaved XY ordinates.
+     *
+     * @param xy buffer of 2 * numSites ordinates
+     * @param numSites the number of sites
+     */
+    CompactDelaunayTriangulator(const double* xy, std::size_t numSites);
+
+    /// The next half-edge of the same triangle
+    static std::size_t
+    nextHalfEdge(std::size_t e)
+    {
+        return (e % 3 == 2) ? e - 2 : e + 1;
+    }
+
+    /// The previous half-edge of the same triangle
+    static std::size_t
+    prevHalfEdge(std::size_t e)
+    {
+        return (e % 3 == 0) ? e + 2 : e - 1;
+    }
+
+    std::size_t
+    getNumSites() const
+    {
+        return xy.size() / 2;
+    }
+
+    double
+    getX(std::size_t site) const
+    {
+        return xy[2 * site];
+    }
+
+    double
+    getY(std::size_t site) const
+    {
+        return xy[2 * site + 1];
+    }
+
+    std::size_t getNumTriangles();
+
+    /// Number of edges, each shared pair of half-edges counted once
+    std::size_t getNumEdges();
+
+    /// Start site of each half-edge, three per triangle
+    const std::vector<std::uint32_t>& getTriangleVertices();
+
+    /// Opposite half-edge of each half-edge, or NONE on the hull
+    const std::vector<std::uint32_t>& getHalfEdges();
+
+    /// Sites of the convex hull in counter-clockwise order
+    const std::vector<std::uint32_t>& getHull();
+
+    /**
+     * Writes the XY ordinates of the triangle vertices,
+     * 6 values per triangle.
+     *
+     * @param buf a buffer for 6 * getNumTriangles() values
+     */
+    void getTriangleCoordinates(double* buf);
+
+    /**
+     * Writes the XY ordinates of the edge endpoints,
+     * 4 values per edge.
+     *
+     * @param buf a buffer for 4 * getNumEdges() values
+     */
+    void getEdgeCoordinates(double* buf);
+
+    /**
+     * Gets the triangles as a collection of polygons.
+     *
+     * @param geomFact the factory to build the result with
+     * @return the triangles of the triangulation
+     */
+    std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
+
+    /**
+     * Gets the edges as a MultiLineString.
+     *
+     * @param geomFact the factory to build the result with
+     * @return the edges of the triangulation
+     */
+    std::unique_ptr<geom::MultiLineString> getEdges(const geom::GeometryFactory& geomFact);
+
+private:
+
+    std::vector<double> xy;
+    std::vector<std::uint32_t> triangles;
+    std::vector<std::uint32_t> halfedges;
+    std::vector<std::uint32_t> hull;
+    bool isComputed;
+
+    // Sweep state, only used while computing
+    std::vector<std::uint32_t> hullPrev;
+    std::vector<std::uint32_t> hullNext;
+    std::vector<std::uint32_t> hullTri;
+    std::vector<std::uint32_t> hullHash;
+    std::vector<std::uint32_t> edgeStack;
+    std::uint32_t hullStart;
+    double centerX;
+    double centerY;
+
+    void create();
+
+    void triangulate();
+
+    std::size_t hashKey(double x, double y) const;
+
+    std::uint32_t addTriangle(std::uint32_t i0, std::uint32_t i1, std::uint32_t i2,
+                              std::uint32_t a, std::uint32_t b, std::uint32_t c);
+
+    void link(std::uint32_t a, std::uint32_t b);
+
+    std::uint32_t legalize(std::uint32_t a);
+
+    bool isRightOf(std::uint32_t p, std::uint32_t a, std::uint32_t b) const;
+
+    // Declare type as noncopyable
+    CompactDelaunayTriangulator(const CompactDelaunayTriangulator& other) = delete;
+    CompactDelaunayTriangulator& operator=(const CompactDelaunayTriangulator& rhs) = delete;
+};
+
+} //namespace geos.triangulate
+} //namespace geos
+
@@ -79,9 +79,33 @@ public:
      */
     static std::unique_ptr<geom::CoordinateSequence> unique(const geom::CoordinateSequence* seq);
 
+    /**
+     * \brief
+     * Orders vertices along a Hilbert curve covering their extent,
+     * so that incremental insertion locates each of them with a short
+     * walk from the previously inserted one.
+     *
+     * @param vertices the vertices to reorder
+     */
+    static void sortForInsertion(IncrementalDelaunayTriangulator::VertexList& vertices);
+
+    /**
+     * \brief
+     * Inserts sites into a subdivision, as done by the builder.
+     *
+     * @param subdiv the subdivision to build the triangulation in
+     * @param coords the sites, which must be unique
+     * @param isHilbertOrder whether to insert the sites in Hilbert
+     *        order rather than in lexicographic order
+     */
+    static void insertSites(quadedge::QuadEdgeSubdivision& subdiv,
+                            const geom::CoordinateSequence& coords,
+                            bool isHilbertOrder);
+
 private:
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
+    bool isHilbertOrder;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
 
 public:
@@ -122,6 +146,24 @@ public:
         this->tolerance = p_tolerance;
     }
 
+    /**
+     * \brief
+     * Sets whether sites are inserted in Hilbert order (see
+     * sortForInsertion), which is much faster for large site sets.
+     *
+     * Sites are inserted in lexicographic order by default.
+     * Both orders give a Delaunay triangulation, but the choice
+     * between equally valid triangulations of cocircular sites
+     * (e.g. regular grids) differs.
+     *
+     * @param p_isHilbertOrder true to insert sites in Hilbert order
+     */
+    inline void
+    setHilbertOrder(bool p_isHilbertOrder)
+    {
+        this->isHilbertOrder = p_isHilbertOrder;
+    }
+
 private:
     void create();
 
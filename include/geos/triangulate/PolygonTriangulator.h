@@ -0,0 +1,136 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * Triangulates a Polygon or MultiPolygon, holes included, by ear
+ * clipping, returning the triangles as indexes of the input vertices.
+ *
+ * Vertices are numbered in the order of the coordinates of the rings:
+ * shell then holes of each polygon, polygon after polygon, counting
+ * the closing coordinate of every ring. This is the layout of
+ * concatenated ring coordinate buffers, such as the GeoArrow ones, so
+ * indexes can be used with the input coordinates without copying.
+ * Closing coordinates are never referenced.
+ *
+ * Holes are joined to the shell by bridge edges, after which ears are
+ * clipped from the resulting ring. Large rings are clipped with the
+ * help of a Z-order index of the vertices. Repeated and collinear
+ * vertices are left out of the triangulation.
+ *
+ * With setDelaunay(true), the ear clipping triangulation is refined by
+ * edge flips into the constrained Delaunay triangulation of the
+ * polygon boundary, which avoids most of the slivers.
+ *
+ * The input is expected to be valid. Invalid polygons are triangulated
+ * on a best effort basis.
+ *
+ * The ear clipping is ported from the earcut library by Mapbox,
+ * under the ISC License (see COPYING).
+ */
+class GEOS_DLL PolygonTriangulator {
+
+public:
+
+    /**
+     * Creates a triangulator for a polygonal geometry.
+     *
+     * @param geom a Polygon or MultiPolygon
+     * @throws IllegalArgumentException if the geometry is not polygonal
+     */
+    explicit PolygonTriangulator(const geom::Geometry& geom);
+
+    /**
+     * Computes the triangulation of a polygonal geometry.
+     *
+     * @param geom a Polygon or MultiPolygon
+     * @param isDelaunay whether to compute the constrained Delaunay triangulation
+     * @return a GeometryCollection of triangular Polygons
+     */
+    static std::unique_ptr<geom::Geometry> triangulate(const geom::Geometry& geom, bool isDelaunay = false);
+
+    /**
+     * Sets whether the triangulation is refined into the constrained
+     * Delaunay triangulation of the polygon boundary.
+     * The default is false.
+     */
+    void
+    setDelaunay(bool p_isDelaunay)
+    {
+        isDelaunay = p_isDelaunay;
+    }
+
+    /// Vertex indexes of the triangles, three per counter-clockwise triangle
+    const std::vector<std::uint32_t>& getTriangleIndices();
+
+    std::size_t
+    getNumTriangles()
+    {
+        return getTriangleIndices().size() / 3;
+    }
+
+    /// Number of input vertices, closing coordinates included
+    std::size_t
+    getNumVertices() const
+    {
+        return xy.size() / 2;
+    }
+
+    /**
+     * Gets the triangles as a collection of polygons.
+     *
+     * @return a GeometryCollection of triangular Polygons
+     */
+    std::unique_ptr<geom::Geometry> getResult();
+
+private:
+
+    const geom::GeometryFactory* geomFact;
+    std::vector<double> xy;
+    // first vertex of each ring, with the end of the last one
+    std::vector<std::uint32_t> ringStart;
+    // first ring of each polygon, with the end of the last one
+    std::vector<std::size_t> polyStart;
+    std::vector<std::uint32_t> triangles;
+    bool isDelaunay;
+    bool isComputed;
+
+    void addPolygon(const geom::Polygon& poly);
+
+    void compute();
+
+    void triangulatePolygon(std::size_t firstRing, std::size_t endRing);
+
+    void flipToDelaunay(std::size_t firstTriangle);
+};
+
+} //namespace geos.triangulate
+} //namespace geos
+
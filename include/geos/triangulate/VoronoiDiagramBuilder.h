@@ -91,6 +91,40 @@ public:
      */
     void setTolerance(double tolerance);
 
+    /** \brief
+     * Sets whether sites are inserted in Hilbert order, which is much
+     * faster for large site sets.
+     *
+     * See DelaunayTriangulationBuilder::setHilbertOrder.
+     *
+     * @param isHilbertOrder true to insert sites in Hilbert order
+     */
+    void setHilbertOrder(bool isHilbertOrder);
+
+    /** \brief
+     * Sets whether getDiagram returns the cells in the order of the
+     * input sites.
+     *
+     * In this mode the diagram is computed from a
+     * CompactDelaunayTriangulator rather than a
+     * quadedge::QuadEdgeSubdivision, which takes a fraction of the time
+     * and memory for large site sets. The i-th cell is the cell of the
+     * i-th distinct site, repeated sites being given a single cell at
+     * their first occurrence, and its user data is left unset.
+     * The snapping tolerance is not used.
+     *
+     * @param isOrdered true to return the cells in input site order
+     */
+    void setOrdered(bool isOrdered);
+
+    /** \brief
+     * Sets the number of threads the cells of an ordered diagram are
+     * built over. 0 uses one thread per core. The default is 1.
+     *
+     * @param numThreads the number of threads
+     */
+    void setNumThreads(unsigned int numThreads);
+
     /** \brief
      * Gets the quadedge::QuadEdgeSubdivision which models the computed diagram.
      *
@@ -119,13 +153,21 @@ public:
 private:
 
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
+    std::unique_ptr<geom::CoordinateSequence> inputCoords;
     double tolerance;
+    bool isHilbertOrder;
+    bool isOrdered;
+    unsigned int numThreads;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
     const geom::Envelope* clipEnv; // externally owned
     geom::Envelope diagramEnv;
 
+    void computeDiagramEnvelope();
+
     void create();
 
+    std::unique_ptr<geom::GeometryCollection> getOrderedDiagram(const geom::GeometryFactory& geomFact);
+
     static std::unique_ptr<geom::GeometryCollection>
     clipGeometryCollection(std::vector<std::unique_ptr<geom::Geometry>> & geoms, const geom::Envelope& clipEnv);
 
@@ -0,0 +1,130 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <atomic>
+#include <chrono>
+
+namespace geos {
+namespace util { // geos::util
+
+/**
+ * \brief Interruption request scoped to the operations of one thread,
+ *        as opposed to the process-wide requests of Interrupt.
+ *
+ * A token is made current for a thread with a CancellationScope.
+ * While current, it is checked at every GEOS_CHECK_FOR_INTERRUPTS()
+ * site reached by that thread, which then fails with an
+ * InterruptedException if
+ *
+ *  - request() has been called (possibly from another thread),
+ *  - the deadline has passed, or
+ *  - the callback returned true.
+ *
+ * A pending request is cleared once it has interrupted an operation,
+ * a deadline stays in effect until it is changed.
+ */
+class GEOS_DLL CancellationToken {
+
+public:
+
+    typedef std::chrono::steady_clock Clock;
+
+    /// Returning true interrupts the current operation
+    typedef bool (Callback)(void* userData);
+
+    CancellationToken();
+
+    /// Request interruption of the operations using this token.
+    /// Safe to call from any thread.
+    void request();
+
+    /// Cancel a pending interruption request.
+    void cancel();
+
+    /// Check if an interruption request is pending.
+    bool isRequested() const;
+
+    /// Interrupt operations still running at the given time point.
+    void setDeadline(Clock::time_point deadline);
+
+    /// Interrupt operations still running after the given duration
+    /// from now.
+    void setTimeout(Clock::duration timeout);
+
+    /// Remove any deadline.
+    void clearDeadline();
+
+    bool
+    hasDeadline() const
+    {
+        return deadlineSet;
+    }
+
+    /**
+     * \brief Register a callback invoked at each check of the token.
+     *
+     * As for Interrupt::registerCallback, checks happen frequently so
+     * the callback should be quick.
+     */
+    void setCallback(Callback* cb, void* userData);
+
+    /**
+     * \brief Tells whether the operations using the token must stop
+     *        now, clearing any pending request.
+     */
+    bool check();
+
+private:
+
+    std::atomic<bool> requested;
+    bool deadlineSet;
+    Clock::time_point deadline;
+    Callback* callback;
+    void* callbackData;
+
+    // Declare type as noncopyable
+    CancellationToken(const CancellationToken& other) = delete;
+    CancellationToken& operator=(const CancellationToken& rhs) = delete;
+};
+
+/**
+ * \brief Makes a CancellationToken current for the calling thread
+ *        for the lifetime of the scope.
+ *
+ * Scopes can be nested, the previous token is restored on exit.
+ */
+class GEOS_DLL CancellationScope {
+
+public:
+
+    explicit CancellationScope(CancellationToken* token);
+
+    ~CancellationScope();
+
+    /// The token current for the calling thread, or nullptr
+    static CancellationToken* current();
+
+private:
+
+    CancellationToken* previous;
+
+    CancellationScope(const CancellationScope& other) = delete;
+    CancellationScope& operator=(const CancellationScope& rhs) = delete;
+};
+
+} // namespace geos::util
+} // namespace geos
+
@@ -22,7 +22,12 @@ namespace util { // geos::util
 
 #define GEOS_CHECK_FOR_INTERRUPTS() geos::util::Interrupt::process()
 
-/** \brief Used to manage interruption requests and callbacks. */
+/** \brief Used to manage interruption requests and callbacks.
+ *
+ * Requests and callbacks registered here apply to every operation
+ * running in the process. Use a CancellationToken to interrupt the
+ * operations of a single thread.
+ */
 class GEOS_DLL Interrupt {
 
 public:
@@ -56,7 +61,9 @@ public:
     static Callback* registerCallback(Callback* cb);
 
     /**
-     * Invoke the callback, if any. Process pending interruption, if any.
+     * Invoke the callback, if any. Process pending interruption, if any,
+     * including the one of the CancellationToken current for the
+     * calling thread.
      *
      */
     static void process();
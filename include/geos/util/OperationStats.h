@@ -0,0 +1,196 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace geos {
+namespace util { // geos::util
+
+/**
+ * \brief Phase timings and hot-path counters recorded by operations.
+ *
+ * Statistics are only recorded while a collector is made current
+ * for the calling thread with an OperationStatsScope. Otherwise the
+ * instrumented code only pays for checking that no collector is set.
+ *
+ * \code
+ * OperationStats stats;
+ * {
+ *     OperationStatsScope scope(&stats);
+ *     result = OverlayNGRobust::Overlay(a, b, OverlayNG::UNION);
+ * }
+ * double nodingSeconds = stats.getTime(OperationStats::NODING);
+ * \endcode
+ */
+class GEOS_DLL OperationStats {
+
+public:
+
+    typedef std::chrono::steady_clock Clock;
+
+    enum Phase {
+        /// Computing the noding of the input linework
+        NODING = 0,
+        /// Building the topology graph from the noded edges
+        GRAPH_BUILD,
+        /// Computing the topological labels of the graph
+        LABELLING,
+        /// Building the result geometries from the graph
+        RESULT_BUILD,
+        /// Generating buffer offset curves
+        BUFFER_CURVES,
+        NUM_PHASES
+    };
+
+    enum Counter {
+        /// Input segments passed to a noder
+        SEGMENTS_NODED = 0,
+        /// Noded edges produced by a noder
+        NODED_EDGES,
+        /// Interior segment intersections found while noding in floating precision
+        INTERSECTIONS_FOUND,
+        /// Overlays retried by OverlayNGRobust with snapping noding
+        OVERLAY_SNAPPING_TRIES,
+        /// Overlays retried by OverlayNGRobust with snap-rounding
+        OVERLAY_SNAP_ROUNDING_TRIES,
+        /// Segments snap-rounded around the noding failures of a floating overlay
+        LOCAL_SNAP_ROUNDED_SEGMENTS,
+        NUM_COUNTERS
+    };
+
+    OperationStats();
+
+    /// Clears all timings and counters
+    void reset();
+
+    /// Adds the timings and counters of another collector
+    void merge(const OperationStats& other);
+
+    /// Tells whether nothing has been recorded since the last reset
+    bool isEmpty() const;
+
+    void
+    addTime(Phase phase, Clock::duration elapsed)
+    {
+        times[phase] += elapsed;
+    }
+
+    void
+    add(Counter counter, std::uint64_t n)
+    {
+        counts[counter] += n;
+    }
+
+    /// Time spent in a phase, in seconds
+    double getTime(Phase phase) const;
+
+    std::uint64_t
+    getCount(Counter counter) const
+    {
+        return counts[counter];
+    }
+
+    static const char* getName(Phase phase);
+
+    static const char* getName(Counter counter);
+
+    /// The collector current for the calling thread, or nullptr
+    static OperationStats* current();
+
+    /// Adds n to a counter of the current collector, if any
+    static void
+    count(Counter counter, std::uint64_t n = 1)
+    {
+        OperationStats* stats = current();
+        if(stats) {
+            stats->add(counter, n);
+        }
+    }
+
+private:
+
+    Clock::duration times[NUM_PHASES];
+    std::uint64_t counts[NUM_COUNTERS];
+};
+
+/**
+ * \brief Makes an OperationStats collector current for the calling
+ *        thread for the lifetime of the scope.
+ *
+ * Scopes can be nested, the previous collector is restored on exit.
+ */
+class GEOS_DLL OperationStatsScope {
+
+public:
+
+    explicit OperationStatsScope(OperationStats* stats);
+
+    ~OperationStatsScope();
+
+private:
+
+    OperationStats* previous;
+
+    OperationStatsScope(const OperationStatsScope& other) = delete;
+    OperationStatsScope& operator=(const OperationStatsScope& rhs) = delete;
+};
+
+/**
+ * \brief Records the time spent in a block of code as a phase of
+ *        the current OperationStats collector, if any.
+ */
+class GEOS_DLL PhaseTimer {
+
+public:
+
+    explicit PhaseTimer(OperationStats::Phase p_phase)
+        : stats(OperationStats::current())
+        , phase(p_phase)
+    {
+        if(stats) {
+            start = OperationStats::Clock::now();
+        }
+    }
+
+    ~PhaseTimer()
+    {
+        stop();
+    }
+
+    /// Records the time elapsed so far, the destructor then records nothing
+    void
+    stop()
+    {
+        if(stats) {
+            stats->addTime(phase, OperationStats::Clock::now() - start);
+            stats = nullptr;
+        }
+    }
+
+private:
+
+    OperationStats* stats;
+    OperationStats::Phase phase;
+    OperationStats::Clock::time_point start;
+
+    PhaseTimer(const PhaseTimer& other) = delete;
+    PhaseTimer& operator=(const PhaseTimer& rhs) = delete;
+};
+
+} // namespace geos::util
+} // namespace geos
+
@@ -0,0 +1,43 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <functional>
+
+namespace geos {
+namespace util { // geos::util
+
+/**
+ * \brief Runs a task for each index of a range over several threads.
+ *
+ * Indexes are handed out one at a time, so tasks of uneven cost are
+ * spread evenly. The calling thread takes part in the work, and the
+ * CancellationToken current for it is made current for the others.
+ *
+ * If a task throws, the indexes not yet started are skipped and the
+ * first exception is rethrown once all threads are done.
+ * If fewer threads can be started than requested, the work runs on
+ * the threads which could.
+ *
+ * @param n the number of tasks
+ * @param numThreads the number of threads, or 0 for one per core
+ * @param task the task, called once for each index in [0, n)
+ */
+GEOS_DLL void parallelFor(std::size_t n, unsigned int numThreads,
+                          const std::function<void(std::size_t)>& task);
+
+} // namespace geos::util
+} // namespace geos
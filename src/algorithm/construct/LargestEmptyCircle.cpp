@@ -183,16 +183,43 @@ double
 LargestEmptyCircle::distanceToConstraints(const Coordinate& c)
 {
     bool isOutside = ptLocator && (Location::EXTERIOR == ptLocator->locate(&c));
-    std::unique_ptr<Point> pt(factory->createPoint(c));
     if (isOutside) {
-        double boundaryDist = boundaryDistance->distance(pt.get());
+        double boundaryDist = boundaryDistance->distance(c);
         return -boundaryDist;
 
     }
-    double dist = obstacleDistance.distance(pt.get());
+    double dist = obstacleDistance.distance(c);
     return dist;
 }
 
+/* private */
+void
+LargestEmptyCircle::distanceToConstraints(const std::vector<Coordinate>& pts, std::vector<double>& dists)
+{
+    // points inside and outside the boundary are measured
+    // against different constraints, each group in one batch
+    std::vector<Coordinate> insidePts;
+    std::vector<Coordinate> outsidePts;
+    std::vector<bool> isOutside(pts.size());
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        isOutside[i] = ptLocator && (Location::EXTERIOR == ptLocator->locate(&pts[i]));
+        (isOutside[i] ? outsidePts : insidePts).push_back(pts[i]);
+    }
+    std::vector<double> insideDists;
+    std::vector<double> outsideDists;
+    obstacleDistance.distance(insidePts, insideDists);
+    if (!outsidePts.empty()) {
+        boundaryDistance->distance(outsidePts, outsideDists);
+    }
+
+    dists.resize(pts.size());
+    std::size_t nInside = 0;
+    std::size_t nOutside = 0;
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        dists[i] = isOutside[i] ? -outsideDists[nOutside++] : insideDists[nInside++];
+    }
+}
+
 /* private */
 double
 LargestEmptyCircle::distanceToConstraints(double x, double y)
@@ -231,6 +258,8 @@ LargestEmptyCircle::compute()
 
     // Priority queue of cells, ordered by decreasing distance from constraints
     std::priority_queue<Cell> cellQueue;
+    std::vector<Coordinate> subCellPts(4);
+    std::vector<double> subCellDists;
     createInitialGrid(obstacles->getEnvelopeInternal(), cellQueue);
 
     Cell farthestCell = createCentroidCell(obstacles);
@@ -258,12 +287,17 @@ LargestEmptyCircle::compute()
         * since no point in it can be further than the current farthest distance.
         */
         if (mayContainCircleCenter(cell, farthestCell)) {
-            // split the cell into four sub-cells
+            // split the cell into four sub-cells, whose distances
+            // are computed together
             double h2 = cell.getHSize() / 2;
-            cellQueue.emplace(cell.getX()-h2, cell.getY()-h2, h2, distanceToConstraints(cell.getX()-h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()-h2, h2, distanceToConstraints(cell.getX()+h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()-h2, cell.getY()+h2, h2, distanceToConstraints(cell.getX()-h2, cell.getY()+h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()+h2, h2, distanceToConstraints(cell.getX()+h2, cell.getY()+h2));
+            subCellPts[0] = Coordinate(cell.getX()-h2, cell.getY()-h2);
+            subCellPts[1] = Coordinate(cell.getX()+h2, cell.getY()-h2);
+            subCellPts[2] = Coordinate(cell.getX()-h2, cell.getY()+h2);
+            subCellPts[3] = Coordinate(cell.getX()+h2, cell.getY()+h2);
+            distanceToConstraints(subCellPts, subCellDists);
+            for (std::size_t i = 0; i < 4; i++) {
+                cellQueue.emplace(subCellPts[i].x, subCellPts[i].y, h2, subCellDists[i]);
+            }
         }
     }
 
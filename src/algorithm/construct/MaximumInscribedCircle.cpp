@@ -29,6 +29,7 @@
 #include <geos/geom/MultiPolygon.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/util/ParallelFor.h>
 
 #include <typeinfo> // for dynamic_cast
 #include <cassert>
@@ -78,6 +79,29 @@ MaximumInscribedCircle::getRadiusLine(const Geometry* polygonal, double toleranc
     return mic.getRadiusLine();
 }
 
+/* public static */
+void
+MaximumInscribedCircle::getCenters(const std::vector<const Geometry*>& polygonals, double tolerance,
+                                   std::vector<Coordinate>& centers, std::vector<double>& radii,
+                                   unsigned int numThreads)
+{
+    centers.assign(polygonals.size(), Coordinate());
+    radii.assign(polygonals.size(), 0.0);
+
+    // envelopes are cached on first use, so compute them before
+    // a geometry listed twice is read by two threads
+    for (const Geometry* polygonal : polygonals) {
+        polygonal->getEnvelopeInternal();
+    }
+
+    util::parallelFor(polygonals.size(), numThreads, [&](std::size_t i) {
+        MaximumInscribedCircle mic(polygonals[i], tolerance);
+        mic.compute();
+        centers[i] = mic.centerPt;
+        radii[i] = mic.centerPt.distance(mic.radiusPt);
+    });
+}
+
 /* public */
 std::unique_ptr<Point>
 MaximumInscribedCircle::getCenter()
@@ -133,14 +157,24 @@ MaximumInscribedCircle::createInitialGrid(const Envelope* env, std::priority_que
 double
 MaximumInscribedCircle::distanceToBoundary(const Coordinate& c)
 {
-    std::unique_ptr<Point> pt(factory->createPoint(c));
-    double dist = indexedDistance.distance(pt.get());
-    // double dist = inputGeomBoundary->distance(pt.get());
+    double dist = indexedDistance.distance(c);
     bool isOutside = (Location::EXTERIOR == ptLocator.locate(&c));
     if (isOutside) return -dist;
     return dist;
 }
 
+/* private */
+void
+MaximumInscribedCircle::distanceToBoundary(const std::vector<Coordinate>& pts, std::vector<double>& dists)
+{
+    indexedDistance.distance(pts, dists);
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        if (Location::EXTERIOR == ptLocator.locate(&pts[i])) {
+            dists[i] = -dists[i];
+        }
+    }
+}
+
 /* private */
 double
 MaximumInscribedCircle::distanceToBoundary(double x, double y)
@@ -169,6 +203,8 @@ MaximumInscribedCircle::compute()
 
     // Priority queue of cells, ordered by maximum distance from boundary
     std::priority_queue<Cell> cellQueue;
+    std::vector<Coordinate> subCellPts(4);
+    std::vector<double> subCellDists;
 
     createInitialGrid(inputGeom->getEnvelopeInternal(), cellQueue);
 
@@ -199,12 +235,17 @@ MaximumInscribedCircle::compute()
         */
         double potentialIncrease = cell.getMaxDistance() - farthestCell.getDistance();
         if (potentialIncrease > tolerance) {
-            // split the cell into four sub-cells
+            // split the cell into four sub-cells, whose distances
+            // are computed together
             double h2 = cell.getHSize() / 2;
-            cellQueue.emplace(cell.getX()-h2, cell.getY()-h2, h2, distanceToBoundary(cell.getX()-h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()-h2, h2, distanceToBoundary(cell.getX()+h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()-h2, cell.getY()+h2, h2, distanceToBoundary(cell.getX()-h2, cell.getY()+h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()+h2, h2, distanceToBoundary(cell.getX()+h2, cell.getY()+h2));
+            subCellPts[0] = Coordinate(cell.getX()-h2, cell.getY()-h2);
+            subCellPts[1] = Coordinate(cell.getX()+h2, cell.getY()-h2);
+            subCellPts[2] = Coordinate(cell.getX()-h2, cell.getY()+h2);
+            subCellPts[3] = Coordinate(cell.getX()+h2, cell.getY()+h2);
+            distanceToBoundary(subCellPts, subCellDists);
+            for (std::size_t i = 0; i < 4; i++) {
+                cellQueue.emplace(subCellPts[i].x, subCellPts[i].y, h2, subCellDists[i]);
+            }
         }
     }
     // std::cout << "number of iterations: " << i << std::endl;
@@ -21,6 +21,7 @@
 
 #include <geos/geom/Geometry.h>
 #include <geos/geom/LineString.h>
+#include <geos/util/IllegalArgumentException.h>
 
 #include <typeinfo>
 #include <cassert>
@@ -81,64 +82,133 @@ DiscreteFrechetDistance::getSegementAt(const CoordinateSequence& seq, size_t ind
     }
 }
 
-PointPairDistance&
-DiscreteFrechetDistance::getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, size_t i, size_t j,
-        const CoordinateSequence& p, const CoordinateSequence& q)
+std::vector<geom::Coordinate>
+DiscreteFrechetDistance::getPoints(const geom::Geometry& geom)
 {
-    PointPairDistance p_ptDist;
-    if(! ca[i][j].getIsNull()) {
-        return ca[i][j];
+    auto seq = geom.getCoordinates();
+    if(seq->isEmpty()) {
+        throw util::IllegalArgumentException("Frechet distance of an empty geometry is undefined");
     }
-    p_ptDist.initialize(getSegementAt(p, i), getSegementAt(q, j));
-    if(i == 0 && j == 0) {
-        ca[i][j] = ptDist;
-    }
-    else if(i > 0 && j == 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, i - 1, 0, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
-    }
-    else if(i == 0 && j > 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, 0, j - 1, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
+    std::size_t size = seq->size();
+    if(densifyFrac > 0) {
+        std::size_t numSubSegs = std::size_t(util::round(1.0 / densifyFrac));
+        size = numSubSegs * (size - 1) + 1;
     }
-    else {
-        PointPairDistance d1 = getFrecheDistance(ca, i - 1, j, p, q),
-                          d2 = getFrecheDistance(ca, i - 1, j - 1, p, q),
-                          d3 = getFrecheDistance(ca, i, j - 1, p, q);
-        PointPairDistance& minDist = (d1.getDistance() < d2.getDistance()) ? d1 : d2;
-        if(d3.getDistance() < minDist.getDistance()) {
-            minDist = d3;
-        }
-        ca[i][j] = (minDist.getDistance() > p_ptDist.getDistance()) ? minDist : p_ptDist;
+    std::vector<geom::Coordinate> pts;
+    pts.reserve(size);
+    for(std::size_t i = 0; i < size; i++) {
+        pts.push_back(getSegementAt(*seq, i));
     }
-
-    return ca[i][j];
+    return pts;
 }
 
+/*
+ * The coupling distance of (i, j) is the largest of the distance of
+ * the points and the smallest coupling distance of (i - 1, j),
+ * (i - 1, j - 1) and (i, j - 1), so only the previous row is kept.
+ */
 void
 DiscreteFrechetDistance::compute(
     const geom::Geometry& discreteGeom,
     const geom::Geometry& geom)
 {
-    auto lp = discreteGeom.getCoordinates();
-    auto lq = geom.getCoordinates();
-    size_t pSize, qSize;
-    if(densifyFrac > 0) {
-        size_t numSubSegs =  std::size_t(util::round(1.0 / densifyFrac));
-        pSize = numSubSegs * (lp->size() - 1) + 1;
-        qSize = numSubSegs * (lq->size() - 1) + 1;
+    std::vector<Coordinate> p = getPoints(discreteGeom);
+    std::vector<Coordinate> q = getPoints(geom);
+
+    std::vector<PointPairDistance> prevRow(q.size());
+    std::vector<PointPairDistance> row(q.size());
+    for(std::size_t i = 0; i < p.size(); i++) {
+        for(std::size_t j = 0; j < q.size(); j++) {
+            PointPairDistance pairDist;
+            pairDist.initialize(p[i], q[j]);
+            const PointPairDistance* minDist;
+            if(i == 0 && j == 0) {
+                row[j] = pairDist;
+                continue;
+            }
+            else if(j == 0) {
+                minDist = &prevRow[0];
+            }
+            else if(i == 0) {
+                minDist = &row[j - 1];
+            }
+            else {
+                minDist = (prevRow[j].getDistance() < prevRow[j - 1].getDistance()) ? &prevRow[j] : &prevRow[j - 1];
+                if(row[j - 1].getDistance() < minDist->getDistance()) {
+                    minDist = &row[j - 1];
+                }
+            }
+            row[j] = (minDist->getDistance() > pairDist.getDistance()) ? *minDist : pairDist;
+        }
+        std::swap(prevRow, row);
     }
-    else {
-        pSize = lp->size();
-        qSize = lq->size();
+    ptDist = prevRow.back();
+}
+
+/* static public */
+bool
+DiscreteFrechetDistance::isWithinDistance(const geom::Geometry& g0,
+        const geom::Geometry& g1,
+        double maxDistance)
+{
+    DiscreteFrechetDistance dist(g0, g1);
+    return dist.isWithinDistance(maxDistance);
+}
+
+/*
+ * A coupling (i, j) is reachable if its points are within the distance
+ * and one of (i - 1, j), (i - 1, j - 1) or (i, j - 1) is reachable.
+ * Reachable couplings are updated in place, row by row, over the band
+ * of columns reachable from the previous row.
+ */
+bool
+DiscreteFrechetDistance::isWithinDistance(double maxDistance)
+{
+    std::vector<Coordinate> p = getPoints(g0);
+    std::vector<Coordinate> q = getPoints(g1);
+
+    double maxDistSq = maxDistance * maxDistance;
+    if(p.front().distanceSquared(q.front()) > maxDistSq
+            || p.back().distanceSquared(q.back()) > maxDistSq) {
+        return false;
+    }
+
+    std::vector<char> isReachable(q.size(), false);
+    // band of reachable columns of the previous row
+    std::size_t minCol = 0;
+    std::size_t maxCol = 0;
+    for(std::size_t j = 0; j < q.size() && p[0].distanceSquared(q[j]) <= maxDistSq; j++) {
+        isReachable[j] = true;
+        maxCol = j;
     }
-    std::vector< std::vector<PointPairDistance> > ca(pSize, std::vector<PointPairDistance>(qSize));
-    for(size_t i = 0; i < pSize; i++) {
-        for(size_t j = 0; j < qSize; j++) {
-            ca[i][j].initialize();
+
+    for(std::size_t i = 1; i < p.size(); i++) {
+        bool isPrevReachable = false;
+        bool isLeftReachable = false;
+        std::size_t rowMinCol = q.size();
+        std::size_t rowMaxCol = 0;
+        for(std::size_t j = minCol; j < q.size(); j++) {
+            if(j > maxCol + 1 && !isLeftReachable) {
+                break;
+            }
+            bool isAboveReachable = isReachable[j] != 0;
+            bool reachable = (isAboveReachable || isPrevReachable || isLeftReachable)
+                             && p[i].distanceSquared(q[j]) <= maxDistSq;
+            isReachable[j] = reachable;
+            isPrevReachable = isAboveReachable;
+            isLeftReachable = reachable;
+            if(reachable) {
+                rowMinCol = std::min(rowMinCol, j);
+                rowMaxCol = j;
+            }
+        }
+        if(rowMinCol == q.size()) {
+            return false;
         }
+        minCol = rowMinCol;
+        maxCol = rowMaxCol;
     }
-    ptDist = getFrecheDistance(ca, pSize - 1, qSize - 1, *lp, *lq);
+    return isReachable.back() != 0;
 }
 
 } // namespace geos.algorithm.distance
@@ -0,0 +1,309 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/distance/IndexedHausdorffDistance.h>
+#include <geos/algorithm/Distance.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFilter.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/operation/distance/FacetSequence.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::distance::FacetSequence;
+using geos::operation::distance::IndexedFacetDistance;
+
+namespace geos {
+namespace algorithm { // geos.algorithm
+namespace distance { // geos.algorithm.distance
+
+namespace {
+
+// fraction of the diagonal of the inputs used as the default tolerance
+const double DEFAULT_TOLERANCE_FRACTION = 1e-9;
+
+// A point with its distance to the other geometry, and the facet
+// sequence where it is reached
+struct Location {
+    Coordinate pt;
+    const FacetSequence* facet;
+    double dist;
+};
+
+// A segment, or part of a segment, with a bound on the distance
+// to the other geometry of any of its points
+struct Segment {
+    Location p;
+    Location q;
+    double upper;
+
+    bool
+    operator<(const Segment& other) const
+    {
+        return upper < other.upper;
+    }
+};
+
+Location
+locate(const Coordinate& pt, const IndexedFacetDistance& other)
+{
+    const FacetSequence* facet = other.nearestFacet(pt);
+    double dist;
+    if(facet->isPoint()) {
+        dist = pt.distance(*facet->getCoordinate(0));
+    }
+    else {
+        dist = DoubleInfinity;
+        for(std::size_t i = 1; i < facet->size(); i++) {
+            dist = std::min(dist, Distance::pointToSegment(pt,
+                            *facet->getCoordinate(i - 1), *facet->getCoordinate(i)));
+        }
+    }
+    return Location{ pt, facet, dist };
+}
+
+Coordinate
+nearestPoint(const Coordinate& pt, const FacetSequence& facet)
+{
+    if(facet.isPoint()) {
+        return *facet.getCoordinate(0);
+    }
+    Coordinate nearest;
+    double minDist = DoubleInfinity;
+    for(std::size_t i = 1; i < facet.size(); i++) {
+        LineSegment seg(*facet.getCoordinate(i - 1), *facet.getCoordinate(i));
+        Coordinate segPt;
+        seg.closestPoint(pt, segPt);
+        double dist = pt.distance(segPt);
+        if(dist < minDist) {
+            minDist = dist;
+            nearest = segPt;
+        }
+    }
+    return nearest;
+}
+
+/*
+ * The distance to a single segment is convex along a line, so its
+ * maximum over a segment is reached at an endpoint. Any segment of
+ * the facets thus bounds the distance to the whole geometry.
+ */
+double
+facetBound(const Coordinate& p, const Coordinate& q, const FacetSequence& facet)
+{
+    if(facet.isPoint()) {
+        const Coordinate& c = *facet.getCoordinate(0);
+        return std::max(p.distance(c), q.distance(c));
+    }
+    double bound = DoubleInfinity;
+    for(std::size_t i = 1; i < facet.size(); i++) {
+        const Coordinate& c0 = *facet.getCoordinate(i - 1);
+        const Coordinate& c1 = *facet.getCoordinate(i);
+        bound = std::min(bound, std::max(Distance::pointToSegment(p, c0, c1),
+                                         Distance::pointToSegment(q, c0, c1)));
+    }
+    return bound;
+}
+
+Segment
+createSegment(const Location& p, const Location& q)
+{
+    // the distance to a geometry is 1-Lipschitz
+    double upper = (p.dist + q.dist + p.pt.distance(q.pt)) / 2;
+    upper = std::min(upper, facetBound(p.pt, q.pt, *p.facet));
+    if(q.facet != p.facet) {
+        upper = std::min(upper, facetBound(p.pt, q.pt, *q.facet));
+    }
+    return Segment{ p, q, upper };
+}
+
+/*
+ * Computes the distance of every vertex to the other geometry,
+ * collecting the segments between them on the way.
+ */
+class VertexDistanceFilter : public CoordinateSequenceFilter {
+public:
+    VertexDistanceFilter(const IndexedFacetDistance& p_other, std::vector<Segment>& p_segments)
+        : other(p_other)
+        , segments(p_segments)
+        , maxLoc{ Coordinate(), nullptr, -1.0 }
+    {}
+
+    void
+    filter_ro(const CoordinateSequence& seq, std::size_t index) override
+    {
+        Location loc = locate(seq.getAt(index), other);
+        if(loc.dist > maxLoc.dist) {
+            maxLoc = loc;
+        }
+        if(index > 0 && !prevLoc.pt.equals2D(loc.pt)) {
+            segments.push_back(createSegment(prevLoc, loc));
+        }
+        prevLoc = loc;
+    }
+
+    bool
+    isDone() const override
+    {
+        return false;
+    }
+
+    bool
+    isGeometryChanged() const override
+    {
+        return false;
+    }
+
+    const Location&
+    getMaximum() const
+    {
+        return maxLoc;
+    }
+
+private:
+    const IndexedFacetDistance& other;
+    std::vector<Segment>& segments;
+    Location maxLoc;
+    Location prevLoc;
+};
+
+} // anonymous namespace
+
+/* static public */
+double
+IndexedHausdorffDistance::distance(const geom::Geometry& g0,
+                                   const geom::Geometry& g1)
+{
+    IndexedHausdorffDistance dist(g0, g1);
+    return dist.distance();
+}
+
+/* static public */
+double
+IndexedHausdorffDistance::distance(const geom::Geometry& g0,
+                                   const geom::Geometry& g1,
+                                   double tolerance)
+{
+    IndexedHausdorffDistance dist(g0, g1);
+    dist.setTolerance(tolerance);
+    return dist.distance();
+}
+
+/* public */
+void
+IndexedHausdorffDistance::setTolerance(double p_tolerance)
+{
+    if(p_tolerance < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+    tolerance = p_tolerance;
+}
+
+/* public */
+double
+IndexedHausdorffDistance::distance()
+{
+    if(g0.isEmpty() || g1.isEmpty()) {
+        return 0.0;
+    }
+    double tol = computeTolerance();
+    IndexedFacetDistance facetDist0(&g0);
+    IndexedFacetDistance facetDist1(&g1);
+    computeOrientedDistance(g0, facetDist1, tol);
+    computeOrientedDistance(g1, facetDist0, tol);
+    return ptDist.getDistance();
+}
+
+/* public */
+double
+IndexedHausdorffDistance::orientedDistance()
+{
+    if(g0.isEmpty() || g1.isEmpty()) {
+        return 0.0;
+    }
+    IndexedFacetDistance facetDist1(&g1);
+    computeOrientedDistance(g0, facetDist1, computeTolerance());
+    return ptDist.getDistance();
+}
+
+/* private */
+double
+IndexedHausdorffDistance::computeTolerance() const
+{
+    if(tolerance > 0.0) {
+        return tolerance;
+    }
+    Envelope env(*g0.getEnvelopeInternal());
+    env.expandToInclude(g1.getEnvelopeInternal());
+    return DEFAULT_TOLERANCE_FRACTION * std::sqrt(env.getWidth() * env.getWidth()
+            + env.getHeight() * env.getHeight());
+}
+
+/* private */
+void
+IndexedHausdorffDistance::computeOrientedDistance(const geom::Geometry& g,
+        const IndexedFacetDistance& other, double tol)
+{
+    // the vertex distances are the discrete Hausdorff distance,
+    // a lower bound for the segments
+    std::vector<Segment> segments;
+    VertexDistanceFilter filter(other, segments);
+    g.apply_ro(filter);
+    Location maxLoc = filter.getMaximum();
+
+    std::priority_queue<Segment> queue;
+    for(const Segment& seg : segments) {
+        if(seg.upper > maxLoc.dist + tol) {
+            queue.push(seg);
+        }
+    }
+    segments.clear();
+
+    // split the segment which may be farthest until the bound of
+    // every remaining segment is within the tolerance
+    while(!queue.empty()) {
+        Segment seg = queue.top();
+        queue.pop();
+        if(seg.upper <= maxLoc.dist + tol) {
+            break;
+        }
+
+        Coordinate mid((seg.p.pt.x + seg.q.pt.x) / 2, (seg.p.pt.y + seg.q.pt.y) / 2);
+        Location midLoc = locate(mid, other);
+        if(midLoc.dist > maxLoc.dist) {
+            maxLoc = midLoc;
+        }
+
+        Segment half0 = createSegment(seg.p, midLoc);
+        if(half0.upper > maxLoc.dist + tol) {
+            queue.push(half0);
+        }
+        Segment half1 = createSegment(midLoc, seg.q);
+        if(half1.upper > maxLoc.dist + tol) {
+            queue.push(half1);
+        }
+    }
+
+    ptDist.setMaximum(maxLoc.pt, nearestPoint(maxLoc.pt, *maxLoc.facet));
+}
+
+} // namespace geos.algorithm.distance
+} // namespace geos.algorithm
+} // namespace geos
@@ -16,6 +16,7 @@
 #pragma warning(disable:4355)
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <sstream>
@@ -61,9 +62,9 @@ EdgeGraph::addEdge(const Coordinate& orig, const Coordinate& dest)
      * Otherwise, use a found edge with same origin (if any) to construct new edge.
      */
     HalfEdge* eAdj = nullptr;
-    auto it = vertexMap.find(orig);
-    if (it != vertexMap.end()) {
-        eAdj = it->second;
+    HalfEdge** found = vertexMap.find(orig);
+    if (found != nullptr) {
+        eAdj = *found;
     }
 
     HalfEdge* eSame = nullptr;
@@ -100,9 +101,9 @@ EdgeGraph::insert(const Coordinate& orig, const Coordinate& dest, HalfEdge* eAdj
     }
 
     HalfEdge* eAdjDest = nullptr;
-    auto it = vertexMap.find(dest);
-    if (it != vertexMap.end()) {
-        eAdjDest = it->second;
+    HalfEdge** found = vertexMap.find(dest);
+    if (found != nullptr) {
+        eAdjDest = *found;
     }
     if (eAdjDest != nullptr) {
         eAdjDest->insert(e->sym());
@@ -117,9 +118,15 @@ EdgeGraph::insert(const Coordinate& orig, const Coordinate& dest, HalfEdge* eAdj
 void
 EdgeGraph::getVertexEdges(std::vector<const HalfEdge*>& edgesOut)
 {
+    std::size_t start = edgesOut.size();
     for (auto it = vertexMap.begin(); it != vertexMap.end(); ++it) {
         edgesOut.push_back(it->second);
     }
+    // the vertex map iterates in insertion order
+    std::sort(edgesOut.begin() + static_cast<std::ptrdiff_t>(start), edgesOut.end(),
+    [](const HalfEdge* a, const HalfEdge* b) {
+        return a->orig().compareTo(b->orig()) < 0;
+    });
     return;
 }
 
@@ -128,9 +135,9 @@ HalfEdge*
 EdgeGraph::findEdge(const Coordinate& orig, const Coordinate& dest)
 {
     HalfEdge* e = nullptr;
-    auto it = vertexMap.find(orig);
-    if (it != vertexMap.end()) {
-        e = it->second;
+    HalfEdge** found = vertexMap.find(orig);
+    if (found != nullptr) {
+        e = *found;
     }
     if (e == nullptr) {
         return nullptr;
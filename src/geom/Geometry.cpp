@@ -159,12 +159,7 @@ Geometry::isWithinDistance(const Geometry* geom, double cDistance) const
     if(envDist > cDistance) {
         return false;
     }
-    // NOTE: this could be implemented more efficiently
-    double geomDist = distance(geom);
-    if(geomDist > cDistance) {
-        return false;
-    }
-    return true;
+    return DistanceOp::isWithinDistance(*this, *geom, cDistance);
 }
 
 /*public*/
@@ -19,6 +19,8 @@
 
 #include <geos/geom/prep/BasicPreparedGeometry.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Point.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/geom/util/ComponentCoordinateExtracter.h>
 #include <geos/operation/distance/DistanceOp.h>
@@ -163,6 +165,36 @@ BasicPreparedGeometry::distance(const geom::Geometry* g) const
     return coords->getAt(0).distance( coords->getAt(1) );
 }
 
+bool
+BasicPreparedGeometry::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    if(baseGeom->isEmpty() || g->isEmpty()) {
+        return false;
+    }
+    return operation::distance::DistanceOp::isWithinDistance(*baseGeom, *g, dist);
+}
+
+void
+BasicPreparedGeometry::distance(const double* x, const double* y, std::size_t n,
+                                double* distances) const
+{
+    for(std::size_t i = 0; i < n; i++) {
+        std::unique_ptr<geom::Point> pt(baseGeom->getFactory()->createPoint(geom::Coordinate(x[i], y[i])));
+        distances[i] = distance(pt.get());
+    }
+}
+
+void
+BasicPreparedGeometry::isWithinDistance(const double* x, const double* y, std::size_t n,
+                                        double maxDistance, bool* results) const
+{
+    std::vector<double> distances(n);
+    distance(x, y, n, distances.data());
+    for(std::size_t i = 0; i < n; i++) {
+        results[i] = distances[i] <= maxDistance;
+    }
+}
+
 std::string
 BasicPreparedGeometry::toString()
 {
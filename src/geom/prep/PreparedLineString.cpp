@@ -91,6 +91,29 @@ PreparedLineString::distance(const geom::Geometry* g) const
     return PreparedLineStringDistance::distance(*this, g);
 }
 
+bool
+PreparedLineString::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    PreparedLineStringDistance op(*this);
+    return op.isWithinDistance(g, dist);
+}
+
+void
+PreparedLineString::distance(const double* x, const double* y, std::size_t n,
+                             double* distances) const
+{
+    PreparedLineStringDistance op(*this);
+    op.distance(x, y, n, distances);
+}
+
+void
+PreparedLineString::isWithinDistance(const double* x, const double* y, std::size_t n,
+                                     double maxDistance, bool* results) const
+{
+    PreparedLineStringDistance op(*this);
+    op.isWithinDistance(x, y, n, maxDistance, results);
+}
+
 
 } // namespace geos.geom.prep
 } // namespace geos.geom
@@ -19,6 +19,12 @@
 
 #include <geos/geom/prep/PreparedLineString.h>
 #include <geos/geom/prep/PreparedLineStringDistance.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+
+#include <algorithm>
+#include <limits>
 
 namespace geos {
 namespace geom { // geos.geom
@@ -40,6 +46,52 @@ PreparedLineStringDistance::distance(const geom::Geometry* g) const
     return idf->distance(g);
 }
 
+bool
+PreparedLineStringDistance::isWithinDistance(const geom::Geometry* g, double maxDistance) const
+{
+    if(prepLine.getGeometry().isEmpty() || g->isEmpty()) {
+        return false;
+    }
+    if(prepLine.getGeometry().getEnvelopeInternal()->distance(*g->getEnvelopeInternal()) > maxDistance) {
+        return false;
+    }
+
+    operation::distance::IndexedFacetDistance* idf = prepLine.getIndexedFacetDistance();
+    if(idf->isWithinDistance(g, maxDistance)) {
+        return true;
+    }
+    // the facets are too far apart, so only containment is left
+    return prepLine.intersects(g);
+}
+
+void
+PreparedLineStringDistance::distance(const double* x, const double* y, std::size_t n,
+                                     double* distances) const
+{
+    if(prepLine.getGeometry().isEmpty()) {
+        std::fill(distances, distances + n, std::numeric_limits<double>::infinity());
+        return;
+    }
+
+    operation::distance::IndexedFacetDistance* idf = prepLine.getIndexedFacetDistance();
+    idf->distance(x, y, n, distances);
+}
+
+void
+PreparedLineStringDistance::isWithinDistance(const double* x, const double* y, std::size_t n,
+        double maxDistance, bool* results) const
+{
+    if(prepLine.getGeometry().isEmpty()) {
+        std::fill(results, results + n, false);
+        return;
+    }
+
+    operation::distance::IndexedFacetDistance* idf = prepLine.getIndexedFacetDistance();
+    for(std::size_t i = 0; i < n; i++) {
+        results[i] = idf->isWithinDistance(Coordinate(x[i], y[i]), maxDistance);
+    }
+}
+
 
 } // namespace geos.geom.prep
 } // namespace geos.geom
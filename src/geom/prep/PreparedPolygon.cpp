@@ -161,6 +161,29 @@ PreparedPolygon::distance(const geom::Geometry* g) const
     return PreparedPolygonDistance::distance(*this, g);
 }
 
+bool
+PreparedPolygon::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    PreparedPolygonDistance op(*this);
+    return op.isWithinDistance(g, dist);
+}
+
+void
+PreparedPolygon::distance(const double* x, const double* y, std::size_t n,
+                          double* distances) const
+{
+    PreparedPolygonDistance op(*this);
+    op.distance(x, y, n, distances);
+}
+
+void
+PreparedPolygon::isWithinDistance(const double* x, const double* y, std::size_t n,
+                                  double maxDistance, bool* results) const
+{
+    PreparedPolygonDistance op(*this);
+    op.isWithinDistance(x, y, n, maxDistance, results);
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
@@ -19,10 +19,16 @@
 #include <geos/geom/prep/PreparedPolygonDistance.h>
 #include <geos/geom/prep/PreparedPolygon.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/Location.h>
 
 // std
+#include <algorithm>
 #include <cstddef>
+#include <limits>
+#include <vector>
 
 namespace geos {
 namespace geom { // geos.geom
@@ -43,6 +49,75 @@ PreparedPolygonDistance::distance(const geom::Geometry* g) const
     return idf->distance(g);
 }
 
+bool
+PreparedPolygonDistance::isWithinDistance(const geom::Geometry* g, double maxDistance) const
+{
+    if(prepPoly.getGeometry().isEmpty() || g->isEmpty()) {
+        return false;
+    }
+    if(prepPoly.getGeometry().getEnvelopeInternal()->distance(*g->getEnvelopeInternal()) > maxDistance) {
+        return false;
+    }
+
+    operation::distance::IndexedFacetDistance* idf = prepPoly.getIndexedFacetDistance();
+    if(idf->isWithinDistance(g, maxDistance)) {
+        return true;
+    }
+    // the facets are too far apart, so only containment is left
+    return prepPoly.intersects(g);
+}
+
+void
+PreparedPolygonDistance::distance(const double* x, const double* y, std::size_t n,
+                                  double* distances) const
+{
+    if(prepPoly.getGeometry().isEmpty()) {
+        std::fill(distances, distances + n, std::numeric_limits<double>::infinity());
+        return;
+    }
+
+    // the points outside the polygon are measured together
+    algorithm::locate::PointOnGeometryLocator* locator = prepPoly.getPointLocator();
+    std::vector<double> extX;
+    std::vector<double> extY;
+    std::vector<std::size_t> extIndex;
+    for(std::size_t i = 0; i < n; i++) {
+        Coordinate pt(x[i], y[i]);
+        if(locator->locate(&pt) != Location::EXTERIOR) {
+            distances[i] = 0.0;
+            continue;
+        }
+        extX.push_back(x[i]);
+        extY.push_back(y[i]);
+        extIndex.push_back(i);
+    }
+
+    std::vector<double> extDistances(extIndex.size());
+    operation::distance::IndexedFacetDistance* idf = prepPoly.getIndexedFacetDistance();
+    idf->distance(extX.data(), extY.data(), extIndex.size(), extDistances.data());
+    for(std::size_t i = 0; i < extIndex.size(); i++) {
+        distances[extIndex[i]] = extDistances[i];
+    }
+}
+
+void
+PreparedPolygonDistance::isWithinDistance(const double* x, const double* y, std::size_t n,
+        double maxDistance, bool* results) const
+{
+    if(prepPoly.getGeometry().isEmpty()) {
+        std::fill(results, results + n, false);
+        return;
+    }
+
+    algorithm::locate::PointOnGeometryLocator* locator = prepPoly.getPointLocator();
+    operation::distance::IndexedFacetDistance* idf = prepPoly.getIndexedFacetDistance();
+    for(std::size_t i = 0; i < n; i++) {
+        Coordinate pt(x[i], y[i]);
+        results[i] = locator->locate(&pt) != Location::EXTERIOR
+                     || idf->isWithinDistance(pt, maxDistance);
+    }
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
@@ -68,8 +68,15 @@ NodeMap::addNode(const Coordinate& coord)
         node = nodeFact.createNode(coord);
         Coordinate* c = const_cast<Coordinate*>(
                             &(node->getCoordinate()));
-        nodeMap[c] = node;
-        //nodeMap[const_cast<Coordinate *>(&coord)]=node;
+        auto inserted = nodeMap.insert(pair(c, node));
+        if(inserted.second) {
+            nodeIndex.insert(*c, node);
+        }
+        else {
+            // NaN ordinates are not hashed alike, but ordered alike
+            delete node;
+            node = inserted.first->second;
+        }
     }
     else {
 #if GEOS_DEBUG
@@ -93,11 +100,16 @@ NodeMap::addNode(Node* n)
     Coordinate* c = const_cast<Coordinate*>(&n->getCoordinate());
     Node* node = find(*c);
     if(node == nullptr) {
+        auto inserted = nodeMap.insert(pair(c, n));
+        if(inserted.second) {
 #if GEOS_DEBUG
-        cerr << " is new" << endl;
+            cerr << " is new" << endl;
 #endif
-        nodeMap[c] = n;
-        return n;
+            nodeIndex.insert(*c, n);
+            return n;
+        }
+        // NaN ordinates are not hashed alike, but ordered alike
+        node = inserted.first->second;
     }
 #if GEOS_DEBUG
     else {
@@ -127,15 +139,13 @@ NodeMap::add(EdgeEnd* e)
 Node*
 NodeMap::find(const Coordinate& coord) const
 {
-    Coordinate* c = const_cast<Coordinate*>(&coord);
-
-    NodeMap::const_iterator found = nodeMap.find(c);
+    Node* const* found = nodeIndex.find(coord);
 
-    if(found == nodeMap.end()) {
+    if(found == nullptr) {
         return nullptr;
     }
     else {
-        return found->second;
+        return *found;
     }
 }
 
@@ -237,6 +237,8 @@ STRtree::nearestNeighbour(BoundablePair* initBndPair, double maxDistance)
 bool
 STRtree::isWithinDistance(STRtree* tree, ItemDistance* itemDist, double maxDistance)
 {
+    build();
+    tree->build();
     BoundablePair bp(getRoot(), tree->getRoot(), itemDist);
     return isWithinDistance(&bp, maxDistance);
 }
@@ -245,6 +247,7 @@ STRtree::isWithinDistance(STRtree* tree, ItemDistance* itemDist, double maxDista
 bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
 {
     double distanceUpperBound = std::numeric_limits<double>::infinity();
+    bool isWithin = false;
 
     // initialize search queue
     BoundablePair::BoundablePairQueue priQ;
@@ -262,7 +265,9 @@ bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
          * and terminate with false
          */
         if (currentDistance > maxDistance)
-            return false;
+            break;
+
+        priQ.pop();
 
         /*
          * There must be some pair of items in the nodes which
@@ -272,21 +277,21 @@ bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
          * NOTE: using the Envelope MinMaxDistance would provide a tighter bound,
          * but not sure how to compute this!
          */
-        if (bndPair->maximumDistance() <= maxDistance)
-            return true;
-
+        if (bndPair->maximumDistance() <= maxDistance) {
+            isWithin = true;
+        }
         /*
          * If the pair members are leaves
          * then their distance is an upper bound.
          * Update the distanceUpperBound to reflect this
          */
-        if (bndPair->isLeaves()) {
+        else if (bndPair->isLeaves()) {
             distanceUpperBound = currentDistance;
 
             // Current pair is closer than maxDistance
             // so can terminate with true
             if (distanceUpperBound <= maxDistance)
-                return true;
+                isWithin = true;
         }
         else {
             /*
@@ -296,8 +301,25 @@ bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
              */
             bndPair->expandToQueue(priQ, distanceUpperBound);
         }
+
+        if(bndPair != initBndPair) {
+            delete bndPair;
+        }
+        if(isWithin) {
+            break;
+        }
     }
-    return false;
+
+    /* Free any remaining BoundablePairs in the queue */
+    while(!priQ.empty()) {
+        BoundablePair* bndPair = priQ.top();
+        priQ.pop();
+        if(bndPair != initBndPair) {
+            delete bndPair;
+        }
+    }
+
+    return isWithin;
 }
 
 
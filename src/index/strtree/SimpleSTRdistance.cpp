@@ -63,9 +63,44 @@ SimpleSTRdistance::nearestNeighbour(SimpleSTRpair* p_initPair)
 }
 
 
+/*public*/
+std::pair<const void*, const void*>
+SimpleSTRdistance::nearestNeighbour(double maxDistance)
+{
+    SimpleSTRpair* minPair = nearestPair(initPair, maxDistance);
+
+    // the initial pair is searched whatever its distance
+    if(!minPair || minPair->getDistance() >= maxDistance) {
+        return std::pair<const void*, const void*>(nullptr, nullptr);
+    }
+
+    const void* item0 = minPair->getNode(0)->getItem();
+    const void* item1 = minPair->getNode(1)->getItem();
+
+    return std::pair<const void*, const void*>(item0, item1);
+}
+
+
 /*private*/
 std::pair<const void*, const void*>
 SimpleSTRdistance::nearestNeighbour(SimpleSTRpair* p_initPair, double maxDistance)
+{
+    SimpleSTRpair* minPair = nearestPair(p_initPair, maxDistance);
+
+    if(!minPair) {
+        throw util::GEOSException("Error computing nearest neighbor");
+    }
+
+    const void* item0 = minPair->getNode(0)->getItem();
+    const void* item1 = minPair->getNode(1)->getItem();
+
+    return std::pair<const void*, const void*>(item0, item1);
+}
+
+
+/*private*/
+SimpleSTRpair*
+SimpleSTRdistance::nearestPair(SimpleSTRpair* p_initPair, double maxDistance)
 {
     double distanceLowerBound = maxDistance;
     SimpleSTRpair* minPair = nullptr;
@@ -118,14 +153,7 @@ SimpleSTRdistance::nearestNeighbour(SimpleSTRpair* p_initPair, double maxDistanc
         priQ.pop();
     }
 
-    if(!minPair) {
-        throw util::GEOSException("Error computing nearest neighbor");
-    }
-
-    const void* item0 = minPair->getNode(0)->getItem();
-    const void* item1 = minPair->getNode(1)->getItem();
-
-    return std::pair<const void*, const void*>(item0, item1);
+    return minPair;
 }
 
 
@@ -139,6 +167,21 @@ SimpleSTRdistance::expandToQueue(SimpleSTRpair* pair, STRpairQueue& priQ, double
     bool isComp1 = node1->isComposite();
     bool isComp2 = node2->isComposite();
 
+    /**
+     * A node paired with itself, when searching a tree against
+     * itself: as the item distance is symmetric, pair each
+     * two children once only.
+     */
+    if (isComp1 && node1 == node2) {
+        auto& children = node1->getChildNodes();
+        for (std::size_t i = 0; i < children.size(); i++) {
+            for (std::size_t j = i; j < children.size(); j++) {
+                addToQueue(children[i], children[j], priQ, minDistance);
+            }
+        }
+        return;
+    }
+
     /**
      * HEURISTIC: If both boundable are composite,
      * choose the one with largest area to expand.
@@ -171,23 +214,37 @@ void
 SimpleSTRdistance::expand(SimpleSTRnode* nodeComposite, SimpleSTRnode* nodeOther,
     bool isFlipped, STRpairQueue& priQ, double minDistance)
 {
-    auto children = nodeComposite->getChildNodes();
+    auto& children = nodeComposite->getChildNodes();
     for (auto* child: children) {
-        SimpleSTRpair* sp = nullptr;
         if (isFlipped) {
-            sp = createPair(nodeOther, child, itemDistance);
+            addToQueue(nodeOther, child, priQ, minDistance);
         }
         else {
-            sp = createPair(child, nodeOther, itemDistance);
-        }
-        // only add to queue if this pair might contain the closest points
-        // MD - it's actually faster to construct the object rather than called distance(child, nodeOther)!
-        if (sp->getDistance() < minDistance) {
-            priQ.push(sp);
+            addToQueue(child, nodeOther, priQ, minDistance);
         }
     }
 }
 
+
+void
+SimpleSTRdistance::addToQueue(SimpleSTRnode* p_node1, SimpleSTRnode* p_node2,
+    STRpairQueue& priQ, double minDistance)
+{
+    // the item distance is the costly part, and is no less than the
+    // distance of the bounds, so skip items whose bounds are too far apart
+    if (p_node1->isLeaf() && p_node2->isLeaf() &&
+        p_node1->getEnvelope().distance(p_node2->getEnvelope()) >= minDistance) {
+        return;
+    }
+
+    SimpleSTRpair* sp = createPair(p_node1, p_node2, itemDistance);
+    // only add to queue if this pair might contain the closest points
+    // MD - it's actually faster to construct the object rather than called distance(child, nodeOther)!
+    if (sp->getDistance() < minDistance) {
+        priQ.push(sp);
+    }
+}
+
 /* public */
 bool
 SimpleSTRdistance::isWithinDistance(double maxDistance)
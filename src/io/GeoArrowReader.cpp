@@ -0,0 +1,265 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+
+#include <cmath>
+#include <sstream>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+/*
+ * Checks that offsets[0..count] is a non-decreasing sequence of
+ * indexes into an array of size limit, and returns offsets[count],
+ * which is the number of items addressed at the next level.
+ */
+std::size_t
+checkOffsets(const int32_t* offsets, std::size_t count, std::size_t limit, const char* name)
+{
+    if(offsets == nullptr) {
+        throw ParseException(std::string("GeoArrow: missing ") + name);
+    }
+    if(offsets[0] < 0) {
+        throw ParseException(std::string("GeoArrow: negative offset in ") + name);
+    }
+    for(std::size_t i = 0; i < count; i++) {
+        if(offsets[i + 1] < offsets[i]) {
+            std::ostringstream s;
+            s << "GeoArrow: decreasing offset at index " << i + 1 << " of " << name;
+            throw ParseException(s.str());
+        }
+    }
+    if(static_cast<std::size_t>(offsets[count]) > limit) {
+        std::ostringstream s;
+        s << "GeoArrow: " << name << " addresses " << offsets[count]
+          << " items, only " << limit << " available";
+        throw ParseException(s.str());
+    }
+    return static_cast<std::size_t>(offsets[count]);
+}
+
+/*
+ * Checks the coordinate buffers and all the offset levels used by
+ * the column type.
+ */
+void
+checkBuffers(const GeoArrowBuffers& b)
+{
+    if(b.numCoords > 0 && (b.x == nullptr || b.y == nullptr || (b.hasZ && b.z == nullptr))) {
+        throw ParseException("GeoArrow: missing coordinate buffer");
+    }
+    if(b.stride == 0) {
+        throw ParseException("GeoArrow: coordinate stride must be positive");
+    }
+
+    switch(b.type) {
+    case GEOS_POINT:
+        if(b.numGeoms > b.numCoords) {
+            throw ParseException("GeoArrow: fewer coordinates than points");
+        }
+        break;
+    case GEOS_LINESTRING:
+    case GEOS_LINEARRING:
+    case GEOS_MULTIPOINT:
+        checkOffsets(b.geomOffsets, b.numGeoms, b.numCoords, "geometry offsets");
+        break;
+    case GEOS_POLYGON: {
+        std::size_t numRings = checkOffsets(b.geomOffsets, b.numGeoms, SIZE_MAX, "geometry offsets");
+        checkOffsets(b.ringOffsets, numRings, b.numCoords, "ring offsets");
+        break;
+    }
+    case GEOS_MULTILINESTRING: {
+        std::size_t numParts = checkOffsets(b.geomOffsets, b.numGeoms, SIZE_MAX, "geometry offsets");
+        checkOffsets(b.partOffsets, numParts, b.numCoords, "part offsets");
+        break;
+    }
+    case GEOS_MULTIPOLYGON: {
+        std::size_t numParts = checkOffsets(b.geomOffsets, b.numGeoms, SIZE_MAX, "geometry offsets");
+        std::size_t numRings = checkOffsets(b.partOffsets, numParts, SIZE_MAX, "part offsets");
+        checkOffsets(b.ringOffsets, numRings, b.numCoords, "ring offsets");
+        break;
+    }
+    default:
+        throw ParseException("GeoArrow: unsupported geometry type");
+    }
+}
+
+} // anonymous namespace
+
+GeoArrowReader::GeoArrowReader(const GeometryFactory& f)
+    : factory(f)
+{}
+
+GeoArrowReader::GeoArrowReader()
+    : GeoArrowReader(*(GeometryFactory::getDefaultInstance()))
+{}
+
+std::vector<std::unique_ptr<Geometry>>
+GeoArrowReader::read(const GeoArrowBuffers& buffers) const
+{
+    checkBuffers(buffers);
+
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.reserve(buffers.numGeoms);
+    for(std::size_t i = 0; i < buffers.numGeoms; i++) {
+        geoms.push_back(readGeometry(buffers, i));
+    }
+    return geoms;
+}
+
+std::unique_ptr<Geometry>
+GeoArrowReader::readGeometry(const GeoArrowBuffers& b, std::size_t i) const
+{
+    switch(b.type) {
+    case GEOS_POINT:
+        return readPoint(b, i);
+    case GEOS_LINESTRING:
+    case GEOS_LINEARRING:
+        return readLineString(b, b.geomOffsets, i);
+    case GEOS_POLYGON:
+        return readPolygon(b, b.geomOffsets, i);
+    case GEOS_MULTIPOINT: {
+        std::size_t start = static_cast<std::size_t>(b.geomOffsets[i]);
+        std::size_t end = static_cast<std::size_t>(b.geomOffsets[i + 1]);
+        std::vector<std::unique_ptr<Point>> points;
+        points.reserve(end - start);
+        for(std::size_t j = start; j < end; j++) {
+            points.push_back(readPoint(b, j));
+        }
+        return factory.createMultiPoint(std::move(points));
+    }
+    case GEOS_MULTILINESTRING: {
+        std::size_t start = static_cast<std::size_t>(b.geomOffsets[i]);
+        std::size_t end = static_cast<std::size_t>(b.geomOffsets[i + 1]);
+        std::vector<std::unique_ptr<LineString>> lines;
+        lines.reserve(end - start);
+        for(std::size_t j = start; j < end; j++) {
+            lines.push_back(readLineString(b, b.partOffsets, j));
+        }
+        return factory.createMultiLineString(std::move(lines));
+    }
+    case GEOS_MULTIPOLYGON: {
+        std::size_t start = static_cast<std::size_t>(b.geomOffsets[i]);
+        std::size_t end = static_cast<std::size_t>(b.geomOffsets[i + 1]);
+        std::vector<std::unique_ptr<Polygon>> polys;
+        polys.reserve(end - start);
+        for(std::size_t j = start; j < end; j++) {
+            polys.push_back(readPolygon(b, b.partOffsets, j));
+        }
+        return factory.createMultiPolygon(std::move(polys));
+    }
+    default:
+        throw ParseException("GeoArrow: unsupported geometry type");
+    }
+}
+
+std::unique_ptr<Point>
+GeoArrowReader::readPoint(const GeoArrowBuffers& b, std::size_t coordIndex) const
+{
+    const std::size_t k = coordIndex * b.stride;
+    double x = b.x[k];
+    double y = b.y[k];
+
+    // POINT EMPTY
+    if(std::isnan(x) && std::isnan(y)) {
+        return factory.createPoint(b.hasZ ? 3 : 2);
+    }
+
+    const PrecisionModel& pm = *factory.getPrecisionModel();
+    if(b.hasZ) {
+        return std::unique_ptr<Point>(factory.createPoint(
+                Coordinate(pm.makePrecise(x), pm.makePrecise(y), b.z[k])));
+    }
+    return std::unique_ptr<Point>(factory.createPoint(
+            Coordinate(pm.makePrecise(x), pm.makePrecise(y))));
+}
+
+std::unique_ptr<LineString>
+GeoArrowReader::readLineString(const GeoArrowBuffers& b, const int32_t* offsets, std::size_t i) const
+{
+    auto pts = readCoordinates(b,
+                               static_cast<std::size_t>(offsets[i]),
+                               static_cast<std::size_t>(offsets[i + 1]));
+    return factory.createLineString(std::move(pts));
+}
+
+std::unique_ptr<LinearRing>
+GeoArrowReader::readLinearRing(const GeoArrowBuffers& b, const int32_t* offsets, std::size_t i) const
+{
+    auto pts = readCoordinates(b,
+                               static_cast<std::size_t>(offsets[i]),
+                               static_cast<std::size_t>(offsets[i + 1]));
+    return factory.createLinearRing(std::move(pts));
+}
+
+std::unique_ptr<Polygon>
+GeoArrowReader::readPolygon(const GeoArrowBuffers& b, const int32_t* polyOffsets, std::size_t i) const
+{
+    std::size_t start = static_cast<std::size_t>(polyOffsets[i]);
+    std::size_t end = static_cast<std::size_t>(polyOffsets[i + 1]);
+
+    if(start == end) {
+        return factory.createPolygon(b.hasZ ? 3 : 2);
+    }
+
+    auto shell = readLinearRing(b, b.ringOffsets, start);
+    if(end - start == 1) {
+        return factory.createPolygon(std::move(shell));
+    }
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    holes.reserve(end - start - 1);
+    for(std::size_t j = start + 1; j < end; j++) {
+        holes.push_back(readLinearRing(b, b.ringOffsets, j));
+    }
+    return factory.createPolygon(std::move(shell), std::move(holes));
+}
+
+std::unique_ptr<CoordinateSequence>
+GeoArrowReader::readCoordinates(const GeoArrowBuffers& b, std::size_t start, std::size_t end) const
+{
+    const PrecisionModel& pm = *factory.getPrecisionModel();
+    const std::size_t stride = b.stride;
+
+    std::vector<Coordinate> coords(end - start);
+    for(std::size_t j = start; j < end; j++) {
+        const std::size_t k = j * stride;
+        Coordinate& c = coords[j - start];
+        c.x = pm.makePrecise(b.x[k]);
+        c.y = pm.makePrecise(b.y[k]);
+        if(b.hasZ) {
+            c.z = b.z[k];
+        }
+    }
+    return factory.getCoordinateSequenceFactory()->create(std::move(coords), b.hasZ ? 3 : 2);
+}
+
+} // namespace geos.io
+} // namespace geos
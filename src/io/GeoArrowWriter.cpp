@@ -0,0 +1,285 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoArrowWriter.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <limits>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+int32_t
+toOffset(std::size_t n)
+{
+    if(n > static_cast<std::size_t>(std::numeric_limits<int32_t>::max())) {
+        throw util::IllegalArgumentException("GeoArrowWriter: offset exceeds 32-bit range");
+    }
+    return static_cast<int32_t>(n);
+}
+
+} // anonymous namespace
+
+GeoArrowBuffers
+GeoArrowArray::buffers() const
+{
+    GeoArrowBuffers b;
+    b.type = type;
+    b.hasZ = hasZ;
+    b.numGeoms = numGeoms;
+    b.numCoords = getNumCoordinates();
+
+    const double* base = coords.data();
+    if(interleaved) {
+        b.stride = hasZ ? 3 : 2;
+        b.x = base;
+        b.y = base + 1;
+        b.z = hasZ ? base + 2 : nullptr;
+    }
+    else {
+        b.stride = 1;
+        b.x = base;
+        b.y = base + b.numCoords;
+        b.z = hasZ ? base + 2 * b.numCoords : nullptr;
+    }
+
+    b.geomOffsets = geomOffsets.empty() ? nullptr : geomOffsets.data();
+    b.partOffsets = partOffsets.empty() ? nullptr : partOffsets.data();
+    b.ringOffsets = ringOffsets.empty() ? nullptr : ringOffsets.data();
+    return b;
+}
+
+GeoArrowWriter::GeoArrowWriter(int dims, bool p_interleaved)
+    : outputDimension(2)
+    , interleaved(p_interleaved)
+{
+    setOutputDimension(dims);
+}
+
+void
+GeoArrowWriter::setOutputDimension(int dims)
+{
+    if(dims < 2 || dims > 3) {
+        throw util::IllegalArgumentException("GeoArrowWriter: dimension must be 2 or 3");
+    }
+    outputDimension = dims;
+}
+
+/* static private */
+GeometryTypeId
+GeoArrowWriter::columnType(const std::vector<const Geometry*>& geoms)
+{
+    int family = -1;
+    bool multi = false;
+
+    for(const Geometry* g : geoms) {
+        if(g == nullptr) {
+            continue;
+        }
+
+        int f;
+        switch(g->getGeometryTypeId()) {
+        case GEOS_POINT:
+            f = 0;
+            break;
+        case GEOS_MULTIPOINT:
+            f = 0;
+            multi = true;
+            break;
+        case GEOS_LINESTRING:
+        case GEOS_LINEARRING:
+            f = 1;
+            break;
+        case GEOS_MULTILINESTRING:
+            f = 1;
+            multi = true;
+            break;
+        case GEOS_POLYGON:
+            f = 2;
+            break;
+        case GEOS_MULTIPOLYGON:
+            f = 2;
+            multi = true;
+            break;
+        default:
+            if(g->isEmpty()) {
+                continue;
+            }
+            throw util::IllegalArgumentException("GeoArrowWriter: GeometryCollection cannot be written");
+        }
+
+        if(family >= 0 && family != f) {
+            throw util::IllegalArgumentException("GeoArrowWriter: mixed geometry types");
+        }
+        family = f;
+    }
+
+    switch(family) {
+    case 1:
+        return multi ? GEOS_MULTILINESTRING : GEOS_LINESTRING;
+    case 2:
+        return multi ? GEOS_MULTIPOLYGON : GEOS_POLYGON;
+    default:
+        return multi ? GEOS_MULTIPOINT : GEOS_POINT;
+    }
+}
+
+GeoArrowArray
+GeoArrowWriter::write(const std::vector<const Geometry*>& geoms) const
+{
+    GeoArrowArray out;
+    out.type = columnType(geoms);
+    out.hasZ = (outputDimension == 3);
+    out.interleaved = interleaved;
+    out.numGeoms = geoms.size();
+
+    if(out.type != GEOS_POINT) {
+        out.geomOffsets.reserve(geoms.size() + 1);
+        out.geomOffsets.push_back(0);
+    }
+    if(out.type == GEOS_MULTILINESTRING || out.type == GEOS_MULTIPOLYGON) {
+        out.partOffsets.push_back(0);
+    }
+    if(out.type == GEOS_POLYGON || out.type == GEOS_MULTIPOLYGON) {
+        out.ringOffsets.push_back(0);
+    }
+
+    for(const Geometry* g : geoms) {
+        // Null and empty collections are written as empty geometries
+        std::size_t n = (g == nullptr || g->getGeometryTypeId() == GEOS_GEOMETRYCOLLECTION) ? 0 : g->getNumGeometries();
+
+        switch(out.type) {
+        case GEOS_POINT:
+            writePoint(n ? static_cast<const Point*>(g) : nullptr, out);
+            break;
+        case GEOS_LINESTRING:
+            if(n) {
+                writeLineString(static_cast<const LineString*>(g), out.geomOffsets, out);
+            }
+            else {
+                out.geomOffsets.push_back(toOffset(out.getNumCoordinates()));
+            }
+            break;
+        case GEOS_POLYGON:
+            if(n) {
+                writePolygon(static_cast<const Polygon*>(g), out.geomOffsets, out);
+            }
+            else {
+                out.geomOffsets.push_back(toOffset(out.ringOffsets.size() - 1));
+            }
+            break;
+        case GEOS_MULTIPOINT:
+            for(std::size_t i = 0; i < n; i++) {
+                writePoint(static_cast<const Point*>(g->getGeometryN(i)), out);
+            }
+            out.geomOffsets.push_back(toOffset(out.getNumCoordinates()));
+            break;
+        case GEOS_MULTILINESTRING:
+            for(std::size_t i = 0; i < n; i++) {
+                writeLineString(static_cast<const LineString*>(g->getGeometryN(i)), out.partOffsets, out);
+            }
+            out.geomOffsets.push_back(toOffset(out.partOffsets.size() - 1));
+            break;
+        case GEOS_MULTIPOLYGON:
+            for(std::size_t i = 0; i < n; i++) {
+                writePolygon(static_cast<const Polygon*>(g->getGeometryN(i)), out.partOffsets, out);
+            }
+            out.geomOffsets.push_back(toOffset(out.partOffsets.size() - 1));
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Coordinates are accumulated interleaved, split them into planes if requested
+    if(!interleaved) {
+        const std::size_t dim = out.hasZ ? 3 : 2;
+        const std::size_t n = out.getNumCoordinates();
+        std::vector<double> planes(out.coords.size());
+        for(std::size_t i = 0; i < n; i++) {
+            for(std::size_t d = 0; d < dim; d++) {
+                planes[d * n + i] = out.coords[i * dim + d];
+            }
+        }
+        out.coords.swap(planes);
+    }
+
+    return out;
+}
+
+void
+GeoArrowWriter::writePoint(const Point* p, GeoArrowArray& out) const
+{
+    if(p == nullptr || p->isEmpty()) {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        out.coords.push_back(nan);
+        out.coords.push_back(nan);
+        if(out.hasZ) {
+            out.coords.push_back(nan);
+        }
+        return;
+    }
+
+    const Coordinate* c = p->getCoordinate();
+    out.coords.push_back(c->x);
+    out.coords.push_back(c->y);
+    if(out.hasZ) {
+        out.coords.push_back(c->z);
+    }
+}
+
+void
+GeoArrowWriter::writeLineString(const LineString* ls, std::vector<int32_t>& offsets,
+                                GeoArrowArray& out) const
+{
+    writeCoordinates(*ls->getCoordinatesRO(), out);
+    offsets.push_back(toOffset(out.getNumCoordinates()));
+}
+
+void
+GeoArrowWriter::writePolygon(const Polygon* poly, std::vector<int32_t>& offsets,
+                             GeoArrowArray& out) const
+{
+    if(!poly->isEmpty()) {
+        writeLineString(poly->getExteriorRing(), out.ringOffsets, out);
+        for(std::size_t i = 0, n = poly->getNumInteriorRing(); i < n; i++) {
+            writeLineString(poly->getInteriorRingN(i), out.ringOffsets, out);
+        }
+    }
+    offsets.push_back(toOffset(out.ringOffsets.size() - 1));
+}
+
+void
+GeoArrowWriter::writeCoordinates(const CoordinateSequence& cs, GeoArrowArray& out) const
+{
+    const std::size_t n = cs.size();
+    for(std::size_t i = 0; i < n; i++) {
+        const Coordinate& c = cs.getAt(i);
+        out.coords.push_back(c.x);
+        out.coords.push_back(c.y);
+        if(out.hasZ) {
+            out.coords.push_back(c.z);
+        }
+    }
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,269 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/noding/snapround/LocalSnapRoundingNoder.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/CoordinateHashMap.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/index/strtree/SimpleSTRtree.h>
+#include <geos/noding/IntersectionAdder.h>
+#include <geos/noding/MCIndexNoder.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/NodingIntersectionFinder.h>
+#include <geos/noding/SegmentIntersector.h>
+#include <geos/noding/snapround/SnapRoundingNoder.h>
+#include <geos/util/OperationStats.h>
+#include <geos/util/TopologyException.h>
+#include <geos/util.h>
+
+#include <algorithm>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace noding { // geos.noding
+namespace snapround { // geos.noding.snapround
+
+namespace {
+
+// Width of the margin added around the failures on the first try, in grid cells
+const double MARGIN_CELLS = 2.0;
+
+// Growth of the margin on each further try
+const double MARGIN_GROWTH = 10.0;
+
+typedef std::vector<std::unique_ptr<NodedSegmentString>> NodedEdges;
+
+/*
+ * Collects the envelope of every pair of segments found
+ * to be incorrectly noded.
+ */
+class NodingFailureCollector : public SegmentIntersector {
+
+public:
+
+    std::vector<Envelope> failures;
+
+    NodingFailureCollector()
+        : finder(li)
+    {
+        finder.setFindAllIntersections(true);
+    }
+
+    void
+    processIntersections(SegmentString* e0, std::size_t segIndex0,
+                         SegmentString* e1, std::size_t segIndex1) override
+    {
+        std::size_t count = finder.count();
+        finder.processIntersections(e0, segIndex0, e1, segIndex1);
+        if(finder.count() > count) {
+            Envelope env(e0->getCoordinate(segIndex0), e0->getCoordinate(segIndex0 + 1));
+            env.expandToInclude(e1->getCoordinate(segIndex1));
+            env.expandToInclude(e1->getCoordinate(segIndex1 + 1));
+            failures.push_back(env);
+        }
+    }
+
+private:
+
+    algorithm::LineIntersector li;
+    NodingIntersectionFinder finder;
+};
+
+std::vector<Envelope>
+findNodingFailures(const NodedEdges& edges)
+{
+    std::vector<SegmentString*> segStrings;
+    segStrings.reserve(edges.size());
+    for(const auto& e : edges) {
+        segStrings.push_back(e.get());
+    }
+    NodingFailureCollector collector;
+    MCIndexNoder noder;
+    noder.setSegmentIntersector(&collector);
+    noder.computeNodes(&segStrings);
+    return collector.failures;
+}
+
+// Takes ownership of noded substrings returned by a noder
+NodedEdges
+toNodedEdges(std::vector<SegmentString*>* segStrings)
+{
+    NodedEdges edges;
+    edges.reserve(segStrings->size());
+    for(SegmentString* ss : *segStrings) {
+        edges.emplace_back(detail::down_cast<NodedSegmentString*>(ss));
+    }
+    delete segStrings;
+    return edges;
+}
+
+} // anonymous namespace
+
+/*public*/
+LocalSnapRoundingNoder::LocalSnapRoundingNoder(const PrecisionModel* p_pm)
+    : pm(p_pm)
+    , numSnapRounded(0)
+{}
+
+LocalSnapRoundingNoder::~LocalSnapRoundingNoder() = default;
+
+/*public*/
+std::vector<SegmentString*>*
+LocalSnapRoundingNoder::getNodedSubstrings() const
+{
+    std::vector<SegmentString*>* result = new std::vector<SegmentString*>();
+    result->reserve(nodedEdges.size());
+    for(const auto& e : nodedEdges) {
+        result->push_back(new NodedSegmentString(e->getCoordinates()->clone().release(), e->getData()));
+    }
+    return result;
+}
+
+/*public*/
+void
+LocalSnapRoundingNoder::computeNodes(std::vector<SegmentString*>* inputSegStrings)
+{
+    nodedEdges.clear();
+    numSnapRounded = 0;
+
+    algorithm::LineIntersector li;
+    IntersectionAdder intAdder(li);
+    MCIndexNoder noder;
+    noder.setSegmentIntersector(&intAdder);
+    noder.computeNodes(inputSegStrings);
+    NodedEdges floatEdges = toNodedEdges(noder.getNodedSubstrings());
+
+    std::vector<Envelope> failures = findNodingFailures(floatEdges);
+    if(failures.empty()) {
+        nodedEdges = std::move(floatEdges);
+        return;
+    }
+
+    double margin = MARGIN_CELLS / pm->getScale();
+    for(int i = 0; i < MAX_TRIES; i++) {
+        std::vector<Envelope> regions;
+        regions.reserve(failures.size());
+        for(const Envelope& env : failures) {
+            regions.emplace_back(env);
+            regions.back().expandBy(margin);
+        }
+
+        NodedEdges edges = snapRoundRegions(floatEdges, regions);
+        std::vector<Envelope> newFailures = findNodingFailures(edges);
+        if(newFailures.empty()) {
+            nodedEdges = std::move(edges);
+            util::OperationStats::count(util::OperationStats::LOCAL_SNAP_ROUNDED_SEGMENTS, numSnapRounded);
+            return;
+        }
+        failures.insert(failures.end(), newFailures.begin(), newFailures.end());
+        margin *= MARGIN_GROWTH;
+    }
+    throw util::TopologyException("Local snap-rounding did not produce a valid noding");
+}
+
+/*private*/
+NodedEdges
+LocalSnapRoundingNoder::snapRoundRegions(const NodedEdges& edges,
+        const std::vector<Envelope>& regions)
+{
+    index::strtree::SimpleSTRtree regionIndex;
+    for(const Envelope& env : regions) {
+        regionIndex.insert(&env, const_cast<Envelope*>(&env));
+    }
+
+    /*
+     * Split each edge into runs of segments which are all in a region
+     * or all outside of them. The vertices of the segments in regions
+     * are rounded in every edge, so that the edges still meet there.
+     */
+    struct Run {
+        const NodedSegmentString* edge;
+        std::size_t start;
+        std::size_t end;
+        bool isLocal;
+    };
+    std::vector<Run> runs;
+    CoordinateHashMap<bool> roundedPts;
+    std::vector<void*> hits;
+    numSnapRounded = 0;
+    for(const auto& e : edges) {
+        if(e->size() < 2) {
+            continue;
+        }
+        std::size_t nseg = e->size() - 1;
+        std::vector<bool> isLocal(nseg);
+        for(std::size_t i = 0; i < nseg; i++) {
+            Envelope segEnv(e->getCoordinate(i), e->getCoordinate(i + 1));
+            hits.clear();
+            regionIndex.query(&segEnv, hits);
+            isLocal[i] = !hits.empty();
+        }
+        std::size_t start = 0;
+        for(std::size_t i = 1; i <= nseg; i++) {
+            if(i < nseg && isLocal[i] == isLocal[start]) {
+                continue;
+            }
+            runs.push_back({e.get(), start, i, isLocal[start]});
+            if(isLocal[start]) {
+                for(std::size_t j = start; j <= i; j++) {
+                    roundedPts.insert(e->getCoordinate(j), true);
+                }
+                numSnapRounded += i - start;
+            }
+            start = i;
+        }
+    }
+
+    NodedEdges result;
+    NodedEdges localRuns;
+    for(const Run& run : runs) {
+        std::unique_ptr<std::vector<Coordinate>> pts(new std::vector<Coordinate>());
+        pts->reserve(run.end - run.start + 1);
+        for(std::size_t j = run.start; j <= run.end; j++) {
+            Coordinate p = run.edge->getCoordinate(j);
+            if(!run.isLocal && roundedPts.find(p)) {
+                pm->makePrecise(p);
+            }
+            pts->push_back(p);
+        }
+        if(run.isLocal) {
+            localRuns.emplace_back(new NodedSegmentString(
+                new CoordinateArraySequence(pts.release()), run.edge->getData()));
+            continue;
+        }
+        pts->erase(std::unique(pts->begin(), pts->end()), pts->end());
+        if(pts->size() < 2) {
+            continue;
+        }
+        result.emplace_back(new NodedSegmentString(
+            new CoordinateArraySequence(pts.release()), run.edge->getData()));
+    }
+
+    std::vector<SegmentString*> localSegStrings;
+    localSegStrings.reserve(localRuns.size());
+    for(const auto& r : localRuns) {
+        localSegStrings.push_back(r.get());
+    }
+    SnapRoundingNoder snapRounder(pm);
+    snapRounder.computeNodes(&localSegStrings);
+    for(auto& e : toNodedEdges(snapRounder.getNodedSubstrings())) {
+        result.push_back(std::move(e));
+    }
+    return result;
+}
+
+} // namespace geos.noding.snapround
+} // namespace geos.noding
+} // namespace geos
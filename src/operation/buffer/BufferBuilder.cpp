@@ -53,6 +53,7 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/profiler.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/OperationStats.h>
 
 #include <cassert>
 #include <vector>
@@ -399,7 +400,9 @@ BufferBuilder::buffer(const Geometry* g, double distance)
 
         GEOS_CHECK_FOR_INTERRUPTS();
 
+        util::PhaseTimer curveTimer(util::OperationStats::BUFFER_CURVES);
         std::vector<SegmentString*>& bufferSegStrList = curveSetBuilder.getCurves();
+        curveTimer.stop();
 
 #if GEOS_DEBUG
         std::cerr << "OffsetCurveSetBuilder got " << bufferSegStrList.size()
@@ -429,12 +432,14 @@ BufferBuilder::buffer(const Geometry* g, double distance)
     std::vector<BufferSubgraph*> subgraphList;
 
     try {
+        util::PhaseTimer graphTimer(util::OperationStats::GRAPH_BUILD);
         PlanarGraph graph(OverlayNodeFactory::instance());
         graph.addEdges(edgeList.getEdges());
 
         GEOS_CHECK_FOR_INTERRUPTS();
 
         createSubgraphs(&graph, subgraphList);
+        graphTimer.stop();
 
 #if GEOS_DEBUG
         std::cerr << "Created " << subgraphList.size() << " subgraphs" << std::endl;
@@ -449,6 +454,7 @@ BufferBuilder::buffer(const Geometry* g, double distance)
 
         {
             // scope for earlier PolygonBuilder cleanupt
+            util::PhaseTimer resultTimer(util::OperationStats::RESULT_BUILD);
             PolygonBuilder polyBuilder(geomFact);
             buildSubgraphs(subgraphList, polyBuilder);
 
@@ -539,6 +545,7 @@ void
 BufferBuilder::computeNodedEdges(SegmentString::NonConstVect& bufferSegStrList,
                                  const PrecisionModel* precisionModel) // throw(GEOSException)
 {
+    util::PhaseTimer timer(util::OperationStats::NODING);
     Noder* noder = getNoder(precisionModel);
 
 #if JTS_DEBUG
@@ -551,11 +558,27 @@ BufferBuilder::computeNodedEdges(SegmentString::NonConstVect& bufferSegStrList,
               ) << std::endl;
 #endif
 
+    util::OperationStats* stats = util::OperationStats::current();
+    int numIntersectionsBefore = intersectionAdder ? intersectionAdder->numInteriorIntersections : 0;
+
     noder->computeNodes(&bufferSegStrList);
 
     SegmentString::NonConstVect* nodedSegStrings = \
             noder->getNodedSubstrings();
 
+    if(stats) {
+        std::size_t numSegs = 0;
+        for(const SegmentString* ss : bufferSegStrList) {
+            numSegs += ss->size() - 1;
+        }
+        stats->add(util::OperationStats::SEGMENTS_NODED, numSegs);
+        stats->add(util::OperationStats::NODED_EDGES, nodedSegStrings->size());
+        if(noder != workingNoder) {
+            stats->add(util::OperationStats::INTERSECTIONS_FOUND,
+                       static_cast<std::size_t>(intersectionAdder->numInteriorIntersections - numIntersectionsBefore));
+        }
+    }
+
 #if JTS_DEBUG
     std::cerr << "after noding: "
               << wktWriter.write(
@@ -22,6 +22,8 @@
 #include <geos/operation/distance/DistanceOp.h>
 #include <geos/operation/distance/GeometryLocation.h>
 #include <geos/operation/distance/ConnectedElementLocationFilter.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/algorithm/locate/SimplePointInAreaLocator.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/algorithm/Distance.h>
 #include <geos/geom/Coordinate.h>
@@ -35,6 +37,7 @@
 #include <geos/geom/util/PolygonExtracter.h>
 #include <geos/geom/util/LinearComponentExtracter.h>
 #include <geos/geom/util/PointExtracter.h>
+#include <geos/geom/util/ComponentCoordinateExtracter.h>
 #include <geos/util/IllegalArgumentException.h>
 
 #include <vector>
@@ -527,8 +530,56 @@ DistanceOp::isWithinDistance(const geom::Geometry& g0,
                              const geom::Geometry& g1,
                              double distance)
 {
-    DistanceOp distOp(g0, g1, distance);
-    return distOp.distance() <= distance;
+    if(g0.isEmpty() || g1.isEmpty()) {
+        DistanceOp distOp(g0, g1, distance);
+        return distOp.distance() <= distance;
+    }
+    if(g0.getEnvelopeInternal()->distance(*g1.getEnvelopeInternal()) > distance) {
+        return false;
+    }
+
+    // below this many pairs of vertices, building an index costs
+    // more than comparing every pair of facets
+    const std::size_t BRUTE_FORCE_MAX_PAIRS = 250000;
+    if(g0.getNumPoints() * g1.getNumPoints() <= BRUTE_FORCE_MAX_PAIRS) {
+        DistanceOp distOp(g0, g1, distance);
+        return distOp.distance() <= distance;
+    }
+
+    IndexedFacetDistance facetDist(&g0);
+    if(facetDist.isWithinDistance(&g1, distance)) {
+        return true;
+    }
+    // the facets are farther apart than the distance, so the
+    // geometries are within it only if one contains the other
+    return isContainedIn(g1, g0) || isContainedIn(g0, g1);
+}
+
+/*private static*/
+bool
+DistanceOp::isContainedIn(const geom::Geometry& g, const geom::Geometry& polygonal)
+{
+    std::vector<const Polygon*> polys;
+    geom::util::PolygonExtracter::getPolygons(polygonal, polys);
+    if(polys.empty()) {
+        return false;
+    }
+
+    // no facet crosses a polygon boundary, so every component lies
+    // either inside or outside each polygon
+    std::vector<const Coordinate*> pts;
+    geom::util::ComponentCoordinateExtracter::getCoordinates(g, pts);
+    for(const Coordinate* pt : pts) {
+        for(const Polygon* poly : polys) {
+            if(!poly->getEnvelopeInternal()->covers(pt)) {
+                continue;
+            }
+            if(algorithm::locate::SimplePointInAreaLocator::locatePointInPolygon(*pt, poly) != Location::EXTERIOR) {
+                return true;
+            }
+        }
+    }
+    return false;
 }
 
 } // namespace geos.operation.distance
@@ -17,9 +17,13 @@
  **********************************************************************/
 
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/FixedSizeCoordinateSequence.h>
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace geos::geom;
 using namespace geos::index::strtree;
 
@@ -27,6 +31,19 @@ namespace geos {
 namespace operation {
 namespace distance {
 
+namespace {
+// fraction of the envelope diagonal within which array points are batched
+const double BATCH_SPREAD_FRACTION = 0.01;
+}
+
+IndexedFacetDistance::IndexedFacetDistance(const Geometry* g) :
+    cachedTree(FacetSequenceTreeBuilder::build(g))
+{
+    const Envelope* env = g->getEnvelopeInternal();
+    batchSpread = BATCH_SPREAD_FRACTION * std::sqrt(env->getWidth() * env->getWidth()
+                  + env->getHeight() * env->getHeight());
+}
+
 /*public static*/
 double
 IndexedFacetDistance::distance(const Geometry* g1, const Geometry* g2)
@@ -43,6 +60,151 @@ IndexedFacetDistance::nearestPoints(const geom::Geometry* g1, const geom::Geomet
     return dist.nearestPoints(g2);
 }
 
+double
+IndexedFacetDistance::distance(const Coordinate& pt) const
+{
+    FixedSizeCoordinateSequence<1> seq;
+    seq.setAt(pt, 0);
+    FacetSequence fs(&seq, 0, 1);
+
+    return nearestFacet(pt)->distance(fs);
+}
+
+void
+IndexedFacetDistance::distance(const double* x, const double* y, std::size_t n, double* distances) const
+{
+    std::vector<Coordinate> pts;
+    std::vector<double> batchDistances;
+    std::size_t i = 0;
+    while(i < n) {
+        Coordinate first(x[i], y[i]);
+        pts.clear();
+        pts.push_back(first);
+        std::size_t end = i + 1;
+        for(; end < n && pts.size() < MAX_ARRAY_BATCH_SIZE; end++) {
+            Coordinate pt(x[end], y[end]);
+            if(pt.distance(first) > batchSpread) {
+                break;
+            }
+            pts.push_back(pt);
+        }
+
+        if(pts.size() == 1) {
+            distances[i] = distance(first);
+        }
+        else {
+            distance(pts, batchDistances);
+            std::copy(batchDistances.begin(), batchDistances.end(), distances + i);
+        }
+        i = end;
+    }
+}
+
+bool
+IndexedFacetDistance::isWithinDistance(const Geometry* g, double maxDistance) const
+{
+    struct : public ItemDistance {
+        double
+        distance(const ItemBoundable* item1, const ItemBoundable* item2) override
+        {
+            return static_cast<const FacetSequence*>(item1->getItem())->distance(*static_cast<const FacetSequence*>
+                    (item2->getItem()));
+        }
+    } itemDistance;
+
+    if(g->isEmpty()) {
+        return false;
+    }
+
+    std::unique_ptr<STRtree> tree2(FacetSequenceTreeBuilder::build(g));
+    return cachedTree->isWithinDistance(tree2.get(), &itemDistance, maxDistance);
+}
+
+bool
+IndexedFacetDistance::isWithinDistance(const Coordinate& pt, double maxDistance) const
+{
+    Envelope searchEnv(pt.x - maxDistance, pt.x + maxDistance, pt.y - maxDistance, pt.y + maxDistance);
+    std::vector<void*> facets;
+    cachedTree->query(&searchEnv, facets);
+
+    FixedSizeCoordinateSequence<1> seq;
+    seq.setAt(pt, 0);
+    FacetSequence fs(&seq, 0, 1);
+    for(const void* facet : facets) {
+        if(static_cast<const FacetSequence*>(facet)->distance(fs) <= maxDistance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const FacetSequence*
+IndexedFacetDistance::nearestFacet(const Coordinate& pt) const
+{
+    struct : public ItemDistance {
+        double
+        distance(const ItemBoundable* item1, const ItemBoundable* item2) override
+        {
+            return static_cast<const FacetSequence*>(item1->getItem())->distance(*static_cast<const FacetSequence*>
+                    (item2->getItem()));
+        }
+    } itemDistance;
+
+    // query with a single point facet, without building a tree for it
+    FixedSizeCoordinateSequence<1> seq;
+    seq.setAt(pt, 0);
+    FacetSequence fs(&seq, 0, 1);
+
+    return static_cast<const FacetSequence*>(
+        cachedTree->nearestNeighbour(fs.getEnvelope(), &fs, &itemDistance));
+}
+
+void
+IndexedFacetDistance::distance(const std::vector<Coordinate>& pts, std::vector<double>& distances) const
+{
+    distances.clear();
+    if(pts.empty()) {
+        return;
+    }
+
+    // the distance to the first point bounds the distance to the others,
+    // so the facets near the batch are found with a single query
+    double firstDist = distance(pts[0]);
+    Envelope searchEnv;
+    for(const Coordinate& p : pts) {
+        double bound = firstDist + p.distance(pts[0]);
+        searchEnv.expandToInclude(Envelope(p.x - bound, p.x + bound, p.y - bound, p.y + bound));
+    }
+    std::vector<void*> facets;
+    cachedTree->query(&searchEnv, facets);
+
+    distances.reserve(pts.size());
+    distances.push_back(firstDist);
+
+    // too many facets for a scan: the points are far from the geometry
+    // relative to their spread, where separate queries prune better
+    if(facets.size() > MAX_BATCH_SCAN_FACETS * pts.size()) {
+        for(std::size_t i = 1; i < pts.size(); i++) {
+            distances.push_back(distance(pts[i]));
+        }
+        return;
+    }
+
+    FixedSizeCoordinateSequence<1> seq;
+    for(std::size_t i = 1; i < pts.size(); i++) {
+        seq.setAt(pts[i], 0);
+        FacetSequence fs(&seq, 0, 1);
+        double minDist = firstDist + pts[i].distance(pts[0]);
+        for(const void* facet : facets) {
+            const FacetSequence* facetSeq = static_cast<const FacetSequence*>(facet);
+            if(facetSeq->getEnvelope()->distance(*fs.getEnvelope()) < minDist) {
+                minDist = std::min(minDist, facetSeq->distance(fs));
+            }
+        }
+        distances.push_back(minDist);
+    }
+}
+
 double
 IndexedFacetDistance::distance(const Geometry* g) const
 {
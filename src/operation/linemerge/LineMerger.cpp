@@ -18,51 +18,58 @@
  **********************************************************************/
 
 #include <geos/operation/linemerge/LineMerger.h>
-#include <geos/operation/linemerge/LineMergeDirectedEdge.h>
-#include <geos/operation/linemerge/EdgeString.h>
-#include <geos/planargraph/DirectedEdge.h>
-#include <geos/planargraph/Edge.h>
-#include <geos/planargraph/Node.h>
-//#include <geos/planargraph/GraphComponent.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/GeometryFactory.h>
 #include <geos/geom/LineString.h>
-#include <geos/util.h>
+#include <geos/geom/Quadrant.h>
 
+#include <algorithm>
 #include <cassert>
-#include <functional>
+#include <limits>
 #include <vector>
 
-using namespace std;
-using namespace geos::planargraph;
 using namespace geos::geom;
 
-#ifndef GEOS_DEBUG
-#define GEOS_DEBUG 0
-#endif
-
 namespace geos {
 namespace operation { // geos.operation
 namespace linemerge { // geos.operation.linemerge
 
+namespace { // module-statics
+
+const std::size_t NO_EDGE = std::numeric_limits<std::size_t>::max();
+
+bool
+isEdgeDirection(std::size_t dirEdge)
+{
+    return dirEdge % 2 == 0;
+}
+
+std::size_t
+getSym(std::size_t dirEdge)
+{
+    return dirEdge ^ 1;
+}
+
+} // end of module-statics
+
 void
-LineMerger::add(vector<const Geometry*>* geometries)
+LineMerger::add(std::vector<const Geometry*>* geometries)
 {
     for(const Geometry* g : *geometries) {
         add(g);
     }
 }
 
-LineMerger::LineMerger():
+LineMerger::LineMerger(bool directed):
+    isDirected(directed),
     factory(nullptr)
 {
 }
 
-LineMerger::~LineMerger()
-{
-    for(size_t i = 0, n = edgeStrings.size(); i < n; ++i) {
-        delete edgeStrings[i];
-    }
-}
+LineMerger::~LineMerger() = default;
 
 
 struct LMGeometryComponentFilter: public GeometryComponentFilter {
@@ -99,7 +106,97 @@ LineMerger::add(const LineString* lineString)
     if(factory == nullptr) {
         factory = lineString->getFactory();
     }
-    graph.addEdge(lineString);
+
+    const CoordinateSequence* pts = lineString->getCoordinatesRO();
+    std::size_t npts = pts->size();
+    if(npts == 0) {
+        return;
+    }
+
+    // the direction points are the first points differing from the ends
+    const Coordinate& startPt = pts->getAt(0);
+    std::size_t iStartDir = 1;
+    while(iStartDir < npts && pts->getAt(iStartDir).equals2D(startPt)) {
+        iStartDir++;
+    }
+    // don't add lines with all coordinates equal
+    if(iStartDir == npts) {
+        return;
+    }
+    const Coordinate& endPt = pts->getAt(npts - 1);
+    std::size_t iEndDir = npts - 2;
+    while(pts->getAt(iEndDir).equals2D(endPt)) {
+        iEndDir--;
+    }
+
+    MergeEdge edge;
+    edge.line = lineString;
+    edge.fromNode = getNode(startPt);
+    edge.toNode = getNode(endPt);
+    edge.fromDirPt = pts->getAt(iStartDir);
+    edge.toDirPt = pts->getAt(iEndDir);
+    edge.isMarked = false;
+    edges.push_back(edge);
+
+    nodes[edge.fromNode].degree++;
+    nodes[edge.toNode].degree++;
+}
+
+std::size_t
+LineMerger::getNode(const Coordinate& pt)
+{
+    auto inserted = nodeIndex.insert(pt, nodes.size());
+    if(inserted.second) {
+        nodes.push_back(MergeNode{pt, 0, 0, false});
+    }
+    return *inserted.first;
+}
+
+void
+LineMerger::buildOutEdges()
+{
+    std::size_t outStart = 0;
+    for(MergeNode& node : nodes) {
+        node.outStart = outStart;
+        outStart += node.degree;
+    }
+
+    // fill in edge order, as the planar graph adds its directed edges
+    outEdges.resize(outStart);
+    std::vector<std::size_t> fill(nodes.size(), 0);
+    for(std::size_t i = 0; i < edges.size(); i++) {
+        const MergeEdge& edge = edges[i];
+        outEdges[nodes[edge.fromNode].outStart + fill[edge.fromNode]++] = 2 * i;
+        outEdges[nodes[edge.toNode].outStart + fill[edge.toNode]++] = 2 * i + 1;
+    }
+
+    // sort the directed edges around each node by angle,
+    // as planargraph::DirectedEdge::compareDirection does
+    std::vector<int> quadrants(outStart);
+    for(std::size_t i = 0; i < edges.size(); i++) {
+        const MergeEdge& edge = edges[i];
+        const Coordinate& from = nodes[edge.fromNode].pt;
+        const Coordinate& to = nodes[edge.toNode].pt;
+        quadrants[2 * i] = Quadrant::quadrant(edge.fromDirPt.x - from.x, edge.fromDirPt.y - from.y);
+        quadrants[2 * i + 1] = Quadrant::quadrant(edge.toDirPt.x - to.x, edge.toDirPt.y - to.y);
+    }
+    for(const MergeNode& node : nodes) {
+        if(node.degree < 2) {
+            continue;
+        }
+        const Coordinate& p0 = node.pt;
+        std::sort(outEdges.data() + node.outStart, outEdges.data() + node.outStart + node.degree,
+        [&](std::size_t a, std::size_t b) {
+            if(quadrants[a] != quadrants[b]) {
+                return quadrants[a] < quadrants[b];
+            }
+            const MergeEdge& ea = edges[a / 2];
+            const MergeEdge& eb = edges[b / 2];
+            const Coordinate& pa = isEdgeDirection(a) ? ea.fromDirPt : ea.toDirPt;
+            const Coordinate& pb = isEdgeDirection(b) ? eb.fromDirPt : eb.toDirPt;
+            return algorithm::Orientation::index(p0, pb, pa) < 0;
+        });
+    }
 }
 
 void
@@ -110,25 +207,17 @@ LineMerger::merge()
     }
 
     // reset marks (this allows incremental processing)
-    GraphComponent::setMarkedMap(graph.nodeIterator(), graph.nodeEnd(),
-                                 false);
-    GraphComponent::setMarked(graph.edgeIterator(), graph.edgeEnd(),
-                              false);
-
-    for(size_t i = 0, n = edgeStrings.size(); i < n; ++i) {
-        delete edgeStrings[i];
+    for(MergeNode& node : nodes) {
+        node.isMarked = false;
+    }
+    for(MergeEdge& edge : edges) {
+        edge.isMarked = false;
     }
-    edgeStrings.clear();
+
+    buildOutEdges();
 
     buildEdgeStringsForObviousStartNodes();
     buildEdgeStringsForIsolatedLoops();
-
-    auto numEdgeStrings = edgeStrings.size();
-    mergedLineStrings.reserve(numEdgeStrings);
-    for(size_t i = 0; i < numEdgeStrings; ++i) {
-        EdgeString* edgeString = edgeStrings[i];
-        mergedLineStrings.emplace_back(edgeString->toLineString());
-    }
 }
 
 void
@@ -143,84 +232,133 @@ LineMerger::buildEdgeStringsForIsolatedLoops()
     buildEdgeStringsForUnprocessedNodes();
 }
 
+/*
+ * Nodes are visited in coordinate order, the order of the planar graph
+ * NodeMap, so the output does not depend on the hashing.
+ */
 void
 LineMerger::buildEdgeStringsForUnprocessedNodes()
 {
-#if GEOS_DEBUG
-    cerr << __FUNCTION__ << endl;
-#endif
-    typedef std::vector<Node*> Nodes;
-
-    Nodes nodes;
-    graph.getNodes(nodes);
-    for(Nodes::size_type i = 0, in = nodes.size(); i < in; ++i) {
-        Node* node = nodes[i];
-#if GEOS_DEBUG
-        cerr << "Node " << i << ": " << *node << endl;
-#endif
-        if(!node->isMarked()) {
-            assert(node->getDegree() == 2);
+    std::vector<std::size_t> sortedNodes;
+    for(std::size_t i = 0; i < nodes.size(); i++) {
+        if(!nodes[i].isMarked) {
+            sortedNodes.push_back(i);
+        }
+    }
+    std::sort(sortedNodes.begin(), sortedNodes.end(), [this](std::size_t a, std::size_t b) {
+        return nodes[a].pt.compareTo(nodes[b].pt) < 0;
+    });
+    for(std::size_t node : sortedNodes) {
+        if(!nodes[node].isMarked) {
+            assert(nodes[node].degree == 2);
             buildEdgeStringsStartingAt(node);
-            node->setMarked(true);
-#if GEOS_DEBUG
-            cerr << " setMarked(true) : " << *node << endl;
-#endif
+            nodes[node].isMarked = true;
         }
     }
 }
 
+/*
+ * When directed, lines also start and end at degree-2 nodes where two
+ * lines start or two lines end.
+ */
 void
 LineMerger::buildEdgeStringsForNonDegree2Nodes()
 {
-#if GEOS_DEBUG
-    cerr << __FUNCTION__ << endl;
-#endif
-    typedef std::vector<Node*> Nodes;
-
-    Nodes nodes;
-    graph.getNodes(nodes);
-    for(Nodes::size_type i = 0, in = nodes.size(); i < in; ++i) {
-        Node* node = nodes[i];
-#if GEOS_DEBUG
-        cerr << "Node " << i << ": " << *node << endl;
-#endif
-        if(node->getDegree() != 2) {
-            buildEdgeStringsStartingAt(node);
-            node->setMarked(true);
-#if GEOS_DEBUG
-            cerr << " setMarked(true) : " << *node << endl;
-#endif
+    std::vector<std::size_t> sortedNodes;
+    for(std::size_t i = 0; i < nodes.size(); i++) {
+        const MergeNode& node = nodes[i];
+        if(node.degree != 2 || (isDirected &&
+                                isEdgeDirection(outEdges[node.outStart]) ==
+                                isEdgeDirection(outEdges[node.outStart + 1]))) {
+            sortedNodes.push_back(i);
         }
     }
+    std::sort(sortedNodes.begin(), sortedNodes.end(), [this](std::size_t a, std::size_t b) {
+        return nodes[a].pt.compareTo(nodes[b].pt) < 0;
+    });
+    for(std::size_t node : sortedNodes) {
+        buildEdgeStringsStartingAt(node);
+        nodes[node].isMarked = true;
+    }
 }
 
 void
-LineMerger::buildEdgeStringsStartingAt(Node* node)
-{
-    vector<planargraph::DirectedEdge*>& edges = node->getOutEdges()->getEdges();
-    size_t size = edges.size();
-    for(size_t i = 0; i < size; i++) {
-        LineMergeDirectedEdge* directedEdge =
-                            detail::down_cast<LineMergeDirectedEdge*>(edges[i]);
-        if(directedEdge->getEdge()->isMarked()) {
+LineMerger::buildEdgeStringsStartingAt(std::size_t node)
+{
+    const MergeNode& n = nodes[node];
+    for(std::size_t i = n.outStart; i < n.outStart + n.degree; i++) {
+        std::size_t dirEdge = outEdges[i];
+        if(edges[dirEdge / 2].isMarked) {
             continue;
         }
-        edgeStrings.push_back(buildEdgeStringStartingWith(directedEdge));
+        if(isDirected && !isEdgeDirection(dirEdge)) {
+            continue;
+        }
+        mergedLineStrings.push_back(buildEdgeStringStartingWith(dirEdge));
     }
 }
 
-EdgeString*
-LineMerger::buildEdgeStringStartingWith(LineMergeDirectedEdge* start)
+std::unique_ptr<LineString>
+LineMerger::buildEdgeStringStartingWith(std::size_t start)
 {
-    EdgeString* edgeString = new EdgeString(factory);
-    LineMergeDirectedEdge* current = start;
+    std::unique_ptr<std::vector<Coordinate>> coords(new std::vector<Coordinate>());
+    std::size_t forwardDirectedEdges = 0;
+    std::size_t reverseDirectedEdges = 0;
+
+    std::size_t current = start;
     do {
-        edgeString->add(current);
-        current->getEdge()->setMarked(true);
-        current = current->getNext();
+        MergeEdge& edge = edges[current / 2];
+        edge.isMarked = true;
+
+        const CoordinateSequence* pts = edge.line->getCoordinatesRO();
+        std::size_t npts = pts->size();
+        bool direction = isEdgeDirection(current);
+        if(direction) {
+            forwardDirectedEdges++;
+        }
+        else {
+            reverseDirectedEdges++;
+        }
+        // add the points without repeating any
+        for(std::size_t i = 0; i < npts; i++) {
+            const Coordinate& pt = pts->getAt(direction ? i : npts - 1 - i);
+            if(coords->empty() || !coords->back().equals2D(pt)) {
+                coords->push_back(pt);
+            }
+        }
+
+        current = getNext(current);
+    }
+    while(current != NO_EDGE && current != start);
+
+    if(reverseDirectedEdges > forwardDirectedEdges) {
+        std::reverse(coords->begin(), coords->end());
+    }
+    return std::unique_ptr<LineString>(factory->createLineString(
+                                           new CoordinateArraySequence(coords.release())));
+}
+
+/*
+ * Returns the directed edge that starts at the end point of a directed
+ * edge, or NO_EDGE if there are zero or multiple directed edges starting
+ * there, or if the merger is directed and the next edge is reversed.
+ */
+std::size_t
+LineMerger::getNext(std::size_t dirEdge) const
+{
+    const MergeEdge& edge = edges[dirEdge / 2];
+    const MergeNode& toNode = nodes[isEdgeDirection(dirEdge) ? edge.toNode : edge.fromNode];
+    if(toNode.degree != 2) {
+        return NO_EDGE;
+    }
+    std::size_t next = outEdges[toNode.outStart];
+    if(next == getSym(dirEdge)) {
+        next = outEdges[toNode.outStart + 1];
+    }
+    if(isDirected && !isEdgeDirection(next)) {
+        return NO_EDGE;
     }
-    while(current != nullptr && current != start);
-    return edgeString;
+    return next;
 }
 
 /**
@@ -18,6 +18,7 @@
 
 #include <geos/operation/overlayng/EdgeNodingBuilder.h>
 #include <geos/operation/overlayng/EdgeMerger.h>
+#include <geos/util/OperationStats.h>
 
 using geos::operation::valid::RepeatedPointRemover;
 
@@ -101,6 +102,20 @@ EdgeNodingBuilder::node(std::vector<SegmentString*>* segStrings)
 
     std::unique_ptr<std::vector<SegmentString*>> nodedSS(noder->getNodedSubstrings());
 
+    util::OperationStats* stats = util::OperationStats::current();
+    if (stats) {
+        std::size_t numSegs = 0;
+        for (const SegmentString* ss : *segStrings) {
+            numSegs += ss->size() - 1;
+        }
+        stats->add(util::OperationStats::SEGMENTS_NODED, numSegs);
+        stats->add(util::OperationStats::NODED_EDGES, nodedSS->size());
+        if (customNoder == nullptr && OverlayUtil::isFloating(pm)) {
+            stats->add(util::OperationStats::INTERSECTIONS_FOUND,
+                       static_cast<std::size_t>(intAdder.numInteriorIntersections));
+        }
+    }
+
     nodedEdges = createEdges(nodedSS.get());
 
     // Clean up now that all the info is transferred to Edges
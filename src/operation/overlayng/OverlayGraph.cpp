@@ -18,6 +18,8 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h>
 
+#include <algorithm>
+
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
 #endif
@@ -47,9 +49,14 @@ std::vector<OverlayEdge*>
 OverlayGraph::getNodeEdges()
 {
     std::vector<OverlayEdge*> nodeEdges;
-    for (auto nodeMapPair : nodeMap) {
+    nodeEdges.reserve(nodeMap.size());
+    for (auto& nodeMapPair : nodeMap) {
         nodeEdges.push_back(nodeMapPair.second);
     }
+    // the node map iterates in insertion order
+    std::sort(nodeEdges.begin(), nodeEdges.end(), [](const OverlayEdge* a, const OverlayEdge* b) {
+        return a->orig().compareTo(b->orig()) < 0;
+    });
     return nodeEdges;
 }
 
@@ -57,11 +64,11 @@ OverlayGraph::getNodeEdges()
 OverlayEdge*
 OverlayGraph::getNodeEdge(const Coordinate& nodePt) const
 {
-    auto it = nodeMap.find(nodePt);
-    if (it == nodeMap.end()) {
+    OverlayEdge* const* found = nodeMap.find(nodePt);
+    if (found == nullptr) {
         return nullptr;
     }
-    return it->second;
+    return *found;
 }
 
 /*public*/
@@ -149,14 +156,14 @@ OverlayGraph::insert(OverlayEdge* e)
      * insert the edge into the star of edges around the node.
      * Otherwise, add a new node for the origin.
      */
-    auto it = nodeMap.find(e->orig());
-    if (it != nodeMap.end()) {
+    OverlayEdge** found = nodeMap.find(e->orig());
+    if (found != nullptr) {
         // found in map
-        OverlayEdge* nodeEdge = it->second;
+        OverlayEdge* nodeEdge = *found;
         nodeEdge->insert(e);
     }
     else {
-        nodeMap[e->orig()] = e;
+        nodeMap.insert(e->orig(), e);
     }
 }
 
@@ -35,6 +35,7 @@
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Location.h>
 #include <geos/geom/Geometry.h>
+#include <geos/util/OperationStats.h>
 
 #include <algorithm>
 
@@ -219,9 +220,13 @@ OverlayNG::computeEdgeOverlay()
         }
     }
 
-    std::vector<Edge*> edges = nodingBuilder.build(
-        inputGeom.getGeometry(0),
-        inputGeom.getGeometry(1));
+    std::vector<Edge*> edges;
+    {
+        util::PhaseTimer timer(util::OperationStats::NODING);
+        edges = nodingBuilder.build(
+            inputGeom.getGeometry(0),
+            inputGeom.getGeometry(1));
+    }
 
     /**
      * Record if an input geometry has collapsed.
@@ -239,10 +244,13 @@ OverlayNG::computeEdgeOverlay()
     // Sort the edges first, for comparison with JTS results
     // std::sort(edges.begin(), edges.end(), EdgeComparator);
     OverlayGraph graph;
-    for (Edge* e : edges) {
-        // Write out edge graph as hex for examination
-        // std::cout << *e << std::endl;
-        graph.addEdge(e);
+    {
+        util::PhaseTimer timer(util::OperationStats::GRAPH_BUILD);
+        for (Edge* e : edges) {
+            // Write out edge graph as hex for examination
+            // std::cout << *e << std::endl;
+            graph.addEdge(e);
+        }
     }
 
     if (isOutputNodedEdges) {
@@ -264,6 +272,7 @@ OverlayNG::computeEdgeOverlay()
 void
 OverlayNG::labelGraph(OverlayGraph* graph)
 {
+    util::PhaseTimer timer(util::OperationStats::LABELLING);
     OverlayLabeller labeller(graph, &inputGeom);
     labeller.computeLabelling();
     labeller.markResultAreaEdges(opCode);
@@ -280,6 +289,8 @@ OverlayNG::extractResult(int p_opCode, OverlayGraph* graph)
     std::cerr << "OverlayNG::extractResult: graph: " << *graph << std::endl;
 #endif
 
+    util::PhaseTimer timer(util::OperationStats::RESULT_BUILD);
+
     bool isAllowMixedIntResult = ! isStrictMode;
 
     //--- Build polygons
@@ -24,8 +24,10 @@
 #include <geos/operation/union/UnionStrategy.h>
 #include <geos/operation/union/UnaryUnionOp.h>
 #include <geos/noding/snap/SnappingNoder.h>
+#include <geos/noding/snapround/LocalSnapRoundingNoder.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/util/OperationStats.h>
 #include <geos/util/TopologyException.h>
 
 #include <stdexcept>
@@ -149,6 +151,37 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
     throw exOriginal;
 }
 
+/*public static*/
+std::unique_ptr<Geometry>
+OverlayNGRobust::OverlayFast(const Geometry* geom0, const Geometry* geom1, int opCode)
+{
+    if (!geom0->getPrecisionModel()->isFloating()) {
+        return OverlayNG::overlay(geom0, geom1, opCode, geom0->getPrecisionModel());
+    }
+
+    /**
+     * Node in floating precision, snap-rounding only the regions
+     * where floating noding fails, to the grid used by overlaySR.
+     */
+    try {
+        double scaleSafe = PrecisionUtil::safeScale(geom0, geom1);
+        PrecisionModel pmSafe(scaleSafe);
+        noding::snapround::LocalSnapRoundingNoder noder(&pmSafe);
+        return OverlayNG::overlay(geom0, geom1, opCode, &noder);
+    }
+    catch (const std::runtime_error &ex) {
+        ::geos::ignore_unused_variable_warning(ex);
+#if GEOS_DEBUG
+        std::cout << "Local snap-rounding overlay FAILURE: " << ex.what() << std::endl;
+#endif
+        std::unique_ptr<Geometry> result = overlaySR(geom0, geom1, opCode);
+        if (result != nullptr)
+            return result;
+
+        // Rethrow the original error
+        throw;
+    }
+}
 
 /*private static*/
 std::unique_ptr<Geometry>
@@ -184,6 +217,7 @@ OverlayNGRobust::overlaySnapTries(const Geometry* geom0, const Geometry* geom1,
 std::unique_ptr<Geometry>
 OverlayNGRobust::overlaySnapping(const Geometry* geom0, const Geometry* geom1, int opCode, double snapTol)
 {
+    geos::util::OperationStats::count(geos::util::OperationStats::OVERLAY_SNAPPING_TRIES);
     try {
         return overlaySnapTol(geom0, geom1, opCode, snapTol);
     }
@@ -202,6 +236,7 @@ OverlayNGRobust::overlaySnapping(const Geometry* geom0, const Geometry* geom1, i
 std::unique_ptr<Geometry>
 OverlayNGRobust::overlaySnapBoth(const Geometry* geom0, const Geometry* geom1, int opCode, double snapTol)
 {
+    geos::util::OperationStats::count(geos::util::OperationStats::OVERLAY_SNAPPING_TRIES);
     try {
         std::unique_ptr<Geometry> snap0 = snapSelf(geom0, snapTol);
         std::unique_ptr<Geometry> snap1 = snapSelf(geom1, snapTol);
@@ -283,6 +318,7 @@ OverlayNGRobust::ordinateMagnitude(const Geometry* geom)
 std::unique_ptr<Geometry>
 OverlayNGRobust::overlaySR(const Geometry* geom0, const Geometry* geom1, int opCode)
 {
+    geos::util::OperationStats::count(geos::util::OperationStats::OVERLAY_SNAP_ROUNDING_TRIES);
     std::unique_ptr<Geometry> result;
     try {
         double scaleSafe = PrecisionUtil::safeScale(geom0, geom1);
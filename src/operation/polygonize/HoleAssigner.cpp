@@ -19,6 +19,9 @@
 #include <geos/geom/CoordinateArraySequence.h>
 #include <geos/operation/polygonize/HoleAssigner.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/ParallelFor.h>
+
+#include <algorithm>
 
 namespace geos {
 namespace operation {
@@ -26,57 +29,114 @@ namespace polygonize {
 
 void
 HoleAssigner::buildIndex() {
-    for (EdgeRing* shell : m_shells) {
-        m_shellIndex.insert(shell->getRingInternal()->getEnvelopeInternal(), shell);
+    // the item points into m_shells, so findShells can recover the shell index
+    for (std::size_t i = 0; i < m_shells.size(); i++) {
+        m_shellIndex.insert(m_shells[i]->getRingInternal()->getEnvelopeInternal(), &m_shells[i]);
     }
+    // build now, as the index is queried concurrently
+    m_shellIndex.getRoot();
 }
 
 void
-HoleAssigner::assignHolesToShells(std::vector<EdgeRing*> & holes, std::vector<EdgeRing*> & shells)
+HoleAssigner::assignHolesToShells(std::vector<EdgeRing*> & holes, std::vector<EdgeRing*> & shells,
+                                  unsigned int numThreads)
 {
-    HoleAssigner assigner(shells);
+    HoleAssigner assigner(shells, numThreads);
     assigner.assignHolesToShells(holes);
 
 }
 
 void HoleAssigner::assignHolesToShells(std::vector<EdgeRing*> & holes) {
-    for (const auto& holeER : holes) {
-        assignHoleToShell(holeER);
-        GEOS_CHECK_FOR_INTERRUPTS();
+    // candidate shells of each hole, found in parallel
+    std::vector<std::vector<std::size_t>> candidates(holes.size());
+    util::parallelFor(holes.size(), m_numThreads, [&](std::size_t i) {
+        candidates[i] = findShells(*holes[i]->getRingInternal()->getEnvelopeInternal());
+    });
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    // group the tests by shell, so each shell is tested by one thread
+    std::vector<std::size_t> testStart(m_shells.size() + 1, 0);
+    for (const auto& holeCandidates : candidates) {
+        for (std::size_t shell : holeCandidates) {
+            testStart[shell + 1]++;
+        }
+    }
+    for (std::size_t i = 0; i < m_shells.size(); i++) {
+        testStart[i + 1] += testStart[i];
+    }
+    std::vector<std::size_t> testedShells;
+    std::vector<std::pair<std::size_t, std::size_t>> tests(testStart.back());
+    std::vector<std::size_t> next(testStart.begin(), testStart.end() - 1);
+    for (std::size_t i = 0; i < holes.size(); i++) {
+        for (std::size_t j = 0; j < candidates[i].size(); j++) {
+            std::size_t shell = candidates[i][j];
+            if (next[shell] == testStart[shell]) {
+                testedShells.push_back(shell);
+            }
+            tests[next[shell]++] = std::make_pair(i, j);
+        }
     }
-}
 
-void
-HoleAssigner::assignHoleToShell(EdgeRing* holeER)
-{
-    EdgeRing* shell = findEdgeRingContaining(holeER);
+    std::vector<std::vector<char>> isContained(holes.size());
+    for (std::size_t i = 0; i < holes.size(); i++) {
+        isContained[i].assign(candidates[i].size(), 0);
+    }
+    util::parallelFor(testedShells.size(), m_numThreads, [&](std::size_t k) {
+        std::size_t shell = testedShells[k];
+        EdgeRing* shellER = m_shells[shell];
+        auto shellCoords = shellER->getRingInternal()->getCoordinatesRO();
+        for (std::size_t t = testStart[shell]; t < testStart[shell + 1]; t++) {
+            std::size_t i = tests[t].first;
+            auto holeCoords = holes[i]->getRingInternal()->getCoordinatesRO();
+            const geom::Coordinate& testPt = EdgeRing::ptNotInList(holeCoords, shellCoords);
+            isContained[i][tests[t].second] = shellER->isInRing(testPt);
+        }
+    });
+    GEOS_CHECK_FOR_INTERRUPTS();
 
-    if(shell != nullptr) {
-        shell->addHole(holeER);
+    // assign each hole to the smallest containing shell, as
+    // EdgeRing::findEdgeRingContaining does
+    for (std::size_t i = 0; i < holes.size(); i++) {
+        EdgeRing* minRing = nullptr;
+        const geom::Envelope* minRingEnv = nullptr;
+        for (std::size_t j = 0; j < candidates[i].size(); j++) {
+            if (!isContained[i][j]) {
+                continue;
+            }
+            EdgeRing* tryEdgeRing = m_shells[candidates[i][j]];
+            const geom::Envelope* tryShellEnv = tryEdgeRing->getRingInternal()->getEnvelopeInternal();
+            if (minRing == nullptr || minRingEnv->contains(tryShellEnv)) {
+                minRing = tryEdgeRing;
+                minRingEnv = tryShellEnv;
+            }
+        }
+        if (minRing != nullptr) {
+            minRing->addHole(holes[i]);
+        }
     }
 }
 
-std::vector<EdgeRing*>
+std::vector<std::size_t>
 HoleAssigner::findShells(const geom::Envelope& e) {
     std::vector<void*> shellsVoid;
     m_shellIndex.query(&e, shellsVoid);
 
-    // TODO turn AbstractSTRtree::query into a template and remove this
-    std::vector<EdgeRing*> shells{shellsVoid.size()};
-    for (size_t i = 0; i < shellsVoid.size(); i++) {
-        shells[i] = static_cast<EdgeRing*>(shellsVoid[i]);
+    // keep the shells which may contain the ring: the ring envelope cannot
+    // equal the shell envelope (also guards against testing rings against themselves)
+    std::vector<std::size_t> shells;
+    for (void* item : shellsVoid) {
+        std::size_t i = static_cast<std::size_t>(static_cast<EdgeRing**>(item) - m_shells.data());
+        const geom::Envelope* shellEnv = m_shells[i]->getRingInternal()->getEnvelopeInternal();
+        if (!shellEnv->equals(&e) && shellEnv->contains(e)) {
+            shells.push_back(i);
+        }
     }
 
-    return shells;
-}
-
-EdgeRing*
-HoleAssigner::findEdgeRingContaining(EdgeRing* testEr) {
-    const geos::geom::Envelope* e = testEr->getRingInternal()->getEnvelopeInternal();
-
-    std::vector<EdgeRing*> candidateShells = findShells(*e);
+    // the query returns shells in tree order; sort them into shell order, so
+    // ties between shells of equal envelopes resolve as in EdgeRing
+    std::sort(shells.begin(), shells.end());
 
-    return testEr->findEdgeRingContaining(candidateShells);
+    return shells;
 }
 
 }
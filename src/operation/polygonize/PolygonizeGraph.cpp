@@ -21,10 +21,10 @@
 #include <geos/operation/polygonize/PolygonizeDirectedEdge.h>
 #include <geos/operation/polygonize/PolygonizeEdge.h>
 #include <geos/operation/polygonize/EdgeRing.h>
-#include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/planargraph/Node.h>
 #include <geos/planargraph/DirectedEdgeStar.h>
 #include <geos/planargraph/DirectedEdge.h>
+#include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/LineString.h>
 #include <geos/util.h>
@@ -47,7 +47,7 @@ namespace polygonize { // geos.operation.polygonize
 int
 PolygonizeGraph::getDegreeNonDeleted(Node* node)
 {
-    auto edges = node->getOutEdges()->getEdges();
+    auto& edges = node->getOutEdges()->getEdges();
     int degree = 0;
     for(const auto& de : edges) {
         if(!de->isMarked()) {
@@ -60,7 +60,7 @@ PolygonizeGraph::getDegreeNonDeleted(Node* node)
 int
 PolygonizeGraph::getDegree(Node* node, long label)
 {
-    auto edges = node->getOutEdges()->getEdges();
+    auto& edges = node->getOutEdges()->getEdges();
     int degree = 0;
     for(const auto& de : edges) {
         auto pde = detail::down_cast<PolygonizeDirectedEdge*>(de);
@@ -77,7 +77,7 @@ PolygonizeGraph::getDegree(Node* node, long label)
 void
 PolygonizeGraph::deleteAllEdges(Node* node)
 {
-    auto edges = node->getOutEdges()->getEdges();
+    auto& edges = node->getOutEdges()->getEdges();
     for(const auto& de : edges) {
         de->setMarked(true);
         auto sym = de->getSym();
@@ -98,25 +98,7 @@ PolygonizeGraph::PolygonizeGraph(const GeometryFactory* newFactory):
 /*
  * Destroy a PolygonizeGraph
  */
-PolygonizeGraph::~PolygonizeGraph()
-{
-    unsigned int i;
-    for(i = 0; i < newEdges.size(); i++) {
-        delete newEdges[i];
-    }
-    for(i = 0; i < newDirEdges.size(); i++) {
-        delete newDirEdges[i];
-    }
-    for(i = 0; i < newNodes.size(); i++) {
-        delete newNodes[i];
-    }
-    for(i = 0; i < newEdgeRings.size(); i++) {
-        delete newEdgeRings[i];
-    }
-    for(i = 0; i < newCoords.size(); i++) {
-        delete newCoords[i];
-    }
-}
+PolygonizeGraph::~PolygonizeGraph() = default;
 
 /*
  * Add a LineString forming an edge of the polygon graph.
@@ -129,31 +111,43 @@ PolygonizeGraph::addEdge(const LineString* line)
         return;
     }
 
-    auto linePts = valid::RepeatedPointRemover::removeRepeatedPoints(line->getCoordinatesRO());
+    const CoordinateSequence* linePts = line->getCoordinatesRO();
+    const std::size_t npts = linePts->getSize();
+    const Coordinate& startPt = linePts->getAt(0);
+    const Coordinate& endPt = linePts->getAt(npts - 1);
+
+    /*
+     * The edge directions are given by the first points differing
+     * from the end points, as if repeated points were removed.
+     */
+    std::size_t iStartDir = 1;
+    while(iStartDir < npts && linePts->getAt(iStartDir) == startPt) {
+        iStartDir++;
+    }
 
     /*
      * This would catch invalid linestrings
      * (containing duplicated points only)
      */
-    if(linePts->getSize() < 2) {
+    if(iStartDir == npts) {
         return;
     }
 
-    const Coordinate& startPt = linePts->getAt(0);
-    const Coordinate& endPt = linePts->getAt(linePts->getSize() - 1);
+    std::size_t iEndDir = npts - 1;
+    while(linePts->getAt(iEndDir - 1) == endPt) {
+        iEndDir--;
+    }
+
     Node* nStart = getNode(startPt);
     Node* nEnd = getNode(endPt);
-    DirectedEdge* de0 = new PolygonizeDirectedEdge(nStart, nEnd, linePts->getAt(1), true);
-    newDirEdges.push_back(de0);
-    DirectedEdge* de1 = new PolygonizeDirectedEdge(nEnd, nStart,
-            linePts->getAt(linePts->getSize() - 2), false);
-    newDirEdges.push_back(de1);
-    Edge* edge = new PolygonizeEdge(line);
-    newEdges.push_back(edge);
+    newDirEdges.emplace_back(nStart, nEnd, linePts->getAt(iStartDir), true);
+    DirectedEdge* de0 = &newDirEdges.back();
+    newDirEdges.emplace_back(nEnd, nStart, linePts->getAt(iEndDir - 1), false);
+    DirectedEdge* de1 = &newDirEdges.back();
+    newEdges.emplace_back(line);
+    Edge* edge = &newEdges.back();
     edge->setDirectedEdges(de0, de1);
     add(edge);
-
-    newCoords.push_back(linePts.release());
 }
 
 Node*
@@ -161,8 +155,8 @@ PolygonizeGraph::getNode(const Coordinate& pt)
 {
     Node* node = findNode(pt);
     if(node == nullptr) {
-        node = new Node(pt);
-        newNodes.push_back(node);
+        newNodes.emplace_back(pt);
+        node = &newNodes.back();
         // ensure node is only added once to graph
         add(node);
     }
@@ -411,9 +405,8 @@ EdgeRing*
 PolygonizeGraph::findEdgeRing(PolygonizeDirectedEdge* startDE)
 {
     PolygonizeDirectedEdge* de = startDE;
-    EdgeRing* er = new EdgeRing(factory);
-    // Now, when will we delete those EdgeRings ?
-    newEdgeRings.push_back(er);
+    newEdgeRings.emplace_back(factory);
+    EdgeRing* er = &newEdgeRings.back();
     do {
         er->add(de);
         de->setRing(er);
@@ -438,7 +431,7 @@ PolygonizeGraph::deleteDangles(std::vector<const LineString*>& dangleLines)
         Node* node = nodeStack.back();
         nodeStack.pop_back();
         deleteAllEdges(node);
-        auto nodeOutEdges = node->getOutEdges()->getEdges();
+        auto& nodeOutEdges = node->getOutEdges()->getEdges();
         for(DirectedEdge* de : nodeOutEdges) {
             // delete this edge and its sym
             de->setMarked(true);
@@ -27,7 +27,7 @@
 #include <geos/geom/Polygon.h>
 #include <geos/geom/CoordinateArraySequence.h>
 #include <geos/util/Interrupt.h>
-#include <geos/index/strtree/STRtree.h>
+#include <geos/util/ParallelFor.h>
 // std
 #include <vector>
 
@@ -64,6 +64,7 @@ Polygonizer::Polygonizer(bool onlyPolygonal):
     lineStringAdder(this),
     extractOnlyPolygonal(onlyPolygonal),
     computed(false),
+    numThreads(1),
     graph(nullptr),
     dangles(),
     cutEdges(),
@@ -248,7 +249,7 @@ Polygonizer::polygonize()
     cerr << "                           " << shellList.size() << " shells" << endl;
 #endif
 
-    HoleAssigner::assignHolesToShells(holeList, shellList);
+    HoleAssigner::assignHolesToShells(holeList, shellList, numThreads);
 
     bool includeAll = true;
     if (extractOnlyPolygonal) {
@@ -266,14 +267,21 @@ Polygonizer::findValidRings(const vector<EdgeRing*>& edgeRingList,
                             vector<EdgeRing*>& validEdgeRingList,
                             vector<std::unique_ptr<LineString>>& invalidRingList)
 {
-    for(const auto& er : edgeRingList) {
-        if(er->isValid()) {
+    // the rings are independent, so are validated in parallel
+    std::vector<char> isValid(edgeRingList.size());
+    util::parallelFor(edgeRingList.size(), numThreads, [&](std::size_t i) {
+        isValid[i] = edgeRingList[i]->isValid();
+    });
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    for(std::size_t i = 0; i < edgeRingList.size(); i++) {
+        EdgeRing* er = edgeRingList[i];
+        if(isValid[i]) {
             validEdgeRingList.push_back(er);
         }
         else {
             invalidRingList.push_back(er->getLineString());
         }
-        GEOS_CHECK_FOR_INTERRUPTS();
     }
 }
 
@@ -283,16 +291,18 @@ Polygonizer::findShellsAndHoles(const vector<EdgeRing*>& edgeRingList)
 {
     holeList.clear();
     shellList.clear();
+    util::parallelFor(edgeRingList.size(), numThreads, [&](std::size_t i) {
+        edgeRingList[i]->computeHole();
+    });
+    GEOS_CHECK_FOR_INTERRUPTS();
+
     for(auto& er : edgeRingList) {
-        er->computeHole();
         if(er->isHole()) {
             holeList.push_back(er);
         }
         else {
             shellList.push_back(er);
         }
-
-        GEOS_CHECK_FOR_INTERRUPTS();
     }
 }
 
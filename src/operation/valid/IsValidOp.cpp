@@ -26,6 +26,7 @@
 #include <geos/algorithm/LineIntersector.h>
 #include <geos/algorithm/PointLocation.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/GeometryCollection.h>
 #include <geos/geom/LineString.h>
@@ -38,15 +39,22 @@
 #include <geos/geomgraph/Edge.h>
 #include <geos/geomgraph/index/SegmentIntersector.h>
 #include <geos/index/chain/MonotoneChainSelectAction.h>
+#include <geos/noding/BasicSegmentString.h>
+#include <geos/noding/MCIndexNoder.h>
+#include <geos/noding/SegmentIntersector.h>
 #include <geos/operation/valid/ConnectedInteriorTester.h>
 #include <geos/operation/valid/ConsistentAreaTester.h>
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/IndexedNestedShellTester.h>
+#include <geos/operation/valid/RepeatedPointRemover.h>
+#include <geos/util/ParallelFor.h>
 #include <geos/util/UnsupportedOperationException.h>
 
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <memory>
 #include <typeinfo>
 #include <set>
 
@@ -59,6 +67,71 @@ namespace geos {
 namespace operation { // geos.operation
 namespace valid { // geos.operation.valid
 
+namespace {
+
+/*
+ * Finds an intersection between the segments of a ring without
+ * repeated points, other than the vertex shared by two consecutive
+ * segments.
+ */
+class RingIntersectionFinder : public noding::SegmentIntersector {
+public:
+    RingIntersectionFinder(std::size_t p_numSegments)
+        : numSegments(p_numSegments)
+        , found(false)
+    {}
+
+    void
+    processIntersections(noding::SegmentString* e0, std::size_t segIndex0,
+                         noding::SegmentString* e1, std::size_t segIndex1) override
+    {
+        if(segIndex0 == segIndex1) {
+            return;
+        }
+        const CoordinateSequence* pts0 = e0->getCoordinates();
+        const CoordinateSequence* pts1 = e1->getCoordinates();
+        li.computeIntersection(pts0->getAt(segIndex0), pts0->getAt(segIndex0 + 1),
+                               pts1->getAt(segIndex1), pts1->getAt(segIndex1 + 1));
+        if(!li.hasIntersection()) {
+            return;
+        }
+        // consecutive segments meet at their shared vertex only,
+        // unless they overlap
+        if(isConsecutive(segIndex0, segIndex1)
+                && li.getIntersectionNum() == 1) {
+            return;
+        }
+        found = true;
+    }
+
+    bool
+    isDone() const override
+    {
+        return found;
+    }
+
+    bool
+    hasIntersection() const
+    {
+        return found;
+    }
+
+private:
+    bool
+    isConsecutive(std::size_t i, std::size_t j) const
+    {
+        std::size_t lo = std::min(i, j);
+        std::size_t hi = std::max(i, j);
+        return hi - lo == 1 || (lo == 0 && hi == numSegments - 1);
+    }
+
+    LineIntersector li;
+    std::size_t numSegments;
+    bool found;
+};
+
+} // anonymous namespace
+
 /**
  * Find a point from the list of testCoords
  * that is NOT a node in the edge for the list of searchCoords
@@ -113,6 +186,29 @@ IsValidOp::isValid(const Geometry& g)
     return op.isValid();
 }
 
+/* static public */
+void
+IsValidOp::validate(const std::vector<const Geometry*>& geoms,
+                    bool p_isSelfTouchingRingFormingHoleValid,
+                    unsigned int numThreads,
+                    std::vector<int>& errors,
+                    std::vector<Coordinate>& locations)
+{
+    errors.assign(geoms.size(), -1);
+    locations.assign(geoms.size(), Coordinate::getNull());
+
+    // geometries are taken one at a time, as their sizes vary widely
+    util::parallelFor(geoms.size(), numThreads, [&](std::size_t i) {
+        IsValidOp op(geoms[i]);
+        op.setSelfTouchingRingFormingHoleValid(p_isSelfTouchingRingFormingHoleValid);
+        TopologyValidationError* err = op.getValidationError();
+        if(err != nullptr) {
+            errors[i] = err->getErrorType();
+            locations[i] = err->getCoordinate();
+        }
+    });
+}
+
 TopologyValidationError*
 IsValidOp::getValidationError()
 {
@@ -209,6 +305,10 @@ IsValidOp::checkValid(const LinearRing* g)
         return;
     }
 
+    if(isSimpleRing(g)) {
+        return;
+    }
+
     GeometryGraph graph(0, g);
     checkTooFewPoints(&graph);
     if(validErr != nullptr) {
@@ -237,6 +337,11 @@ IsValidOp::checkValid(const Polygon* g)
         return;
     }
 
+    // a simple shell without holes is a valid polygon
+    if(g->getNumInteriorRing() == 0 && isSimpleRing(g->getExteriorRing())) {
+        return;
+    }
+
     GeometryGraph graph(0, g);
 
     checkTooFewPoints(&graph);
@@ -348,6 +453,42 @@ IsValidOp::checkValid(const GeometryCollection* gc)
     }
 }
 
+/*private static*/
+bool
+IsValidOp::isSimpleRing(const LinearRing* ring)
+{
+    const CoordinateSequence* pts = ring->getCoordinatesRO();
+    std::unique_ptr<CoordinateArraySequence> uniquePts;
+    if(pts->hasRepeatedPoints()) {
+        uniquePts = RepeatedPointRemover::removeRepeatedPoints(pts);
+        pts = uniquePts.get();
+    }
+    // leave the reporting of too few points to the topology graph
+    if(pts->size() < 4) {
+        return false;
+    }
+
+    std::size_t numSegments = pts->size() - 1;
+    RingIntersectionFinder finder(numSegments);
+    noding::BasicSegmentString segStr(const_cast<CoordinateSequence*>(pts), nullptr);
+
+    // small rings are cheaper to test pair by pair than to index
+    const std::size_t MAX_UNINDEXED_SEGMENTS = 16;
+    if(numSegments <= MAX_UNINDEXED_SEGMENTS) {
+        for(std::size_t i = 0; i < numSegments && !finder.isDone(); i++) {
+            for(std::size_t j = i + 1; j < numSegments && !finder.isDone(); j++) {
+                finder.processIntersections(&segStr, i, &segStr, j);
+            }
+        }
+        return !finder.hasIntersection();
+    }
+
+    noding::SegmentString::NonConstVect segStrings(1, &segStr);
+    noding::MCIndexNoder noder(&finder);
+    noder.computeNodes(&segStrings);
+    return !finder.hasIntersection();
+}
+
 void
 IsValidOp::checkTooFewPoints(GeometryGraph* graph)
 {
@@ -22,7 +22,17 @@
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/operation/valid/IsValidOp.h>
 
+#include <geos/algorithm/Orientation.h>
+#include <geos/index/ItemVisitor.h>
+#include <geos/index/intervalrtree/SortedPackedIntervalRTree.h>
 #include <geos/operation/overlay/OverlayOp.h>
+#include <geos/operation/overlayng/Edge.h>
+#include <geos/operation/overlayng/EdgeNodingBuilder.h>
+#include <geos/operation/overlayng/OverlayEdge.h>
+#include <geos/operation/overlayng/OverlayGraph.h>
+#include <geos/operation/overlayng/OverlayUtil.h>
+#include <geos/operation/overlayng/PolygonBuilder.h>
+#include <geos/operation/overlayng/PrecisionUtil.h>
 #include <geos/operation/polygonize/BuildArea.h>
 #include <geos/operation/union/UnaryUnionOp.h>
 #include <geos/geom/HeuristicOverlay.h>
@@ -35,6 +45,7 @@
 #include <geos/geom/MultiLineString.h>
 #include <geos/geom/MultiPolygon.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/TopologyException.h>
 #include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/util/UnsupportedOperationException.h>
 
@@ -42,6 +53,7 @@
 // std
 #include <cassert>
 #include <algorithm>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -51,6 +63,13 @@
 
 using namespace geos::geom;
 using namespace geos::operation::overlay;
+using geos::operation::overlayng::Edge;
+using geos::operation::overlayng::EdgeNodingBuilder;
+using geos::operation::overlayng::OverlayEdge;
+using geos::operation::overlayng::OverlayGraph;
+using geos::operation::overlayng::OverlayUtil;
+using geos::operation::overlayng::PolygonBuilder;
+using geos::operation::overlayng::PrecisionUtil;
 
 namespace geos {
 namespace operation { // geos.operation
@@ -296,11 +315,254 @@ static std::unique_ptr<geom::Geometry> MakeValidPoly(const geom::Geometry* geom)
     return factory->createGeometryCollection(std::move(vgeoms));
 }
 
-static std::unique_ptr<geom::Geometry> MakeValidCollection(const geom::GeometryCollection* coll)
+/*
+ * A segment of the noded rings, with the change of winding number
+ * from its left side to its right side.
+ */
+struct WindingSegment {
+    const Coordinate* p0;
+    const Coordinate* p1;
+    int depthDelta;
+};
+
+/*
+ * Sums the changes of winding number across the segments crossed
+ * by a ray going west from a point. Segments are half-open in y,
+ * so that a ray going through a vertex counts it once.
+ */
+class WestRayWindingVisitor : public index::ItemVisitor {
+public:
+    explicit WestRayWindingVisitor(const Coordinate& p_pt)
+        : pt(p_pt)
+        , winding(0)
+    {}
+
+    void
+    visitItem(void* item) override
+    {
+        const WindingSegment* seg = static_cast<const WindingSegment*>(item);
+        const Coordinate& p0 = *seg->p0;
+        const Coordinate& p1 = *seg->p1;
+        // an upward segment has its right side to the east
+        if(p0.y <= pt.y && p1.y > pt.y &&
+                algorithm::Orientation::index(p0, p1, pt) == algorithm::Orientation::CLOCKWISE) {
+            winding += seg->depthDelta;
+        }
+        else if(p1.y <= pt.y && p0.y > pt.y &&
+                algorithm::Orientation::index(p0, p1, pt) == algorithm::Orientation::COUNTERCLOCKWISE) {
+            winding -= seg->depthDelta;
+        }
+    }
+
+    int
+    getWinding() const
+    {
+        return winding;
+    }
+
+private:
+    const Coordinate& pt;
+    int winding;
+};
+
+static bool
+isInterior(int winding, MakeValid::Method method)
+{
+    if(method == MakeValid::EVEN_ODD) {
+        return winding % 2 != 0;
+    }
+    return winding != 0;
+}
+
+/*
+ * Finds a half-edge of a component which has the exterior of the
+ * component on its right, at the lowest-leftmost vertex.
+ * If that vertex is a node, all the edges leave it eastwards or
+ * straight up, so the most clockwise one is followed by the exterior.
+ * Otherwise the exterior is on the outer side of the turn of the edge.
+ */
+static OverlayEdge*
+findExteriorEdge(const std::vector<OverlayEdge*>& component, const Coordinate*& minPt)
+{
+    OverlayEdge* minEdge = nullptr;
+    std::size_t minIndex = 0;
+    minPt = nullptr;
+    for(OverlayEdge* e : component) {
+        if(! e->isForward()) {
+            continue;
+        }
+        const CoordinateSequence* pts = e->getCoordinatesRO();
+        for(std::size_t i = 0; i < pts->size(); i++) {
+            if(minPt == nullptr || pts->getAt(i).compareTo(*minPt) < 0) {
+                minPt = &pts->getAt(i);
+                minEdge = e;
+                minIndex = i;
+            }
+        }
+    }
+
+    const CoordinateSequence* pts = minEdge->getCoordinatesRO();
+    if(minIndex > 0 && minIndex < pts->size() - 1) {
+        int orient = algorithm::Orientation::index(pts->getAt(minIndex - 1), *minPt, pts->getAt(minIndex + 1));
+        return orient == algorithm::Orientation::COUNTERCLOCKWISE ? minEdge : minEdge->symOE();
+    }
+
+    OverlayEdge* nodeEdge = minIndex == 0 ? minEdge : minEdge->symOE();
+    OverlayEdge* extEdge = nodeEdge;
+    for(OverlayEdge* e = nodeEdge->oNextOE(); e != nodeEdge; e = e->oNextOE()) {
+        if(algorithm::Orientation::index(*minPt, extEdge->directionPt(), e->directionPt())
+                == algorithm::Orientation::CLOCKWISE) {
+            extEdge = e;
+        }
+    }
+    return extEdge;
+}
+
+/*
+ * Labels every half-edge of the graph with the winding number of
+ * the face on its right, and marks the edges bounding the interior.
+ *
+ * Walking along a face keeps the winding number, and crossing an edge
+ * changes it by the depth delta of the edge. The winding number of a
+ * face of each connected component is computed by casting a ray
+ * from it to the west, through an index of the segments.
+ */
+static void
+labelWindings(OverlayGraph& graph,
+              const std::unordered_map<const OverlayEdge*, int>& depthDelta,
+              MakeValid::Method method)
+{
+    std::vector<OverlayEdge*>& edges = graph.getEdges();
+
+    std::vector<WindingSegment> segments;
+    for(OverlayEdge* e : edges) {
+        if(! e->isForward()) {
+            continue;
+        }
+        int delta = depthDelta.at(e);
+        const CoordinateSequence* pts = e->getCoordinatesRO();
+        for(std::size_t i = 1; i < pts->size(); i++) {
+            segments.push_back(WindingSegment{ &pts->getAt(i - 1), &pts->getAt(i), delta });
+        }
+    }
+    index::intervalrtree::SortedPackedIntervalRTree segmentIndex(segments.size());
+    for(WindingSegment& seg : segments) {
+        segmentIndex.insert(std::min(seg.p0->y, seg.p1->y), std::max(seg.p0->y, seg.p1->y), &seg);
+    }
+
+    auto edgeDelta = [&depthDelta](const OverlayEdge* e) {
+        return e->isForward() ? depthDelta.at(e) : - depthDelta.at(e->symOE());
+    };
+
+    std::unordered_map<const OverlayEdge*, int> winding;
+    std::vector<OverlayEdge*> component;
+    std::vector<OverlayEdge*> stack;
+    for(OverlayEdge* start : edges) {
+        if(start->isVisited()) {
+            continue;
+        }
+
+        // collect the connected component of the edge
+        component.clear();
+        start->markVisitedBoth();
+        stack.push_back(start);
+        while(! stack.empty()) {
+            OverlayEdge* e = stack.back();
+            stack.pop_back();
+            component.push_back(e);
+            component.push_back(e->symOE());
+            for(OverlayEdge* adj : { e->oNextOE(), e->symOE()->oNextOE() }) {
+                if(! adj->isVisited()) {
+                    adj->markVisitedBoth();
+                    stack.push_back(adj);
+                }
+            }
+        }
+
+        const Coordinate* minPt;
+        OverlayEdge* extEdge = findExteriorEdge(component, minPt);
+        WestRayWindingVisitor visitor(*minPt);
+        segmentIndex.query(minPt->y, minPt->y, &visitor);
+
+        // propagate the winding number across the component
+        winding[extEdge] = visitor.getWinding();
+        stack.push_back(extEdge);
+        while(! stack.empty()) {
+            OverlayEdge* e = stack.back();
+            stack.pop_back();
+            int w = winding[e];
+            OverlayEdge* next = static_cast<OverlayEdge*>(e->next());
+            if(winding.emplace(next, w).second) {
+                stack.push_back(next);
+            }
+            OverlayEdge* sym = e->symOE();
+            if(winding.emplace(sym, w - edgeDelta(e)).second) {
+                stack.push_back(sym);
+            }
+        }
+    }
+
+    for(OverlayEdge* e : edges) {
+        if(isInterior(winding[e], method) && ! isInterior(winding[e->symOE()], method)) {
+            e->markInResultArea();
+        }
+    }
+}
+
+static std::unique_ptr<geom::Geometry>
+buildWindingArea(const geom::Geometry* geom, const PrecisionModel* pm, MakeValid::Method method)
+{
+    EdgeNodingBuilder nodingBuilder(pm, nullptr);
+    std::vector<Edge*> edges = nodingBuilder.build(geom, nullptr);
+
+    OverlayGraph graph;
+    std::unordered_map<const OverlayEdge*, int> depthDelta;
+    for(Edge* e : edges) {
+        int delta = e->getDepthDelta(0);
+        depthDelta[graph.addEdge(e)] = delta;
+    }
+    labelWindings(graph, depthDelta, method);
+
+    const GeometryFactory* factory = geom->getFactory();
+    std::vector<OverlayEdge*> resultAreaEdges = graph.getResultAreaEdges();
+    PolygonBuilder polyBuilder(resultAreaEdges, factory);
+    std::vector<std::unique_ptr<Polygon>> polys = polyBuilder.getPolygons();
+    if(polys.empty()) {
+        return factory->createPolygon();
+    }
+    std::vector<std::unique_ptr<LineString>> lines;
+    std::vector<std::unique_ptr<Point>> points;
+    return OverlayUtil::createResultGeometry(polys, lines, points, factory);
+}
+
+/*
+ * Repairs polygonal geometries in a single noding pass, with the
+ * floating precision noder validated and snap-rounding as a fallback.
+ */
+static std::unique_ptr<geom::Geometry>
+MakeValidPolyWinding(const geom::Geometry* geom, MakeValid::Method method)
+{
+    const PrecisionModel* pm = geom->getFactory()->getPrecisionModel();
+    if(! OverlayUtil::isFloating(pm)) {
+        return buildWindingArea(geom, pm, method);
+    }
+    try {
+        return buildWindingArea(geom, pm, method);
+    }
+    catch(const util::TopologyException&) {
+        PrecisionModel pmSafe(PrecisionUtil::safeScale(geom));
+        return buildWindingArea(geom, &pmSafe, method);
+    }
+}
+
+static std::unique_ptr<geom::Geometry> MakeValidCollection(const geom::GeometryCollection* coll,
+                                                           MakeValid::Method method)
 {
     std::vector<std::unique_ptr<Geometry>> validGeoms;
+    MakeValid makeValid;
+    makeValid.setMethod(method);
     for(const auto& geom: *coll) {
-        validGeoms.push_back(MakeValid().build(geom.get()));
+        validGeoms.push_back(makeValid.build(geom.get()));
     }
     return coll->getFactory()->createGeometryCollection(std::move(validGeoms));
 }
@@ -325,11 +587,14 @@ std::unique_ptr<geom::Geometry> MakeValid::build(const geom::Geometry* geom)
     }
     if( typeId == GEOS_POLYGON ||
         typeId == GEOS_MULTIPOLYGON ) {
+        if( method != LINEWORK ) {
+            return MakeValidPolyWinding(geom, method);
+        }
         return MakeValidPoly(geom);
     }
     if( typeId == GEOS_GEOMETRYCOLLECTION ) {
         auto coll = dynamic_cast<const GeometryCollection*>(geom);
-        return MakeValidCollection(coll);
+        return MakeValidCollection(coll, method);
     }
 
     throw util::UnsupportedOperationException();
@@ -43,7 +43,9 @@ NodeMap::getNodeMap()
 Node*
 NodeMap::add(Node* n)
 {
-    nodeMap.insert(pair<geom::Coordinate, Node*>(n->getCoordinate(), n));
+    if(nodeMap.insert(pair<geom::Coordinate, Node*>(n->getCoordinate(), n)).second) {
+        nodeIndex.insert(n->getCoordinate(), n);
+    }
     return n;
 }
 
@@ -56,6 +58,7 @@ NodeMap::remove(geom::Coordinate& pt)
 {
     Node* n = find(pt);
     nodeMap.erase(pt);
+    nodeIndex.erase(pt);
     return n;
 }
 
@@ -76,12 +79,12 @@ NodeMap::getNodes(vector<Node*>& values)
 Node*
 NodeMap::find(const geom::Coordinate& coord)
 {
-    container::iterator found = nodeMap.find(coord);
-    if(found == nodeMap.end()) {
+    Node** found = nodeIndex.find(coord);
+    if(found == nullptr) {
         return nullptr;
     }
     else {
-        return found->second;
+        return *found;
     }
 }
 
@@ -0,0 +1,538 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/precision/LayerPrecisionReducer.h>
+#include <geos/precision/GeometryPrecisionReducer.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+#include <geos/geom/util/PolygonExtracter.h>
+#include <geos/index/kdtree/KdNode.h>
+#include <geos/index/kdtree/KdNodeVisitor.h>
+#include <geos/noding/MCIndexNoder.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/Noder.h>
+#include <geos/noding/snapround/HotPixel.h>
+#include <geos/noding/snapround/HotPixelIndex.h>
+#include <geos/noding/snapround/SnapRoundingIntersectionAdder.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/valid/RepeatedPointRemover.h>
+#include <geos/util.h>
+#include <geos/util/ParallelFor.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace geos::geom;
+using geos::index::kdtree::KdNode;
+using geos::index::kdtree::KdNodeVisitor;
+using geos::noding::NodedSegmentString;
+using geos::noding::SegmentString;
+using geos::noding::snapround::HotPixel;
+using geos::noding::snapround::HotPixelIndex;
+
+namespace geos {
+namespace precision { // geos.precision
+
+namespace { // module-statics
+
+// largest number of vertices sampled to place the strip boundaries
+const std::size_t MAX_BOUNDARY_SAMPLES = 100000;
+
+Coordinate
+round(const PrecisionModel& pm, const Coordinate& p)
+{
+    Coordinate pRound = p;
+    pm.makePrecise(pRound);
+    return pRound;
+}
+
+/*
+ * The hot pixels of a layer, in vertical strips each holding the pixels
+ * whose centre lies in it. Once built the index is only read, so it
+ * can be queried from several threads.
+ */
+class LayerPixelIndex {
+
+public:
+
+    LayerPixelIndex(const PrecisionModel& p_pm)
+        : pm(p_pm)
+        , gridSize(1.0 / p_pm.getScale())
+    {}
+
+    void
+    build(const std::vector<std::unique_ptr<CoordinateSequence>>& lines, unsigned int numThreads)
+    {
+        std::size_t numStrips = numThreads;
+        if(numStrips == 0) {
+            numStrips = std::max(1u, std::thread::hardware_concurrency());
+        }
+        computeBoundaries(lines, numStrips);
+        for(const auto& line : lines) {
+            Envelope env;
+            line->expandEnvelope(env);
+            lineEnvs.push_back(env);
+        }
+        for(std::size_t k = 0; k < numStrips; k++) {
+            strips.emplace_back(new HotPixelIndex(&pm));
+        }
+        util::parallelFor(numStrips, numThreads, [&](std::size_t k) {
+            buildStrip(k, lines);
+        });
+    }
+
+    /*
+     * Visits the hot pixels which may intersect a segment, in all the
+     * strips the segment runs through.
+     */
+    void
+    query(const Coordinate& p0, const Coordinate& p1, KdNodeVisitor& visitor) const
+    {
+        std::size_t kMin = stripOf(std::min(p0.x, p1.x) - gridSize);
+        std::size_t kMax = stripOf(std::max(p0.x, p1.x) + gridSize);
+        for(std::size_t k = kMin; k <= kMax; k++) {
+            strips[k]->query(p0, p1, visitor);
+        }
+    }
+
+private:
+
+    void
+    computeBoundaries(const std::vector<std::unique_ptr<CoordinateSequence>>& lines, std::size_t numStrips)
+    {
+        std::size_t numPts = 0;
+        for(const auto& line : lines) {
+            numPts += line->size();
+        }
+        std::size_t step = std::max<std::size_t>(1, numPts / MAX_BOUNDARY_SAMPLES);
+        std::vector<double> xs;
+        std::size_t i = 0;
+        for(const auto& line : lines) {
+            for(std::size_t j = 0; j < line->size(); j++, i++) {
+                if(i % step == 0) {
+                    xs.push_back(round(pm, line->getAt(j)).x);
+                }
+            }
+        }
+        for(std::size_t k = 1; k < numStrips && !xs.empty(); k++) {
+            auto it = xs.begin() + static_cast<std::ptrdiff_t>(k * xs.size() / numStrips);
+            std::nth_element(xs.begin(), it, xs.end());
+            boundaries.push_back(*it);
+        }
+        std::sort(boundaries.begin(), boundaries.end());
+    }
+
+    std::size_t
+    stripOf(double x) const
+    {
+        return static_cast<std::size_t>(
+                   std::upper_bound(boundaries.begin(), boundaries.end(), x) - boundaries.begin());
+    }
+
+    bool
+    isInStrip(std::size_t k, const Coordinate& pRound) const
+    {
+        return stripOf(pRound.x) == k;
+    }
+
+    /*
+     * Finds the pixels of the strip, from the vertices and intersections
+     * of the segments running within a pixel of it, then marks as nodes
+     * the pixels which a segment crosses without having a vertex in them.
+     * Only the pixels of the strip are changed, so strips can be built
+     * concurrently, and the result does not depend on the segment order.
+     */
+    void
+    buildStrip(std::size_t k, const std::vector<std::unique_ptr<CoordinateSequence>>& lines)
+    {
+        const double inf = std::numeric_limits<double>::infinity();
+        double minX = k == 0 ? -inf : boundaries[k - 1] - gridSize;
+        double maxX = k == boundaries.size() ? inf : boundaries[k] + gridSize;
+        HotPixelIndex& pixels = *strips[k];
+
+        // the runs of segments within the strip
+        std::vector<std::unique_ptr<NodedSegmentString>> runs;
+        std::vector<Coordinate> vertices;
+        for(std::size_t l = 0; l < lines.size(); l++) {
+            if(lineEnvs[l].getMaxX() < minX || lineEnvs[l].getMinX() > maxX) {
+                continue;
+            }
+            const CoordinateSequence* line = lines[l].get();
+            std::unique_ptr<CoordinateArraySequence> run;
+            for(std::size_t i = 0; i < line->size(); i++) {
+                const Coordinate& p = line->getAt(i);
+                if(isInStrip(k, round(pm, p))) {
+                    vertices.push_back(p);
+                }
+                if(i + 1 == line->size()) {
+                    break;
+                }
+                const Coordinate& q = line->getAt(i + 1);
+                if(std::max(p.x, q.x) < minX || std::min(p.x, q.x) > maxX) {
+                    if(run) {
+                        runs.emplace_back(new NodedSegmentString(run.release(), nullptr));
+                    }
+                    continue;
+                }
+                if(!run) {
+                    run.reset(new CoordinateArraySequence());
+                    run->add(p);
+                }
+                run->add(q);
+            }
+            if(run) {
+                runs.emplace_back(new NodedSegmentString(run.release(), nullptr));
+            }
+        }
+
+        noding::snapround::SnapRoundingIntersectionAdder intAdder(&pm);
+        noding::MCIndexNoder noder;
+        noder.setSegmentIntersector(&intAdder);
+        std::vector<SegmentString*> segStrings;
+        for(const auto& run : runs) {
+            segStrings.push_back(run.get());
+        }
+        noder.computeNodes(&segStrings);
+        std::unique_ptr<std::vector<Coordinate>> intPts = intAdder.getIntersections();
+        std::vector<Coordinate> stripIntPts;
+        for(const Coordinate& p : *intPts) {
+            if(isInStrip(k, round(pm, p))) {
+                stripIntPts.push_back(p);
+            }
+        }
+        pixels.addNodes(stripIntPts);
+        pixels.add(vertices);
+
+        struct NodeMarker : KdNodeVisitor {
+            const Coordinate& p0;
+            const Coordinate& p1;
+
+            NodeMarker(const Coordinate& pp0, const Coordinate& pp1)
+                : p0(pp0), p1(pp1) {}
+
+            void
+            visit(KdNode* node) override
+            {
+                HotPixel* hp = static_cast<HotPixel*>(node->getData());
+                if(!hp->isNode() && (hp->intersects(p0) || hp->intersects(p1))) {
+                    return;
+                }
+                if(hp->intersects(p0, p1)) {
+                    hp->setToNode();
+                }
+            }
+        };
+        for(const auto& run : runs) {
+            const CoordinateSequence* pts = run->getCoordinates();
+            for(std::size_t i = 0; i + 1 < pts->size(); i++) {
+                NodeMarker marker(pts->getAt(i), pts->getAt(i + 1));
+                pixels.query(pts->getAt(i), pts->getAt(i + 1), marker);
+            }
+        }
+    }
+
+    const PrecisionModel& pm;
+    double gridSize;
+    std::vector<double> boundaries;
+    std::vector<Envelope> lineEnvs;
+    std::vector<std::unique_ptr<HotPixelIndex>> strips;
+};
+
+/*
+ * Snap-rounds the edges of one geometry to the hot pixels of the layer,
+ * as SnapRoundingNoder does with its own hot pixels.
+ */
+class LayerSnapRoundingNoder : public noding::Noder {
+
+public:
+
+    LayerSnapRoundingNoder(const LayerPixelIndex& p_pixels, const PrecisionModel& p_pm)
+        : pixels(p_pixels)
+        , pm(p_pm)
+    {}
+
+    ~LayerSnapRoundingNoder() override
+    {
+        for(SegmentString* ss : snapped) {
+            delete ss;
+        }
+    }
+
+    void
+    computeNodes(std::vector<SegmentString*>* segStrings) override
+    {
+        for(SegmentString* ss : *segStrings) {
+            NodedSegmentString* snapSS = computeSegmentSnaps(ss);
+            if(snapSS != nullptr) {
+                snapped.push_back(snapSS);
+            }
+        }
+        for(SegmentString* ss : snapped) {
+            addVertexNodeSnaps(detail::down_cast<NodedSegmentString*>(ss));
+        }
+    }
+
+    std::vector<SegmentString*>*
+    getNodedSubstrings() const override
+    {
+        return NodedSegmentString::getNodedSubstrings(snapped);
+    }
+
+private:
+
+    NodedSegmentString*
+    computeSegmentSnaps(SegmentString* ss)
+    {
+        const CoordinateSequence* pts = ss->getCoordinates();
+        std::unique_ptr<CoordinateArraySequence> ptsRound(new CoordinateArraySequence());
+        for(std::size_t i = 0; i < pts->size(); i++) {
+            ptsRound->add(round(pm, pts->getAt(i)), false);
+        }
+
+        // if complete collapse this edge can be eliminated
+        if(ptsRound->size() <= 1) {
+            return nullptr;
+        }
+
+        NodedSegmentString* snapSS = new NodedSegmentString(ptsRound.release(), ss->getData());
+        std::size_t snapSSindex = 0;
+        for(std::size_t i = 0; i + 1 < pts->size(); i++) {
+            const Coordinate& currSnap = snapSS->getCoordinate(snapSSindex);
+            const Coordinate& p1 = pts->getAt(i + 1);
+            // skip segments which collapse completely
+            if(round(pm, p1).equals2D(currSnap)) {
+                continue;
+            }
+            snapSegment(pts->getAt(i), p1, snapSS, snapSSindex);
+            snapSSindex++;
+        }
+        return snapSS;
+    }
+
+    /*
+     * The hot pixels are not marked as nodes here, since the layer
+     * index has already marked all the pixels crossed by a segment.
+     */
+    void
+    snapSegment(const Coordinate& p0, const Coordinate& p1, NodedSegmentString* ss, std::size_t segIndex)
+    {
+        struct SnapVisitor : KdNodeVisitor {
+            const Coordinate& p0;
+            const Coordinate& p1;
+            NodedSegmentString* ss;
+            std::size_t segIndex;
+
+            SnapVisitor(const Coordinate& pp0, const Coordinate& pp1, NodedSegmentString* pss, std::size_t psegIndex)
+                : p0(pp0), p1(pp1), ss(pss), segIndex(psegIndex) {}
+
+            void
+            visit(KdNode* node) override
+            {
+                HotPixel* hp = static_cast<HotPixel*>(node->getData());
+                if(!hp->isNode() && (hp->intersects(p0) || hp->intersects(p1))) {
+                    return;
+                }
+                if(hp->intersects(p0, p1)) {
+                    ss->addIntersection(hp->getCoordinate(), segIndex);
+                }
+            }
+        };
+        SnapVisitor visitor(p0, p1, ss, segIndex);
+        pixels.query(p0, p1, visitor);
+    }
+
+    void
+    addVertexNodeSnaps(NodedSegmentString* ss)
+    {
+        struct VertexNodeVisitor : KdNodeVisitor {
+            const Coordinate& p0;
+            NodedSegmentString* ss;
+            std::size_t segIndex;
+
+            VertexNodeVisitor(const Coordinate& pp0, NodedSegmentString* pss, std::size_t psegIndex)
+                : p0(pp0), ss(pss), segIndex(psegIndex) {}
+
+            void
+            visit(KdNode* node) override
+            {
+                HotPixel* hp = static_cast<HotPixel*>(node->getData());
+                if(hp->isNode() && hp->getCoordinate().equals2D(p0)) {
+                    ss->addIntersection(p0, segIndex);
+                }
+            }
+        };
+        const CoordinateSequence* pts = ss->getCoordinates();
+        for(std::size_t i = 1; i + 1 < pts->size(); i++) {
+            const Coordinate& p0 = pts->getAt(i);
+            VertexNodeVisitor visitor(p0, ss, i);
+            pixels.query(p0, p0, visitor);
+        }
+    }
+
+    const LayerPixelIndex& pixels;
+    const PrecisionModel& pm;
+    std::vector<SegmentString*> snapped;
+};
+
+// Collects the components of a geometry which are not collections
+void
+addAtomicComponents(const Geometry* geom, std::vector<const Geometry*>& components)
+{
+    if(dynamic_cast<const GeometryCollection*>(geom)) {
+        for(std::size_t i = 0; i < geom->getNumGeometries(); i++) {
+            addAtomicComponents(geom->getGeometryN(i), components);
+        }
+        return;
+    }
+    components.push_back(geom);
+}
+
+} // end of module-statics
+
+/*public static*/
+std::vector<std::unique_ptr<Geometry>>
+LayerPrecisionReducer::reduce(const std::vector<const Geometry*>& geoms, const PrecisionModel& pm)
+{
+    LayerPrecisionReducer reducer(pm);
+    return reducer.reduce(geoms);
+}
+
+/*public*/
+std::vector<std::unique_ptr<Geometry>>
+LayerPrecisionReducer::reduce(const std::vector<const Geometry*>& geoms)
+{
+    std::vector<std::unique_ptr<Geometry>> result(geoms.size());
+    GeometryFactory::Ptr newFactory;
+    if(changePrecisionModel) {
+        int srid = geoms.empty() ? 0 : geoms.front()->getSRID();
+        newFactory = GeometryFactory::create(&targetPM, srid);
+    }
+
+    // nothing to snap to with a floating precision model
+    if(targetPM.isFloating()) {
+        for(std::size_t i = 0; i < geoms.size(); i++) {
+            result[i] = newFactory
+                        ? std::unique_ptr<Geometry>(newFactory->createGeometry(geoms[i]))
+                        : geoms[i]->clone();
+        }
+        return result;
+    }
+
+    // the rings of the polygons, including those of collections mixing
+    // polygons with other components, as the overlay nodes them
+    std::vector<std::unique_ptr<CoordinateSequence>> lines;
+    for(const Geometry* geom : geoms) {
+        std::vector<const Polygon*> polys;
+        geom::util::PolygonExtracter::getPolygons(*geom, polys);
+        std::vector<const LineString*> rings;
+        for(const Polygon* poly : polys) {
+            geom::util::LinearComponentExtracter::getLines(*poly, rings);
+        }
+        for(const LineString* ring : rings) {
+            auto pts = operation::valid::RepeatedPointRemover::removeRepeatedPoints(ring->getCoordinatesRO());
+            if(pts->size() >= 2) {
+                lines.emplace_back(std::move(pts));
+            }
+        }
+    }
+
+    LayerPixelIndex pixels(targetPM);
+    pixels.build(lines, numThreads);
+    lines.clear();
+
+    // lines and points are reduced pointwise
+    auto reducePointwise = [&](const Geometry* geom) {
+        std::unique_ptr<GeometryPrecisionReducer> reducer(newFactory
+                ? new GeometryPrecisionReducer(*newFactory)
+                : new GeometryPrecisionReducer(targetPM));
+        reducer->setChangePrecisionModel(changePrecisionModel);
+        reducer->setUseAreaReducer(false);
+        return reducer->reduce(*geom);
+    };
+
+    // polygons are rebuilt with their segments snapped to the layer hot pixels
+    auto reducePolygonal = [&](const Geometry* geom) {
+        LayerSnapRoundingNoder noder(pixels, targetPM);
+        std::unique_ptr<operation::overlayng::OverlayNG> ov(newFactory
+                ? new operation::overlayng::OverlayNG(geom, nullptr, newFactory.get(),
+                        operation::overlayng::OverlayNG::UNION)
+                : new operation::overlayng::OverlayNG(geom, nullptr, &targetPM,
+                        operation::overlayng::OverlayNG::UNION));
+        ov->setNoder(&noder);
+        ov->setAreaResultOnly(true);
+        return ov->getResult();
+    };
+
+    util::parallelFor(geoms.size(), numThreads, [&](std::size_t i) {
+        const Geometry* geom = geoms[i];
+        std::vector<const Polygon*> polys;
+        if(!geom->isPolygonal()) {
+            geom::util::PolygonExtracter::getPolygons(*geom, polys);
+        }
+
+        if(geom->isPolygonal()) {
+            result[i] = reducePolygonal(geom);
+        }
+        else if(polys.empty()) {
+            result[i] = reducePointwise(geom);
+        }
+        else {
+            /*
+             * A collection mixing polygons with other components:
+             * the polygons are reduced together as one polygonal
+             * geometry, followed in the result by the other components.
+             */
+            const GeometryFactory* factory = newFactory ? newFactory.get() : geom->getFactory();
+            std::vector<std::unique_ptr<Polygon>> polyClones;
+            for(const Polygon* poly : polys) {
+                polyClones.emplace_back(static_cast<Polygon*>(poly->clone().release()));
+            }
+            auto polygonal = geom->getFactory()->createMultiPolygon(std::move(polyClones));
+            std::unique_ptr<Geometry> reducedPolygonal = reducePolygonal(polygonal.get());
+
+            std::vector<std::unique_ptr<Geometry>> parts;
+            for(std::size_t k = 0; k < reducedPolygonal->getNumGeometries(); k++) {
+                const Geometry* part = reducedPolygonal->getGeometryN(k);
+                if(!part->isEmpty()) {
+                    parts.push_back(part->clone());
+                }
+            }
+            std::vector<const Geometry*> components;
+            addAtomicComponents(geom, components);
+            for(const Geometry* component : components) {
+                if(component->isPolygonal()) {
+                    continue;
+                }
+                std::unique_ptr<Geometry> reduced = reducePointwise(component);
+                if(!reduced->isEmpty()) {
+                    parts.push_back(std::move(reduced));
+                }
+            }
+            result[i] = factory->createGeometryCollection(std::move(parts));
+        }
+        result[i]->setSRID(geom->getSRID());
+    });
+    return result;
+}
+
+} // namespace geos.precision
+} // namespace geos
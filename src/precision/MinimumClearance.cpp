@@ -18,12 +18,16 @@
 
 #include <geos/algorithm/Distance.h>
 #include <geos/precision/MinimumClearance.h>
-#include <geos/index/strtree/STRtree.h>
+#include <geos/index/strtree/SimpleSTRdistance.h>
+#include <geos/index/strtree/SimpleSTRtree.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/CoordinateArraySequenceFactory.h>
 #include <geos/operation/distance/FacetSequenceTreeBuilder.h>
 #include <geos/geom/LineSegment.h>
 
+#include <limits>
+#include <vector>
+
 using namespace geos::geom;
 using namespace geos::operation::distance;
 using namespace geos::index::strtree;
@@ -31,139 +35,197 @@ using namespace geos::index::strtree;
 namespace geos {
 namespace precision {
 
-MinimumClearance::MinimumClearance(const Geometry* g) : inputGeom(g) {}
+namespace { // module-statics
 
-double
-MinimumClearance::getDistance()
-{
-    compute();
-    return minClearance;
-}
+// Seems to be better to use a minimum node capacity
+const std::size_t STR_TREE_NODE_CAPACITY = 4;
 
-std::unique_ptr<LineString>
-MinimumClearance::getLine()
-{
-    compute();
+class MinClearanceDistance : public ItemDistance {
+private:
+    double minDist;
+    std::vector<Coordinate> minPts;
 
-    // return empty line string if no min pts were found
-    if(minClearance == std::numeric_limits<double>::infinity()) {
-        return inputGeom->getFactory()->createLineString();
+    void
+    updatePts(const Coordinate& p, const Coordinate& seg0, const Coordinate& seg1)
+    {
+        LineSegment seg(seg0, seg1);
+
+        minPts[0] = p;
+        seg.closestPoint(p, minPts[1]);
     }
 
-    return inputGeom->getFactory()->createLineString(minClearancePts->clone());
-}
+public:
+    MinClearanceDistance() :
+        minDist(std::numeric_limits<double>::infinity()),
+        minPts(std::vector<Coordinate>(2))
+    {}
 
-void
-MinimumClearance::compute()
-{
-    class MinClearanceDistance : public ItemDistance {
-    private:
-        double minDist;
-        std::vector<Coordinate> minPts;
-
-        void
-        updatePts(const Coordinate& p, const Coordinate& seg0, const Coordinate& seg1)
-        {
-            LineSegment seg(seg0, seg1);
-
-            minPts[0] = p;
-            seg.closestPoint(p, minPts[1]);
-        }
+    const std::vector<Coordinate>*
+    getCoordinates()
+    {
+        return &minPts;
+    }
 
-    public:
-        MinClearanceDistance() :
-            minDist(std::numeric_limits<double>::infinity()),
-            minPts(std::vector<Coordinate>(2))
-        {}
+    double
+    distance(const ItemBoundable* b1, const ItemBoundable* b2) override
+    {
+        FacetSequence* fs1 = static_cast<FacetSequence*>(b1->getItem());
+        FacetSequence* fs2 = static_cast<FacetSequence*>(b2->getItem());
 
-        const std::vector<Coordinate>*
-        getCoordinates()
-        {
-            return &minPts;
-        }
+        minDist = std::numeric_limits<double>::infinity();
 
-        double
-        distance(const ItemBoundable* b1, const ItemBoundable* b2) override
-        {
-            FacetSequence* fs1 = static_cast<FacetSequence*>(b1->getItem());
-            FacetSequence* fs2 = static_cast<FacetSequence*>(b2->getItem());
+        return distance(fs1, fs2);
+    }
 
-            minDist = std::numeric_limits<double>::infinity();
+    double
+    distance(const FacetSequence* fs1, const FacetSequence* fs2)
+    {
+        // Compute MinClearance distance metric
 
-            return distance(fs1, fs2);
+        vertexDistance(fs1, fs2);
+        if(fs1->size() == 1 && fs2->size() == 1) {
+            return minDist;
+        }
+        if(minDist <= 0.0) {
+            return minDist;
         }
 
-        double
-        distance(const FacetSequence* fs1, const FacetSequence* fs2)
-        {
-            // Compute MinClearance distance metric
-
-            vertexDistance(fs1, fs2);
-            if(fs1->size() == 1 && fs2->size() == 1) {
-                return minDist;
-            }
-            if(minDist <= 0.0) {
-                return minDist;
-            }
-
-            segmentDistance(fs1, fs2);
-            if(minDist <= 0.0) {
-                return minDist;
-            }
-
-            segmentDistance(fs2, fs1);
+        segmentDistance(fs1, fs2);
+        if(minDist <= 0.0) {
             return minDist;
         }
 
-        double
-        vertexDistance(const FacetSequence* fs1, const FacetSequence* fs2)
-        {
-            for(size_t i1 = 0; i1 < fs1->size(); i1++) {
-                for(size_t i2 = 0; i2 < fs2->size(); i2++) {
-                    const Coordinate* p1 = fs1->getCoordinate(i1);
-                    const Coordinate* p2 = fs2->getCoordinate(i2);
-                    if(!p1->equals2D(*p2)) {
-                        double d = p1->distance(*p2);
-                        if(d < minDist) {
-                            minDist = d;
-                            minPts[0] = *p1;
-                            minPts[1] = *p2;
-                            if(d == 0.0) {
-                                return d;
-                            }
+        segmentDistance(fs2, fs1);
+        return minDist;
+    }
+
+    double
+    vertexDistance(const FacetSequence* fs1, const FacetSequence* fs2)
+    {
+        for(size_t i1 = 0; i1 < fs1->size(); i1++) {
+            for(size_t i2 = 0; i2 < fs2->size(); i2++) {
+                const Coordinate* p1 = fs1->getCoordinate(i1);
+                const Coordinate* p2 = fs2->getCoordinate(i2);
+                if(!p1->equals2D(*p2)) {
+                    double d = p1->distance(*p2);
+                    if(d < minDist) {
+                        minDist = d;
+                        minPts[0] = *p1;
+                        minPts[1] = *p2;
+                        if(d == 0.0) {
+                            return d;
                         }
                     }
                 }
             }
-            return minDist;
         }
+        return minDist;
+    }
 
-        double
-        segmentDistance(const FacetSequence* fs1, const FacetSequence* fs2)
-        {
-            for(size_t i1 = 0; i1 < fs1->size(); i1++) {
-                for(size_t i2 = 1; i2 < fs2->size(); i2++) {
-                    const Coordinate* p = fs1->getCoordinate(i1);
-
-                    const Coordinate* seg0 = fs2->getCoordinate(i2 - 1);
-                    const Coordinate* seg1 = fs2->getCoordinate(i2);
-
-                    if(!(p->equals2D(*seg0) || p->equals2D(*seg1))) {
-                        double d = geos::algorithm::Distance::pointToSegment(*p, *seg0, *seg1);
-                        if(d < minDist) {
-                            minDist = d;
-                            updatePts(*p, *seg0, *seg1);
-                            if(d == 0.0) {
-                                return d;
-                            }
+    double
+    segmentDistance(const FacetSequence* fs1, const FacetSequence* fs2)
+    {
+        for(size_t i1 = 0; i1 < fs1->size(); i1++) {
+            for(size_t i2 = 1; i2 < fs2->size(); i2++) {
+                const Coordinate* p = fs1->getCoordinate(i1);
+
+                const Coordinate* seg0 = fs2->getCoordinate(i2 - 1);
+                const Coordinate* seg1 = fs2->getCoordinate(i2);
+
+                if(!(p->equals2D(*seg0) || p->equals2D(*seg1))) {
+                    double d = geos::algorithm::Distance::pointToSegment(*p, *seg0, *seg1);
+                    if(d < minDist) {
+                        minDist = d;
+                        updatePts(*p, *seg0, *seg1);
+                        if(d == 0.0) {
+                            return d;
                         }
                     }
                 }
             }
-            return minDist;
         }
-    };
+        return minDist;
+    }
+};
+
+/*
+ * Computes the length of the shortest segment of the facet sequences,
+ * which is an upper bound of the minimum clearance.
+ */
+double
+shortestSegment(const std::vector<FacetSequence>& facets, Coordinate& p0, Coordinate& p1)
+{
+    double minLength = std::numeric_limits<double>::infinity();
+    for(const FacetSequence& fs : facets) {
+        for(std::size_t i = 1; i < fs.size(); i++) {
+            const Coordinate* q0 = fs.getCoordinate(i - 1);
+            const Coordinate* q1 = fs.getCoordinate(i);
+            if(q0->equals2D(*q1)) {
+                continue;
+            }
+            double d = q0->distance(*q1);
+            if(d < minLength) {
+                minLength = d;
+                p0 = *q0;
+                p1 = *q1;
+            }
+        }
+    }
+    return minLength;
+}
 
+/*
+ * Computes the minimum clearance of the facet sequences if it is less
+ * than maxDistance, leaving its points in mcd, or infinity otherwise.
+ * Pairs of facet sequences whose envelopes are maxDistance apart are
+ * never expanded.
+ */
+double
+nearestClearance(const std::vector<FacetSequence>& facets, double maxDistance,
+                 MinClearanceDistance& mcd)
+{
+    SimpleSTRtree tree(STR_TREE_NODE_CAPACITY);
+    for(const FacetSequence& fs : facets) {
+        tree.insert(fs.getEnvelope(), const_cast<FacetSequence*>(&fs));
+    }
+    SimpleSTRdistance strDist(tree.getRoot(), tree.getRoot(), &mcd);
+    std::pair<const void*, const void*> nearest = strDist.nearestNeighbour(maxDistance);
+    if(!nearest.first) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return mcd.distance(
+               static_cast<const FacetSequence*>(nearest.first),
+               static_cast<const FacetSequence*>(nearest.second));
+}
+
+} // end of module-statics
+
+MinimumClearance::MinimumClearance(const Geometry* g) : inputGeom(g) {}
+
+double
+MinimumClearance::getDistance()
+{
+    compute();
+    return minClearance;
+}
+
+std::unique_ptr<LineString>
+MinimumClearance::getLine()
+{
+    compute();
+
+    // return empty line string if no min pts were found
+    if(minClearance == std::numeric_limits<double>::infinity()) {
+        return inputGeom->getFactory()->createLineString();
+    }
+
+    return inputGeom->getFactory()->createLineString(minClearancePts->clone());
+}
+
+void
+MinimumClearance::compute()
+{
     // already computed
     if(minClearancePts.get() != nullptr) {
         return;
@@ -179,17 +241,47 @@ MinimumClearance::compute()
         return;
     }
 
-    auto tree = FacetSequenceTreeBuilder::build(inputGeom);
+    std::vector<FacetSequence> facets = FacetSequenceTreeBuilder::computeFacetSequences(inputGeom);
+
+    // the shortest segment bounds the search, and is the result
+    // if no pair of facets is closer
+    Coordinate p0, p1;
+    minClearance = shortestSegment(facets, p0, p1);
+
     MinClearanceDistance mcd;
-    std::pair<const void*, const void*> nearest = tree->nearestNeighbour(&mcd);
+    double nearest = nearestClearance(facets, minClearance, mcd);
+    if(nearest < minClearance) {
+        minClearance = nearest;
+        const std::vector<Coordinate>* minClearancePtsVec = mcd.getCoordinates();
+        p0 = (*minClearancePtsVec)[0];
+        p1 = (*minClearancePtsVec)[1];
+    }
 
-    minClearance = mcd.distance(
-                       static_cast<const FacetSequence*>(nearest.first),
-                       static_cast<const FacetSequence*>(nearest.second));
+    minClearancePts->setAt(p0, 0);
+    minClearancePts->setAt(p1, 1);
+}
+
+bool
+MinimumClearance::isAtLeast(double clearance)
+{
+    if(minClearancePts.get() != nullptr) {
+        return minClearance >= clearance;
+    }
+
+    if(inputGeom->isEmpty()) {
+        return true;
+    }
+
+    std::vector<FacetSequence> facets = FacetSequenceTreeBuilder::computeFacetSequences(inputGeom);
 
-    const std::vector<Coordinate>* minClearancePtsVec = mcd.getCoordinates();
-    minClearancePts->setAt((*minClearancePtsVec)[0], 0);
-    minClearancePts->setAt((*minClearancePtsVec)[1], 1);
+    Coordinate p0, p1;
+    if(shortestSegment(facets, p0, p1) < clearance) {
+        return false;
+    }
+
+    // only pairs of facets closer than the clearance are searched
+    MinClearanceDistance mcd;
+    return nearestClearance(facets, clearance, mcd) >= clearance;
 }
 
 
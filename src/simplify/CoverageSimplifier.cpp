@@ -0,0 +1,552 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/CoverageSimplifier.h>
+#include <geos/simplify/DouglasPeuckerLineSimplifier.h>
+#include <geos/simplify/LineSegmentIndex.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/PointLocation.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/ParallelFor.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace geos::geom;
+using geos::algorithm::LineIntersector;
+using geos::algorithm::PointLocation;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+namespace { // module-statics
+
+// number of times the tolerance of an edge is halved before the edge
+// is left unsimplified
+const int MAX_REFINEMENTS = 4;
+
+struct CoverageEdge {
+    Coordinate::Vect pts;
+    Coordinate::Vect result;
+    double tolerance;
+    int numRefinements;
+
+    bool
+    isSimplified() const
+    {
+        return result.size() < pts.size();
+    }
+};
+
+// An edge of a ring, with the direction in which the ring runs along it
+struct RingEdge {
+    std::size_t edge;
+    bool isForward;
+};
+
+/*
+ * The rings of a coverage, split into edges at the nodes. An edge is
+ * shared by the rings running along it, in either direction.
+ */
+class CoverageEdgeSet {
+
+public:
+
+    void
+    addRing(const CoordinateSequence& seq)
+    {
+        // the distinct vertices of the ring, without the closing point
+        Coordinate::Vect ringPts;
+        for(std::size_t i = 0; i + 1 < seq.size(); i++) {
+            const Coordinate& p = seq.getAt(i);
+            if(ringPts.empty() || !ringPts.back().equals2D(p)) {
+                ringPts.push_back(p);
+            }
+        }
+        while(ringPts.size() > 1 && ringPts.back().equals2D(ringPts.front())) {
+            ringPts.pop_back();
+        }
+        ringVertices.push_back(std::move(ringPts));
+    }
+
+    void
+    build()
+    {
+        findNodes();
+        for(const Coordinate::Vect& ringPts : ringVertices) {
+            rings.push_back(buildRingEdges(ringPts));
+        }
+        ringVertices.clear();
+        nodes.clear();
+        edgeIndex.clear();
+    }
+
+    std::vector<CoverageEdge>&
+    getEdges()
+    {
+        return edges;
+    }
+
+    const std::vector<std::vector<RingEdge>>&
+    getRings() const
+    {
+        return rings;
+    }
+
+    std::size_t
+    getNumRingPoints(std::size_t ring) const
+    {
+        std::size_t n = 1;
+        for(const RingEdge& re : rings[ring]) {
+            n += edges[re.edge].result.size() - 1;
+        }
+        return n;
+    }
+
+    Coordinate::Vect
+    getRingPoints(std::size_t ring) const
+    {
+        Coordinate::Vect ringPts;
+        for(const RingEdge& re : rings[ring]) {
+            const Coordinate::Vect& edgePts = edges[re.edge].result;
+            if(re.isForward) {
+                ringPts.insert(ringPts.end(), edgePts.begin() + (ringPts.empty() ? 0 : 1), edgePts.end());
+            }
+            else {
+                ringPts.insert(ringPts.end(), edgePts.rbegin() + (ringPts.empty() ? 0 : 1), edgePts.rend());
+            }
+        }
+        return ringPts;
+    }
+
+private:
+
+    // the first two distinct neighbours of a vertex, and whether it has more
+    struct Neighbours {
+        const Coordinate* n0 = nullptr;
+        const Coordinate* n1 = nullptr;
+        std::size_t count = 0;
+
+        void
+        add(const Coordinate& p)
+        {
+            if(count == 0) {
+                n0 = &p;
+                count = 1;
+            }
+            else if(count == 1 && !p.equals2D(*n0)) {
+                n1 = &p;
+                count = 2;
+            }
+            else if(count == 2 && !p.equals2D(*n0) && !p.equals2D(*n1)) {
+                count = 3;
+            }
+        }
+    };
+
+    void
+    findNodes()
+    {
+        std::size_t numPts = 0;
+        for(const Coordinate::Vect& ringPts : ringVertices) {
+            numPts += ringPts.size();
+        }
+        std::unordered_map<Coordinate, Neighbours, Coordinate::HashCode> neighbours;
+        neighbours.reserve(numPts);
+        for(const Coordinate::Vect& ringPts : ringVertices) {
+            std::size_t n = ringPts.size();
+            for(std::size_t i = 0; i < n; i++) {
+                Neighbours& nb = neighbours[ringPts[i]];
+                nb.add(ringPts[(i + n - 1) % n]);
+                nb.add(ringPts[(i + 1) % n]);
+            }
+        }
+        for(const auto& entry : neighbours) {
+            if(entry.second.count != 2) {
+                nodes.insert(entry.first);
+            }
+        }
+    }
+
+    bool
+    isNode(const Coordinate& p) const
+    {
+        return nodes.find(p) != nodes.end();
+    }
+
+    std::vector<RingEdge>
+    buildRingEdges(const Coordinate::Vect& ringPts)
+    {
+        std::vector<RingEdge> ringEdges;
+        std::size_t n = ringPts.size();
+        if(n == 0) {
+            return ringEdges;
+        }
+
+        std::size_t start = n;
+        for(std::size_t i = 0; i < n; i++) {
+            if(isNode(ringPts[i])) {
+                start = i;
+                break;
+            }
+        }
+
+        // a ring without nodes is a single closed edge, which starts at
+        // its lowest vertex in both the rings running along it
+        if(start == n) {
+            std::size_t minIndex = 0;
+            for(std::size_t i = 1; i < n; i++) {
+                if(ringPts[i].compareTo(ringPts[minIndex]) < 0) {
+                    minIndex = i;
+                }
+            }
+            bool isForward = ringPts[(minIndex + 1) % n].compareTo(ringPts[(minIndex + n - 1) % n]) <= 0;
+            Coordinate::Vect edgePts;
+            edgePts.reserve(n + 1);
+            for(std::size_t k = 0; k <= n; k++) {
+                std::size_t i = isForward ? (minIndex + k) % n : (minIndex + n - k % n) % n;
+                edgePts.push_back(ringPts[i]);
+            }
+            ringEdges.push_back(RingEdge{ addEdge(std::move(edgePts)), isForward });
+            return ringEdges;
+        }
+
+        Coordinate::Vect edgePts{ ringPts[start] };
+        for(std::size_t k = 1; k <= n; k++) {
+            const Coordinate& p = ringPts[(start + k) % n];
+            edgePts.push_back(p);
+            if(k == n || isNode(p)) {
+                ringEdges.push_back(addCanonicalEdge(std::move(edgePts)));
+                edgePts = Coordinate::Vect{ p };
+            }
+        }
+        return ringEdges;
+    }
+
+    /*
+     * Edges are stored in the direction which starts at the lower node,
+     * so both the rings running along an edge find it from its first
+     * segment.
+     */
+    RingEdge
+    addCanonicalEdge(Coordinate::Vect&& edgePts)
+    {
+        int comp = edgePts.front().compareTo(edgePts.back());
+        if(comp == 0) {
+            comp = edgePts[1].compareTo(edgePts[edgePts.size() - 2]);
+        }
+        bool isForward = comp <= 0;
+        if(!isForward) {
+            std::reverse(edgePts.begin(), edgePts.end());
+        }
+        return RingEdge{ addEdge(std::move(edgePts)), isForward };
+    }
+
+    std::size_t
+    addEdge(Coordinate::Vect&& edgePts)
+    {
+        auto key = std::make_pair(edgePts[0], edgePts[1]);
+        auto it = edgeIndex.find(key);
+        if(it != edgeIndex.end()) {
+            return it->second;
+        }
+        std::size_t index = edges.size();
+        edgeIndex.insert(std::make_pair(key, index));
+        edges.push_back(CoverageEdge{ std::move(edgePts), Coordinate::Vect(), 0.0, 0 });
+        return index;
+    }
+
+    std::vector<Coordinate::Vect> ringVertices;
+    std::unordered_set<Coordinate, Coordinate::HashCode> nodes;
+    std::map<std::pair<Coordinate, Coordinate>, std::size_t> edgeIndex;
+    std::vector<CoverageEdge> edges;
+    std::vector<std::vector<RingEdge>> rings;
+};
+
+/*
+ * Finds the simplified edges which change the topology of the coverage.
+ */
+class EdgeConflictFinder {
+
+public:
+
+    EdgeConflictFinder(const std::vector<CoverageEdge>& p_edges)
+        : edges(p_edges)
+    {
+        for(std::size_t e = 0; e < edges.size(); e++) {
+            const Coordinate::Vect& pts = edges[e].result;
+            for(std::size_t k = 0; k + 1 < pts.size(); k++) {
+                segments.emplace_back(pts[k], pts[k + 1]);
+                segmentEdge.push_back(e);
+                segmentPosition.push_back(k);
+            }
+        }
+        for(const LineSegment& seg : segments) {
+            index.add(&seg);
+        }
+    }
+
+    /*
+     * Checks each segment of the edge against the segments of all the
+     * edges, including its own. Segments may only touch at an endpoint
+     * shared by two consecutive segments of an edge, or at a node.
+     * The area between a segment and the part of the original edge it
+     * replaces must not contain another vertex.
+     */
+    bool
+    hasConflict(std::size_t e)
+    {
+        const CoverageEdge& edge = edges[e];
+        LineIntersector li;
+        std::vector<const Coordinate*> sweptRing;
+
+        std::size_t i0 = 0;
+        for(std::size_t k = 0; k + 1 < edge.result.size(); k++) {
+            const Coordinate& p0 = edge.result[k];
+            const Coordinate& p1 = edge.result[k + 1];
+            std::size_t i1 = i0 + 1;
+            while(!edge.pts[i1].equals2D(p1)) {
+                i1++;
+            }
+
+            Envelope env;
+            sweptRing.clear();
+            for(std::size_t i = i0; i <= i1; i++) {
+                env.expandToInclude(edge.pts[i]);
+                sweptRing.push_back(&edge.pts[i]);
+            }
+            sweptRing.push_back(&edge.pts[i0]);
+
+            LineSegment querySeg(env.getMinX(), env.getMinY(), env.getMaxX(), env.getMaxY());
+            auto found = index.query(&querySeg);
+            for(const LineSegment* seg : *found) {
+                std::size_t s = static_cast<std::size_t>(seg - segments.data());
+                if(segmentEdge[s] == e && segmentPosition[s] == k) {
+                    continue;
+                }
+                li.computeIntersection(p0, p1, seg->p0, seg->p1);
+                if(li.hasIntersection() && !isAllowedTouch(li, e, k, s)) {
+                    return true;
+                }
+                if(i1 == i0 + 1) {
+                    continue;
+                }
+                for(const Coordinate* q : { &seg->p0, &seg->p1 }) {
+                    if(q->equals2D(p0) || q->equals2D(p1) || !env.contains(*q)) {
+                        continue;
+                    }
+                    if(PointLocation::locateInRing(*q, sweptRing) != Location::EXTERIOR) {
+                        return true;
+                    }
+                }
+            }
+            i0 = i1;
+        }
+        return false;
+    }
+
+private:
+
+    bool
+    isEdgeEndpoint(std::size_t e, const Coordinate& p) const
+    {
+        const Coordinate::Vect& pts = edges[e].result;
+        return p.equals2D(pts.front()) || p.equals2D(pts.back());
+    }
+
+    bool
+    isAllowedTouch(const LineIntersector& li, std::size_t e, std::size_t k, std::size_t s) const
+    {
+        if(li.getIntersectionNum() > 1) {
+            return false;
+        }
+        const Coordinate& p = li.getIntersection(0);
+        const LineSegment& seg = segments[s];
+        const Coordinate::Vect& pts = edges[e].result;
+        bool isSegmentEndpoints = (p.equals2D(pts[k]) || p.equals2D(pts[k + 1]))
+                                  && (p.equals2D(seg.p0) || p.equals2D(seg.p1));
+        if(!isSegmentEndpoints) {
+            return false;
+        }
+        std::size_t f = segmentEdge[s];
+        std::size_t pos = segmentPosition[s];
+        if(f == e && (pos + 1 == k || k + 1 == pos)) {
+            return true;
+        }
+        return isEdgeEndpoint(e, p) && isEdgeEndpoint(f, p);
+    }
+
+    const std::vector<CoverageEdge>& edges;
+    std::vector<LineSegment> segments;
+    std::vector<std::size_t> segmentEdge;
+    std::vector<std::size_t> segmentPosition;
+    LineSegmentIndex index;
+};
+
+void
+addRings(const Polygon* poly, CoverageEdgeSet& edgeSet)
+{
+    if(poly->isEmpty()) {
+        return;
+    }
+    edgeSet.addRing(*poly->getExteriorRing()->getCoordinatesRO());
+    for(std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+        edgeSet.addRing(*poly->getInteriorRingN(i)->getCoordinatesRO());
+    }
+}
+
+std::unique_ptr<Polygon>
+buildPolygon(const Polygon* poly, const CoverageEdgeSet& edgeSet, std::size_t& ring)
+{
+    const GeometryFactory* factory = poly->getFactory();
+    if(poly->isEmpty()) {
+        return std::unique_ptr<Polygon>(static_cast<Polygon*>(poly->clone().release()));
+    }
+    auto csf = factory->getCoordinateSequenceFactory();
+    auto shell = factory->createLinearRing(csf->create(edgeSet.getRingPoints(ring++)));
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    for(std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+        holes.push_back(factory->createLinearRing(csf->create(edgeSet.getRingPoints(ring++))));
+    }
+    return factory->createPolygon(std::move(shell), std::move(holes));
+}
+
+} // end of module-statics
+
+/*public static*/
+std::vector<std::unique_ptr<Geometry>>
+CoverageSimplifier::simplify(const std::vector<const Geometry*>& coverage, double tolerance)
+{
+    CoverageSimplifier simp(coverage);
+    simp.setDistanceTolerance(tolerance);
+    return simp.getResult();
+}
+
+/*public*/
+void
+CoverageSimplifier::setDistanceTolerance(double tolerance)
+{
+    if(tolerance < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+    distanceTolerance = tolerance;
+}
+
+/*public*/
+std::vector<std::unique_ptr<Geometry>>
+CoverageSimplifier::getResult()
+{
+    CoverageEdgeSet edgeSet;
+    for(const Geometry* geom : coverage) {
+        if(const Polygon* poly = dynamic_cast<const Polygon*>(geom)) {
+            addRings(poly, edgeSet);
+        }
+        else if(const MultiPolygon* mpoly = dynamic_cast<const MultiPolygon*>(geom)) {
+            for(std::size_t i = 0; i < mpoly->getNumGeometries(); i++) {
+                addRings(mpoly->getGeometryN(i), edgeSet);
+            }
+        }
+        else {
+            throw util::IllegalArgumentException("Coverage geometries must be polygonal");
+        }
+    }
+    edgeSet.build();
+
+    std::vector<CoverageEdge>& edges = edgeSet.getEdges();
+    std::vector<std::size_t> pending;
+    for(std::size_t e = 0; e < edges.size(); e++) {
+        edges[e].tolerance = distanceTolerance;
+        pending.push_back(e);
+    }
+
+    // simplify the edges, then simplify again those which change the
+    // topology with a smaller tolerance, until none does. An edge
+    // refined too many times gets its input points back, which may in
+    // turn conflict with other edges, so all are checked again.
+    std::vector<char> isConflict(edges.size());
+    bool isChanged = true;
+    while(isChanged) {
+        util::parallelFor(pending.size(), numThreads, [&](std::size_t i) {
+            CoverageEdge& edge = edges[pending[i]];
+            edge.result = std::move(*DouglasPeuckerLineSimplifier::simplify(edge.pts, edge.tolerance));
+        });
+
+        std::fill(isConflict.begin(), isConflict.end(), 0);
+        const auto& rings = edgeSet.getRings();
+        for(std::size_t r = 0; r < rings.size(); r++) {
+            if(!rings[r].empty() && edgeSet.getNumRingPoints(r) < 4) {
+                for(const RingEdge& re : rings[r]) {
+                    isConflict[re.edge] = 1;
+                }
+            }
+        }
+        EdgeConflictFinder conflictFinder(edges);
+        util::parallelFor(edges.size(), numThreads, [&](std::size_t e) {
+            if(!isConflict[e] && edges[e].isSimplified() && conflictFinder.hasConflict(e)) {
+                isConflict[e] = 1;
+            }
+        });
+
+        pending.clear();
+        isChanged = false;
+        for(std::size_t e = 0; e < edges.size(); e++) {
+            CoverageEdge& edge = edges[e];
+            if(!isConflict[e] || !edge.isSimplified()) {
+                continue;
+            }
+            isChanged = true;
+            if(++edge.numRefinements > MAX_REFINEMENTS) {
+                edge.result = edge.pts;
+            }
+            else {
+                edge.tolerance /= 2;
+                pending.push_back(e);
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Geometry>> result;
+    std::size_t ring = 0;
+    for(const Geometry* geom : coverage) {
+        if(const Polygon* poly = dynamic_cast<const Polygon*>(geom)) {
+            result.push_back(buildPolygon(poly, edgeSet, ring));
+        }
+        else {
+            const MultiPolygon* mpoly = static_cast<const MultiPolygon*>(geom);
+            std::vector<std::unique_ptr<Polygon>> polys;
+            for(std::size_t i = 0; i < mpoly->getNumGeometries(); i++) {
+                polys.push_back(buildPolygon(mpoly->getGeometryN(i), edgeSet, ring));
+            }
+            result.push_back(mpoly->getFactory()->createMultiPolygon(std::move(polys)));
+        }
+        result.back()->setSRID(geom->getSRID());
+    }
+    return result;
+}
+
+} // namespace geos::simplify
+} // namespace geos
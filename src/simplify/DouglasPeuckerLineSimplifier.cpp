@@ -20,6 +20,8 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/LineSegment.h>
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 #include <memory> // for unique_ptr
 
@@ -39,6 +41,52 @@ DouglasPeuckerLineSimplifier::simplify(
     return simp.simplify();
 }
 
+/*public static*/
+std::vector<double>
+DouglasPeuckerLineSimplifier::computeSignificance(
+    const DouglasPeuckerLineSimplifier::CoordsVect& nPts)
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> significance(nPts.size(), inf);
+    if(nPts.size() < 3) {
+        return significance;
+    }
+
+    // the sections still to split, with the significance of the point
+    // which split their enclosing section
+    struct Section {
+        std::size_t i;
+        std::size_t j;
+        double maxSignificance;
+    };
+    std::vector<Section> stack{ Section{ 0, nPts.size() - 1, inf } };
+
+    while(!stack.empty()) {
+        Section sec = stack.back();
+        stack.pop_back();
+        if(sec.i + 1 >= sec.j) {
+            continue;
+        }
+
+        geos::geom::LineSegment seg(nPts[sec.i], nPts[sec.j]);
+        double maxDistance = -1.0;
+        std::size_t maxIndex = sec.i;
+        for(std::size_t k = sec.i + 1; k < sec.j; k++) {
+            double distance = seg.distance(nPts[k]);
+            if(distance > maxDistance) {
+                maxDistance = distance;
+                maxIndex = k;
+            }
+        }
+
+        double sig = std::min(maxDistance, sec.maxSignificance);
+        significance[maxIndex] = sig;
+        stack.push_back(Section{ sec.i, maxIndex, sig });
+        stack.push_back(Section{ maxIndex, sec.j, sig });
+    }
+    return significance;
+}
+
 /*public*/
 DouglasPeuckerLineSimplifier::DouglasPeuckerLineSimplifier(
     const DouglasPeuckerLineSimplifier::CoordsVect& nPts)
@@ -0,0 +1,211 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/MultiResolutionSimplifier.h>
+#include <geos/simplify/DouglasPeuckerLineSimplifier.h>
+#include <geos/simplify/VWLineSimplifier.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/util/GeometryTransformer.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+namespace { // module-statics
+
+using SignificanceMap = std::unordered_map<const Geometry*, std::vector<double>>;
+
+/*
+ * Collects the lines of a geometry, simplifying each one with
+ * Douglas-Peucker, or adding them all to one Visvalingam-Whyatt
+ * simplifier.
+ */
+class LineCollector: public GeometryComponentFilter {
+
+public:
+
+    LineCollector(VWLineSimplifier* p_vwSimp, SignificanceMap& p_significance,
+                  std::unordered_map<const Geometry*, std::size_t>& p_lineIndex)
+        : vwSimp(p_vwSimp)
+        , significance(p_significance)
+        , lineIndex(p_lineIndex)
+    {}
+
+    void
+    filter_ro(const Geometry* geom) override
+    {
+        const LineString* ls = dynamic_cast<const LineString*>(geom);
+        if(!ls) {
+            return;
+        }
+        if(vwSimp) {
+            lineIndex[ls] = vwSimp->add(*ls->getCoordinatesRO());
+        }
+        else {
+            Coordinate::Vect pts;
+            ls->getCoordinatesRO()->toVector(pts);
+            significance[ls] = DouglasPeuckerLineSimplifier::computeSignificance(pts);
+        }
+    }
+
+private:
+
+    VWLineSimplifier* vwSimp;
+    SignificanceMap& significance;
+    std::unordered_map<const Geometry*, std::size_t>& lineIndex;
+
+    // Declare type as noncopyable
+    LineCollector(const LineCollector& other) = delete;
+    LineCollector& operator=(const LineCollector& rhs) = delete;
+};
+
+/*
+ * Keeps the points of each line more significant than the tolerance,
+ * and repairs polygons as DouglasPeuckerSimplifier and VWSimplifier do.
+ */
+class LevelTransformer: public geom::util::GeometryTransformer {
+
+public:
+
+    LevelTransformer(const SignificanceMap& p_significance, double p_minSignificance,
+                     bool p_isStrict)
+        : significance(p_significance)
+        , minSignificance(p_minSignificance)
+        , isStrict(p_isStrict)
+    {
+        setSkipTransformedInvalidInteriorRings(true);
+    }
+
+protected:
+
+    CoordinateSequence::Ptr
+    transformCoordinates(const CoordinateSequence* coords,
+                         const Geometry* parent) override
+    {
+        auto it = significance.find(parent);
+        if(it == significance.end()) {
+            // for anything else (e.g. points) just copy the coordinates
+            return GeometryTransformer::transformCoordinates(coords, parent);
+        }
+        const std::vector<double>& sig = it->second;
+        std::unique_ptr<Coordinate::Vect> pts(new Coordinate::Vect());
+        for(std::size_t i = 0; i < coords->size(); i++) {
+            if(sig[i] > minSignificance || (!isStrict && sig[i] == minSignificance)) {
+                pts->push_back(coords->getAt(i));
+            }
+        }
+        return CoordinateSequence::Ptr(
+                   factory->getCoordinateSequenceFactory()->create(pts.release()));
+    }
+
+    Geometry::Ptr
+    transformPolygon(const Polygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformPolygon(geom, parent));
+
+        // don't try and correct if the parent is going to do this
+        if(dynamic_cast<const MultiPolygon*>(parent)) {
+            return roughGeom;
+        }
+        return roughGeom->buffer(0.0);
+    }
+
+    Geometry::Ptr
+    transformMultiPolygon(const MultiPolygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformMultiPolygon(geom, parent));
+        return roughGeom->buffer(0.0);
+    }
+
+private:
+
+    const SignificanceMap& significance;
+    double minSignificance;
+    bool isStrict;
+};
+
+} // end of module-statics
+
+/*public*/
+MultiResolutionSimplifier::MultiResolutionSimplifier(const Geometry* geom, Method p_method)
+    : inputGeom(geom)
+    , method(p_method)
+{
+    std::unique_ptr<VWLineSimplifier> vwSimp;
+    if(method == VISVALINGAM_WHYATT) {
+        vwSimp.reset(new VWLineSimplifier());
+        vwSimp->setDistanceTolerance(std::numeric_limits<double>::infinity());
+    }
+
+    std::unordered_map<const Geometry*, std::size_t> lineIndex;
+    LineCollector collector(vwSimp.get(), significance, lineIndex);
+    inputGeom->apply_ro(&collector);
+
+    if(vwSimp) {
+        vwSimp->simplify();
+        for(const auto& entry : lineIndex) {
+            significance[entry.first] = vwSimp->getSignificance(entry.second);
+        }
+    }
+}
+
+/*public*/
+MultiResolutionSimplifier::~MultiResolutionSimplifier() = default;
+
+/*public*/
+std::unique_ptr<Geometry>
+MultiResolutionSimplifier::getResultGeometry(double tolerance) const
+{
+    if(tolerance < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+
+    // empty input produces an empty result
+    if(inputGeom->isEmpty()) {
+        return inputGeom->clone();
+    }
+
+    // Douglas-Peucker keeps the points farther than the tolerance,
+    // Visvalingam-Whyatt those whose area is at least its square
+    LevelTransformer trans(significance,
+                           method == VISVALINGAM_WHYATT ? tolerance * tolerance : tolerance,
+                           method == DOUGLAS_PEUCKER);
+    return trans.transform(inputGeom);
+}
+
+/*public*/
+std::vector<std::unique_ptr<Geometry>>
+MultiResolutionSimplifier::getResultGeometries(const std::vector<double>& tolerances) const
+{
+    std::vector<std::unique_ptr<Geometry>> results;
+    results.reserve(tolerances.size());
+    for(double tolerance : tolerances) {
+        results.push_back(getResultGeometry(tolerance));
+    }
+    return results;
+}
+
+} // namespace geos::simplify
+} // namespace geos
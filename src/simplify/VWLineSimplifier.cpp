@@ -0,0 +1,451 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/VWLineSimplifier.h>
+#include <geos/simplify/LineSegmentIndex.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace geos::geom;
+using geos::algorithm::LineIntersector;
+using geos::algorithm::Orientation;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+constexpr std::size_t VWLineSimplifier::NONE;
+
+/*
+ * A binary min-heap of vertices ordered by effective area, which keeps
+ * the position of each vertex so its area can be changed in place.
+ * The areas are copied into the heap entries so sifting does not
+ * chase the vertex indexes. Ties are broken by vertex index, to make
+ * the order deterministic.
+ */
+class VWLineSimplifier::AreaHeap {
+
+public:
+
+    AreaHeap(const std::vector<double>& p_area)
+        : area(p_area)
+        , pos(p_area.size(), NONE)
+    {}
+
+    bool
+    empty() const
+    {
+        return heap.empty();
+    }
+
+    std::size_t
+    top() const
+    {
+        return heap.front().vertex;
+    }
+
+    bool
+    contains(std::size_t v) const
+    {
+        return pos[v] != NONE;
+    }
+
+    void
+    push(std::size_t v)
+    {
+        heap.emplace_back();
+        siftUp(heap.size() - 1, Entry{ area[v], v });
+    }
+
+    void
+    pop()
+    {
+        pos[heap.front().vertex] = NONE;
+        Entry last = heap.back();
+        heap.pop_back();
+        if(!heap.empty()) {
+            siftDown(0, last);
+        }
+    }
+
+    // restores the order after the area of v has changed
+    void
+    update(std::size_t v)
+    {
+        std::size_t k = pos[v];
+        Entry e{ area[v], v };
+        if(k > 0 && isLess(e, heap[(k - 1) / 2])) {
+            siftUp(k, e);
+        }
+        else {
+            siftDown(k, e);
+        }
+    }
+
+private:
+
+    struct Entry {
+        double area;
+        std::size_t vertex;
+    };
+
+    static bool
+    isLess(const Entry& e0, const Entry& e1)
+    {
+        return e0.area < e1.area || (e0.area == e1.area && e0.vertex < e1.vertex);
+    }
+
+    void
+    place(std::size_t k, const Entry& e)
+    {
+        heap[k] = e;
+        pos[e.vertex] = k;
+    }
+
+    void
+    siftUp(std::size_t k, const Entry& e)
+    {
+        while(k > 0) {
+            std::size_t parent = (k - 1) / 2;
+            if(!isLess(e, heap[parent])) {
+                break;
+            }
+            place(k, heap[parent]);
+            k = parent;
+        }
+        place(k, e);
+    }
+
+    void
+    siftDown(std::size_t k, const Entry& e)
+    {
+        std::size_t n = heap.size();
+        for(;;) {
+            std::size_t child = 2 * k + 1;
+            if(child >= n) {
+                break;
+            }
+            if(child + 1 < n && isLess(heap[child + 1], heap[child])) {
+                child++;
+            }
+            if(!isLess(heap[child], e)) {
+                break;
+            }
+            place(k, heap[child]);
+            k = child;
+        }
+        place(k, e);
+    }
+
+    const std::vector<double>& area;
+    std::vector<std::size_t> pos;
+    std::vector<Entry> heap;
+};
+
+/*public static*/
+std::unique_ptr<Coordinate::Vect>
+VWLineSimplifier::simplify(const Coordinate::Vect& pts, double distanceTolerance)
+{
+    VWLineSimplifier simp;
+    simp.setDistanceTolerance(distanceTolerance);
+    std::size_t line = simp.add(pts);
+    simp.simplify();
+    return simp.getCoordinates(line);
+}
+
+/*public*/
+VWLineSimplifier::VWLineSimplifier()
+    : areaTolerance(0.0)
+    , maxVertices(std::numeric_limits<std::size_t>::max())
+    , isPreserveTopology(false)
+    , numVertices(0)
+{}
+
+/*public*/
+VWLineSimplifier::~VWLineSimplifier() = default;
+
+/*public*/
+void
+VWLineSimplifier::setDistanceTolerance(double tolerance)
+{
+    if(tolerance < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+    areaTolerance = tolerance * tolerance;
+}
+
+/*public*/
+std::size_t
+VWLineSimplifier::add(const CoordinateSequence& seq)
+{
+    Coordinate::Vect linePts;
+    seq.toVector(linePts);
+    return add(linePts);
+}
+
+/*public*/
+std::size_t
+VWLineSimplifier::add(const Coordinate::Vect& linePts)
+{
+    std::size_t n = linePts.size();
+    Line line;
+    line.start = n == 0 ? NONE : pts.size();
+    line.numPoints = n;
+    line.numVertices = n;
+    line.isClosed = n >= 4 && linePts.front().equals2D(linePts.back());
+    line.minVertices = std::min(n, line.isClosed ? std::size_t(4) : std::size_t(2));
+
+    // a closed line is a cycle of its distinct vertices
+    std::size_t numDistinct = line.isClosed ? n - 1 : n;
+    std::size_t lineIndex = lines.size();
+    for(std::size_t i = 0; i < numDistinct; i++) {
+        std::size_t v = pts.size();
+        pts.push_back(linePts[i]);
+        lineOf.push_back(lineIndex);
+        if(line.isClosed) {
+            prev.push_back(i == 0 ? v + numDistinct - 1 : v - 1);
+            next.push_back(i == numDistinct - 1 ? line.start : v + 1);
+        }
+        else {
+            prev.push_back(i == 0 ? NONE : v - 1);
+            next.push_back(i == numDistinct - 1 ? NONE : v + 1);
+        }
+    }
+    lines.push_back(line);
+    numVertices += n;
+    return lineIndex;
+}
+
+/*public*/
+void
+VWLineSimplifier::addObstacle(const Coordinate& pt)
+{
+    obstacles.emplace_back(pt, pt);
+}
+
+/*private*/
+bool
+VWLineSimplifier::isFixed(std::size_t v) const
+{
+    return prev[v] == NONE || next[v] == NONE || v == lines[lineOf[v]].start;
+}
+
+/*private*/
+double
+VWLineSimplifier::computeArea(std::size_t v) const
+{
+    const Coordinate& a = pts[prev[v]];
+    const Coordinate& b = pts[v];
+    const Coordinate& c = pts[next[v]];
+    return std::fabs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2;
+}
+
+/*private*/
+bool
+VWLineSimplifier::isTopologyPreserved(std::size_t v) const
+{
+    const Coordinate& a = pts[prev[v]];
+    const Coordinate& b = pts[v];
+    const Coordinate& c = pts[next[v]];
+
+    Envelope env(a, c);
+    env.expandToInclude(b);
+    LineSegment querySeg(env.getMinX(), env.getMinY(), env.getMaxX(), env.getMaxY());
+    auto found = segmentIndex->query(&querySeg);
+
+    // the triangle swept by the removal must not contain another vertex
+    int orient = Orientation::index(a, b, c);
+    auto isInTriangle = [&](const Coordinate& q) {
+        if(q.equals2D(b)) {
+            return true;
+        }
+        if(orient == Orientation::COLLINEAR) {
+            return false;
+        }
+        return Orientation::index(a, b, q) != -orient
+               && Orientation::index(b, c, q) != -orient
+               && Orientation::index(c, a, q) != -orient;
+    };
+
+    const LineSegment* segA = &segments[prev[v]];
+    const LineSegment* segB = &segments[v];
+    LineIntersector li;
+    for(const LineSegment* seg : *found) {
+        if(seg == segA || seg == segB) {
+            continue;
+        }
+        for(const Coordinate* q : { &seg->p0, &seg->p1 }) {
+            if(!q->equals2D(a) && !q->equals2D(c) && isInTriangle(*q)) {
+                return false;
+            }
+        }
+        // the new segment may only touch at its own endpoints
+        li.computeIntersection(a, c, seg->p0, seg->p1);
+        if(!li.hasIntersection()) {
+            continue;
+        }
+        if(li.getIntersectionNum() > 1) {
+            return false;
+        }
+        const Coordinate& intPt = li.getIntersection(0);
+        if(!intPt.equals2D(a) && !intPt.equals2D(c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*private*/
+void
+VWLineSimplifier::remove(std::size_t v)
+{
+    std::size_t a = prev[v];
+    std::size_t c = next[v];
+    next[a] = c;
+    prev[c] = a;
+    lines[lineOf[v]].numVertices--;
+    numVertices--;
+
+    if(isPreserveTopology) {
+        segmentIndex->remove(&segments[a]);
+        segmentIndex->remove(&segments[v]);
+        segments[a].p1 = pts[c];
+        segmentIndex->add(&segments[a]);
+    }
+}
+
+/*private*/
+void
+VWLineSimplifier::updateArea(std::size_t v, AreaHeap& heap)
+{
+    if(isFixed(v)) {
+        return;
+    }
+    area[v] = computeArea(v);
+    if(heap.contains(v)) {
+        heap.update(v);
+    }
+    else {
+        heap.push(v);
+    }
+}
+
+/*public*/
+void
+VWLineSimplifier::simplify()
+{
+    area.assign(pts.size(), 0.0);
+    significance.assign(pts.size(), std::numeric_limits<double>::infinity());
+    double maxRemovedArea = 0.0;
+    AreaHeap heap(area);
+    for(std::size_t v = 0; v < pts.size(); v++) {
+        if(!isFixed(v)) {
+            area[v] = computeArea(v);
+            heap.push(v);
+        }
+    }
+
+    if(isPreserveTopology) {
+        segmentIndex.reset(new LineSegmentIndex());
+        segments.clear();
+        segments.reserve(pts.size());
+        for(std::size_t v = 0; v < pts.size(); v++) {
+            std::size_t w = next[v] == NONE ? v : next[v];
+            segments.emplace_back(pts[v], pts[w]);
+        }
+        for(std::size_t v = 0; v < pts.size(); v++) {
+            if(next[v] != NONE) {
+                segmentIndex->add(&segments[v]);
+            }
+        }
+        for(const LineSegment& obstacle : obstacles) {
+            segmentIndex->add(&obstacle);
+        }
+    }
+
+    while(!heap.empty()) {
+        std::size_t v = heap.top();
+        if(area[v] >= areaTolerance && numVertices <= maxVertices) {
+            break;
+        }
+        heap.pop();
+        maxRemovedArea = std::max(maxRemovedArea, area[v]);
+
+        // lines never grow back, so a vertex of a line at its minimum
+        // size is dropped for good. A vertex which would change the
+        // topology is pushed again when its triangle changes.
+        const Line& line = lines[lineOf[v]];
+        if(line.numVertices <= line.minVertices) {
+            continue;
+        }
+        if(isPreserveTopology && !isTopologyPreserved(v)) {
+            continue;
+        }
+        std::size_t a = prev[v];
+        std::size_t c = next[v];
+        remove(v);
+        significance[v] = maxRemovedArea;
+        updateArea(a, heap);
+        updateArea(c, heap);
+    }
+
+    segmentIndex.reset();
+}
+
+/*public*/
+std::unique_ptr<Coordinate::Vect>
+VWLineSimplifier::getCoordinates(std::size_t lineIndex) const
+{
+    const Line& line = lines[lineIndex];
+    std::unique_ptr<Coordinate::Vect> result(new Coordinate::Vect());
+    if(line.start == NONE) {
+        return result;
+    }
+    result->reserve(line.numVertices);
+    std::size_t v = line.start;
+    do {
+        result->push_back(pts[v]);
+        v = next[v];
+    }
+    while(v != NONE && v != line.start);
+    if(line.isClosed) {
+        result->push_back(pts[line.start]);
+    }
+    return result;
+}
+
+/*public*/
+std::vector<double>
+VWLineSimplifier::getSignificance(std::size_t lineIndex) const
+{
+    const Line& line = lines[lineIndex];
+    std::vector<double> result(line.numPoints, std::numeric_limits<double>::infinity());
+    if(line.start == NONE || significance.empty()) {
+        return result;
+    }
+    // the closing point of a closed line is its first vertex, kept
+    std::size_t numDistinct = line.isClosed ? line.numPoints - 1 : line.numPoints;
+    for(std::size_t i = 0; i < numDistinct; i++) {
+        result[i] = significance[line.start + i];
+    }
+    return result;
+}
+
+} // namespace geos::simplify
+} // namespace geos
@@ -0,0 +1,186 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/VWSimplifier.h>
+#include <geos/simplify/VWLineSimplifier.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/util/GeometryTransformer.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <memory>
+#include <unordered_map>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+namespace { // module-statics
+
+using LineIndexMap = std::unordered_map<const Geometry*, std::size_t>;
+
+/*
+ * Adds the lines of a geometry to the simplifier, and its points
+ * as obstacles.
+ */
+class VWLineCollector: public GeometryComponentFilter {
+
+public:
+
+    VWLineCollector(VWLineSimplifier& p_simp, LineIndexMap& p_lineIndex)
+        : simp(p_simp)
+        , lineIndex(p_lineIndex)
+    {}
+
+    void
+    filter_ro(const Geometry* geom) override
+    {
+        if(const LineString* ls = dynamic_cast<const LineString*>(geom)) {
+            lineIndex[ls] = simp.add(*ls->getCoordinatesRO());
+        }
+        else if(const Point* pt = dynamic_cast<const Point*>(geom)) {
+            if(!pt->isEmpty()) {
+                simp.addObstacle(*pt->getCoordinate());
+            }
+        }
+    }
+
+private:
+
+    VWLineSimplifier& simp;
+    LineIndexMap& lineIndex;
+
+    // Declare type as noncopyable
+    VWLineCollector(const VWLineCollector& other) = delete;
+    VWLineCollector& operator=(const VWLineCollector& rhs) = delete;
+};
+
+class VWTransformer: public geom::util::GeometryTransformer {
+
+public:
+
+    VWTransformer(const VWLineSimplifier& p_simp, const LineIndexMap& p_lineIndex,
+                  bool p_isEnsureValid)
+        : simp(p_simp)
+        , lineIndex(p_lineIndex)
+        , isEnsureValid(p_isEnsureValid)
+    {
+        setSkipTransformedInvalidInteriorRings(isEnsureValid);
+    }
+
+protected:
+
+    CoordinateSequence::Ptr
+    transformCoordinates(const CoordinateSequence* coords,
+                         const Geometry* parent) override
+    {
+        auto it = lineIndex.find(parent);
+        if(it == lineIndex.end()) {
+            // for anything else (e.g. points) just copy the coordinates
+            return GeometryTransformer::transformCoordinates(coords, parent);
+        }
+        return CoordinateSequence::Ptr(
+                   factory->getCoordinateSequenceFactory()->create(
+                       simp.getCoordinates(it->second).release()));
+    }
+
+    Geometry::Ptr
+    transformPolygon(const Polygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformPolygon(geom, parent));
+
+        // don't try and correct if the parent is going to do this
+        if(!isEnsureValid || dynamic_cast<const MultiPolygon*>(parent)) {
+            return roughGeom;
+        }
+        return roughGeom->buffer(0.0);
+    }
+
+    Geometry::Ptr
+    transformMultiPolygon(const MultiPolygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformMultiPolygon(geom, parent));
+        if(!isEnsureValid) {
+            return roughGeom;
+        }
+        return roughGeom->buffer(0.0);
+    }
+
+private:
+
+    const VWLineSimplifier& simp;
+    const LineIndexMap& lineIndex;
+    bool isEnsureValid;
+};
+
+} // end of module-statics
+
+/*public static*/
+std::unique_ptr<Geometry>
+VWSimplifier::simplify(const Geometry* geom, double tolerance)
+{
+    VWSimplifier simp(geom);
+    simp.setDistanceTolerance(tolerance);
+    return simp.getResultGeometry();
+}
+
+/*public*/
+VWSimplifier::VWSimplifier(const Geometry* geom)
+    : inputGeom(geom)
+    , distanceTolerance(0.0)
+    , maxVertices(std::numeric_limits<std::size_t>::max())
+    , isPreserveTopology(false)
+{
+}
+
+/*public*/
+void
+VWSimplifier::setDistanceTolerance(double tol)
+{
+    if(tol < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+    distanceTolerance = tol;
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+VWSimplifier::getResultGeometry()
+{
+    // empty input produces an empty result
+    if(inputGeom->isEmpty()) {
+        return inputGeom->clone();
+    }
+
+    VWLineSimplifier lineSimplifier;
+    lineSimplifier.setDistanceTolerance(distanceTolerance);
+    lineSimplifier.setMaxVertices(maxVertices);
+    lineSimplifier.setPreserveTopology(isPreserveTopology);
+
+    LineIndexMap lineIndex;
+    VWLineCollector collector(lineSimplifier, lineIndex);
+    inputGeom->apply_ro(&collector);
+    lineSimplifier.simplify();
+
+    VWTransformer trans(lineSimplifier, lineIndex, !isPreserveTopology);
+    return trans.transform(inputGeom);
+}
+
+} // namespace geos::simplify
+} // namespace geos
@@ -0,0 +1,680 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * The sweep-hull triangulation is ported from Delaunator
+ * (https://github.com/mapbox/delaunator), used under the ISC License:
+ *
+ * Copyright (c) 2017, Mapbox
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/CompactDelaunayTriangulator.h>
+#include <geos/algorithm/CGAlgorithmsDD.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+namespace {
+
+double
+squaredDistance(double ax, double ay, double bx, double by)
+{
+    double dx = ax - bx;
+    double dy = ay - by;
+    return dx * dx + dy * dy;
+}
+
+/*
+ * Offset of the circumcentre of abc from a, infinite or NaN
+ * for collinear points.
+ */
+void
+circumcentreOffset(double ax, double ay, double bx, double by, double cx, double cy,
+                   double& x, double& y)
+{
+    double dx = bx - ax;
+    double dy = by - ay;
+    double ex = cx - ax;
+    double ey = cy - ay;
+    double bl = dx * dx + dy * dy;
+    double cl = ex * ex + ey * ey;
+    double d = 0.5 / (dx * ey - dy * ex);
+    x = (ey * bl - dy * cl) * d;
+    y = (dx * cl - ex * bl) * d;
+}
+
+double
+circumradius2(double ax, double ay, double bx, double by, double cx, double cy)
+{
+    double x, y;
+    circumcentreOffset(ax, ay, bx, by, cx, cy, x, y);
+    return x * x + y * y;
+}
+
+/*
+ * Tests if p is inside the circumcircle of the counter-clockwise
+ * triangle abc, as TrianglePredicate::isInCircleNonRobust.
+ */
+bool
+isInCircle(double ax, double ay, double bx, double by, double cx, double cy,
+           double px, double py)
+{
+    double dx = ax - px;
+    double dy = ay - py;
+    double ex = bx - px;
+    double ey = by - py;
+    double fx = cx - px;
+    double fy = cy - py;
+
+    double ap = dx * dx + dy * dy;
+    double bp = ex * ex + ey * ey;
+    double cp = fx * fx + fy * fy;
+
+    return dx * (ey * cp - bp * fy) -
+           dy * (ex * cp - bp * fx) +
+           ap * (ex * fy - ey * fx) > 0;
+}
+
+/*
+ * Monotonic with the angle of (dx, dy), in [0, 1].
+ */
+double
+pseudoAngle(double dx, double dy)
+{
+    double p = dx / (std::fabs(dx) + std::fabs(dy));
+    return (dy < 0 ? 3 - p : 1 + p) / 4;
+}
+
+} // anonymous namespace
+
+constexpr std::uint32_t CompactDelaunayTriangulator::NONE;
+
+CompactDelaunayTriangulator::CompactDelaunayTriangulator(const CoordinateSequence& sites)
+    : isComputed(false)
+    , hullStart(NONE)
+    , centerX(0.0)
+    , centerY(0.0)
+{
+    std::size_t n = sites.size();
+    xy.resize(2 * n);
+    for(std::size_t i = 0; i < n; i++) {
+        const Coordinate& c = sites.getAt(i);
+        xy[2 * i] = c.x;
+        xy[2 * i + 1] = c.y;
+    }
+}
+
+CompactDelaunayTriangulator::CompactDelaunayTriangulator(const double* p_xy, std::size_t numSites)
+    : xy(p_xy, p_xy + 2 * numSites)
+    , isComputed(false)
+    , hullStart(NONE)
+    , centerX(0.0)
+    , centerY(0.0)
+{}
+
+void
+CompactDelaunayTriangulator::create()
+{
+    if(isComputed) {
+        return;
+    }
+    triangulate();
+    isComputed = true;
+}
+
+std::size_t
+CompactDelaunayTriangulator::getNumTriangles()
+{
+    create();
+    return triangles.size() / 3;
+}
+
+std::size_t
+CompactDelaunayTriangulator::getNumEdges()
+{
+    create();
+    if(triangles.empty()) {
+        return 0;
+    }
+    // every interior edge is counted by two half-edges
+    return (triangles.size() + hull.size()) / 2;
+}
+
+const std::vector<std::uint32_t>&
+CompactDelaunayTriangulator::getTriangleVertices()
+{
+    create();
+    return triangles;
+}
+
+const std::vector<std::uint32_t>&
+CompactDelaunayTriangulator::getHalfEdges()
+{
+    create();
+    return halfedges;
+}
+
+const std::vector<std::uint32_t>&
+CompactDelaunayTriangulator::getHull()
+{
+    create();
+    return hull;
+}
+
+void
+CompactDelaunayTriangulator::getTriangleCoordinates(double* buf)
+{
+    create();
+    for(std::uint32_t v : triangles) {
+        *buf++ = xy[2 * v];
+        *buf++ = xy[2 * v + 1];
+    }
+}
+
+void
+CompactDelaunayTriangulator::getEdgeCoordinates(double* buf)
+{
+    create();
+    for(std::size_t e = 0; e < triangles.size(); e++) {
+        std::uint32_t opp = halfedges[e];
+        if(opp != NONE && opp < e) {
+            continue;
+        }
+        std::uint32_t v0 = triangles[e];
+        std::uint32_t v1 = triangles[nextHalfEdge(e)];
+        *buf++ = xy[2 * v0];
+        *buf++ = xy[2 * v0 + 1];
+        *buf++ = xy[2 * v1];
+        *buf++ = xy[2 * v1 + 1];
+    }
+}
+
+std::unique_ptr<GeometryCollection>
+CompactDelaunayTriangulator::getTriangles(const GeometryFactory& geomFact)
+{
+    std::size_t numTri = getNumTriangles();
+    std::vector<double> buf(6 * numTri);
+    getTriangleCoordinates(buf.data());
+
+    std::vector<std::unique_ptr<Geometry>> tris;
+    tris.reserve(numTri);
+    for(std::size_t t = 0; t < numTri; t++) {
+        const double* p = &buf[6 * t];
+        std::vector<Coordinate> pts {
+            Coordinate(p[0], p[1]),
+            Coordinate(p[2], p[3]),
+            Coordinate(p[4], p[5]),
+            Coordinate(p[0], p[1])
+        };
+        auto ring = geomFact.createLinearRing(
+                        geomFact.getCoordinateSequenceFactory()->create(std::move(pts)));
+        tris.push_back(geomFact.createPolygon(std::move(ring)));
+    }
+    return geomFact.createGeometryCollection(std::move(tris));
+}
+
+std::unique_ptr<MultiLineString>
+CompactDelaunayTriangulator::getEdges(const GeometryFactory& geomFact)
+{
+    std::size_t numEdges = getNumEdges();
+    std::vector<double> buf(4 * numEdges);
+    getEdgeCoordinates(buf.data());
+
+    std::vector<std::unique_ptr<LineString>> edges;
+    edges.reserve(numEdges);
+    for(std::size_t i = 0; i < numEdges; i++) {
+        const double* p = &buf[4 * i];
+        std::vector<Coordinate> pts {
+            Coordinate(p[0], p[1]),
+            Coordinate(p[2], p[3])
+        };
+        edges.push_back(geomFact.createLineString(
+                            geomFact.getCoordinateSequenceFactory()->create(std::move(pts))));
+    }
+    return geomFact.createMultiLineString(std::move(edges));
+}
+
+bool
+CompactDelaunayTriangulator::isRightOf(std::uint32_t p, std::uint32_t a, std::uint32_t b) const
+{
+    return algorithm::CGAlgorithmsDD::orientationIndex(
+               xy[2 * a], xy[2 * a + 1],
+               xy[2 * b], xy[2 * b + 1],
+               xy[2 * p], xy[2 * p + 1]) == algorithm::Orientation::CLOCKWISE;
+}
+
+std::size_t
+CompactDelaunayTriangulator::hashKey(double x, double y) const
+{
+    double a = pseudoAngle(x - centerX, y - centerY);
+    // a site at the centre has no angle
+    if(!(a >= 0)) {
+        a = 0;
+    }
+    std::size_t size = hullHash.size();
+    return static_cast<std::size_t>(std::floor(a * static_cast<double>(size))) % size;
+}
+
+void
+CompactDelaunayTriangulator::link(std::uint32_t a, std::uint32_t b)
+{
+    halfedges[a] = b;
+    if(b != NONE) {
+        halfedges[b] = a;
+    }
+}
+
+std::uint32_t
+CompactDelaunayTriangulator::addTriangle(std::uint32_t i0, std::uint32_t i1, std::uint32_t i2,
+        std::uint32_t a, std::uint32_t b, std::uint32_t c)
+{
+    std::uint32_t t = static_cast<std::uint32_t>(triangles.size());
+    triangles.push_back(i0);
+    triangles.push_back(i1);
+    triangles.push_back(i2);
+    halfedges.push_back(NONE);
+    halfedges.push_back(NONE);
+    halfedges.push_back(NONE);
+    link(t, a);
+    link(t + 1, b);
+    link(t + 2, c);
+    return t;
+}
+
+/*
+ * Flips the edge a and the edges it uncovers until they are all
+ * locally Delaunay. Returns the half-edge leaving the new site
+ * towards the hull.
+ *
+ *           pl                    pl
+ *          /||\                  /  \
+ *       al/ || \bl            al/    \a
+ *        /  ||  \              /      \
+ *       /  a||b  \    flip    /___ar___\
+ *     p0\   ||   /p1   =>   p0\---bl---/p1
+ *        \  ||  /              \      /
+ *       ar\ || /br             b\    /br
+ *          \||/                  \  /
+ *           pr                    pr
+ */
+std::uint32_t
+CompactDelaunayTriangulator::legalize(std::uint32_t a)
+{
+    std::uint32_t ar = 0;
+    edgeStack.clear();
+
+    while(true) {
+        std::uint32_t b = halfedges[a];
+        std::uint32_t a0 = a - a % 3;
+        ar = a0 + (a + 2) % 3;
+
+        if(b == NONE) {
+            if(edgeStack.empty()) {
+                break;
+            }
+            a = edgeStack.back();
+            edgeStack.pop_back();
+            continue;
+        }
+
+        std::uint32_t b0 = b - b % 3;
+        std::uint32_t al = a0 + (a + 1) % 3;
+        std::uint32_t bl = b0 + (b + 2) % 3;
+
+        std::uint32_t p0 = triangles[ar];
+        std::uint32_t pr = triangles[a];
+        std::uint32_t pl = triangles[al];
+        std::uint32_t p1 = triangles[bl];
+
+        bool isIllegal = isInCircle(
+                             xy[2 * p0], xy[2 * p0 + 1],
+                             xy[2 * pr], xy[2 * pr + 1],
+                             xy[2 * pl], xy[2 * pl + 1],
+                             xy[2 * p1], xy[2 * p1 + 1]);
+
+        if(isIllegal) {
+            triangles[a] = p1;
+            triangles[b] = p0;
+
+            std::uint32_t hbl = halfedges[bl];
+
+            // the flipped edge was on the hull, update its reference
+            if(hbl == NONE) {
+                std::uint32_t e = hullStart;
+                do {
+                    if(hullTri[e] == bl) {
+                        hullTri[e] = a;
+                        break;
+                    }
+                    e = hullPrev[e];
+                }
+                while(e != hullStart);
+            }
+            link(a, hbl);
+            link(b, halfedges[ar]);
+            link(ar, bl);
+
+            std::uint32_t br = b0 + (b + 1) % 3;
+            edgeStack.push_back(br);
+        }
+        else {
+            if(edgeStack.empty()) {
+                break;
+            }
+            a = edgeStack.back();
+            edgeStack.pop_back();
+        }
+    }
+    return ar;
+}
+
+void
+CompactDelaunayTriangulator::triangulate()
+{
+    std::size_t n = getNumSites();
+    if(n > (std::numeric_limits<std::uint32_t>::max() - 1) / 6) {
+        throw util::IllegalArgumentException("CompactDelaunayTriangulator: too many sites");
+    }
+    if(n == 0) {
+        return;
+    }
+
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = minX;
+    double maxX = -minX;
+    double maxY = -minX;
+    for(std::size_t i = 0; i < n; i++) {
+        minX = std::min(minX, xy[2 * i]);
+        minY = std::min(minY, xy[2 * i + 1]);
+        maxX = std::max(maxX, xy[2 * i]);
+        maxY = std::max(maxY, xy[2 * i + 1]);
+    }
+    double cx = (minX + maxX) / 2;
+    double cy = (minY + maxY) / 2;
+
+    // seed site closest to the centre of the extent
+    std::uint32_t i0 = 0;
+    double minDist = std::numeric_limits<double>::infinity();
+    for(std::uint32_t i = 0; i < n; i++) {
+        double d = squaredDistance(cx, cy, xy[2 * i], xy[2 * i + 1]);
+        if(d < minDist) {
+            i0 = i;
+            minDist = d;
+        }
+    }
+    double i0x = xy[2 * i0];
+    double i0y = xy[2 * i0 + 1];
+
+    // site closest to the seed
+    std::uint32_t i1 = NONE;
+    minDist = std::numeric_limits<double>::infinity();
+    for(std::uint32_t i = 0; i < n; i++) {
+        if(i == i0) {
+            continue;
+        }
+        double d = squaredDistance(i0x, i0y, xy[2 * i], xy[2 * i + 1]);
+        if(d < minDist && d > 0) {
+            i1 = i;
+            minDist = d;
+        }
+    }
+
+    // site forming the smallest circumcircle with the first two
+    std::uint32_t i2 = NONE;
+    double minRadius = std::numeric_limits<double>::infinity();
+    if(i1 != NONE) {
+        double i1x = xy[2 * i1];
+        double i1y = xy[2 * i1 + 1];
+        for(std::uint32_t i = 0; i < n; i++) {
+            if(i == i0 || i == i1) {
+                continue;
+            }
+            double r = circumradius2(i0x, i0y, i1x, i1y, xy[2 * i], xy[2 * i + 1]);
+            if(r < minRadius) {
+                i2 = i;
+                minRadius = r;
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> ids(n);
+    for(std::uint32_t i = 0; i < n; i++) {
+        ids[i] = i;
+    }
+    std::vector<double> dists(n);
+
+    // all sites are collinear: no triangles, the hull is the
+    // sites ordered along their line
+    if(i2 == NONE) {
+        for(std::size_t i = 0; i < n; i++) {
+            double d = xy[2 * i] - xy[0];
+            dists[i] = (d != 0) ? d : xy[2 * i + 1] - xy[1];
+        }
+        std::stable_sort(ids.begin(), ids.end(), [&dists](std::uint32_t a, std::uint32_t b) {
+            return dists[a] < dists[b];
+        });
+        double d0 = -std::numeric_limits<double>::infinity();
+        for(std::uint32_t id : ids) {
+            if(dists[id] > d0) {
+                hull.push_back(id);
+                d0 = dists[id];
+            }
+        }
+        return;
+    }
+
+    // make the seed triangle counter-clockwise
+    if(isRightOf(i2, i0, i1)) {
+        std::swap(i1, i2);
+    }
+    double i1x = xy[2 * i1];
+    double i1y = xy[2 * i1 + 1];
+    double i2x = xy[2 * i2];
+    double i2y = xy[2 * i2 + 1];
+
+    double ox, oy;
+    circumcentreOffset(i0x, i0y, i1x, i1y, i2x, i2y, ox, oy);
+    centerX = i0x + ox;
+    centerY = i0y + oy;
+
+    // sweep the sites by distance from the seed circumcentre
+    for(std::size_t i = 0; i < n; i++) {
+        dists[i] = squaredDistance(xy[2 * i], xy[2 * i + 1], centerX, centerY);
+    }
+    std::sort(ids.begin(), ids.end(), [&dists](std::uint32_t a, std::uint32_t b) {
+        return dists[a] < dists[b] || (dists[a] == dists[b] && a < b);
+    });
+    std::vector<double>().swap(dists);
+
+    // work on a copy of the sites in sweep order, so that sites
+    // inserted together are close in memory
+    std::vector<double> sweepXY(2 * n);
+    std::uint32_t k0 = 0, k1 = 0, k2 = 0;
+    for(std::uint32_t k = 0; k < n; k++) {
+        sweepXY[2 * k] = xy[2 * ids[k]];
+        sweepXY[2 * k + 1] = xy[2 * ids[k] + 1];
+        if(ids[k] == i0) {
+            k0 = k;
+        }
+        else if(ids[k] == i1) {
+            k1 = k;
+        }
+        else if(ids[k] == i2) {
+            k2 = k;
+        }
+    }
+    xy.swap(sweepXY);
+    i0 = k0;
+    i1 = k1;
+    i2 = k2;
+
+    hullPrev.assign(n, NONE);
+    hullNext.assign(n, NONE);
+    hullTri.assign(n, NONE);
+    hullHash.assign(static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n)))), NONE);
+
+    std::size_t maxTriangles = n < 3 ? 1 : 2 * n - 5;
+    triangles.reserve(3 * maxTriangles);
+    halfedges.reserve(3 * maxTriangles);
+
+    // the seed triangle is the starting hull
+    hullStart = i0;
+    std::size_t hullSize = 3;
+
+    hullNext[i0] = hullPrev[i2] = i1;
+    hullNext[i1] = hullPrev[i0] = i2;
+    hullNext[i2] = hullPrev[i1] = i0;
+
+    hullTri[i0] = 0;
+    hullTri[i1] = 1;
+    hullTri[i2] = 2;
+
+    hullHash[hashKey(i0x, i0y)] = i0;
+    hullHash[hashKey(i1x, i1y)] = i1;
+    hullHash[hashKey(i2x, i2y)] = i2;
+
+    addTriangle(i0, i1, i2, NONE, NONE, NONE);
+
+    double xp = 0;
+    double yp = 0;
+    for(std::uint32_t i = 0; i < n; i++) {
+        double x = xy[2 * i];
+        double y = xy[2 * i + 1];
+
+        // skip duplicates, which are adjacent in the sweep order
+        if(i > 0 && x == xp && y == yp) {
+            continue;
+        }
+        xp = x;
+        yp = y;
+
+        if(i == i0 || i == i1 || i == i2) {
+            continue;
+        }
+
+        // find a hull vertex near the site direction using the hash
+        std::uint32_t start = 0;
+        std::size_t key = hashKey(x, y);
+        for(std::size_t j = 0; j < hullHash.size(); j++) {
+            start = hullHash[(key + j) % hullHash.size()];
+            if(start != NONE && start != hullNext[start]) {
+                break;
+            }
+        }
+
+        // find an edge of the hull visible from the site
+        start = hullPrev[start];
+        std::uint32_t e = start;
+        std::uint32_t q;
+        while(q = hullNext[e], !isRightOf(i, e, q)) {
+            e = q;
+            if(e == start) {
+                e = NONE;
+                break;
+            }
+        }
+        // no visible edge: a site coincident with the hull, skip it
+        if(e == NONE) {
+            continue;
+        }
+
+        // add the first triangle from the site and flip it as needed
+        std::uint32_t t = addTriangle(e, i, hullNext[e], NONE, NONE, hullTri[e]);
+        hullTri[i] = legalize(t + 2);
+        hullTri[e] = t;
+        hullSize++;
+
+        // walk forward through the hull, adding triangles
+        std::uint32_t nx = hullNext[e];
+        while(q = hullNext[nx], isRightOf(i, nx, q)) {
+            t = addTriangle(nx, i, q, hullTri[i], NONE, hullTri[nx]);
+            hullTri[i] = legalize(t + 2);
+            // mark as removed
+            hullNext[nx] = nx;
+            hullSize--;
+            nx = q;
+        }
+
+        // walk backward from the other side, adding triangles
+        if(e == start) {
+            while(q = hullPrev[e], isRightOf(i, q, e)) {
+                t = addTriangle(q, i, e, NONE, hullTri[e], hullTri[q]);
+                legalize(t + 2);
+                hullTri[q] = t;
+                hullNext[e] = e;
+                hullSize--;
+                e = q;
+            }
+        }
+
+        hullStart = hullPrev[i] = e;
+        hullNext[e] = hullPrev[nx] = i;
+        hullNext[i] = nx;
+
+        hullHash[hashKey(x, y)] = i;
+        hullHash[hashKey(xy[2 * e], xy[2 * e + 1])] = e;
+    }
+
+    hull.reserve(hullSize);
+    std::uint32_t e = hullStart;
+    for(std::size_t i = 0; i < hullSize; i++) {
+        hull.push_back(e);
+        e = hullNext[e];
+    }
+
+    // back to the input site indexes
+    xy.swap(sweepXY);
+    for(std::uint32_t& v : triangles) {
+        v = ids[v];
+    }
+    for(std::uint32_t& v : hull) {
+        v = ids[v];
+    }
+
+    std::vector<std::uint32_t>().swap(hullPrev);
+    std::vector<std::uint32_t>().swap(hullNext);
+    std::vector<std::uint32_t>().swap(hullTri);
+    std::vector<std::uint32_t>().swap(hullHash);
+    std::vector<std::uint32_t>().swap(edgeStack);
+}
+
+} //namespace geos.triangulate
+} //namespace geos
@@ -19,6 +19,7 @@
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 
 #include <algorithm>
+#include <cstdint>
 
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Coordinate.h>
@@ -26,9 +27,11 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/QuadEdgeLocator.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/operation/valid/RepeatedPointTester.h>
+#include <geos/shape/fractal/HilbertCode.h>
 #include <geos/util.h>
 
 namespace geos {
@@ -75,8 +78,88 @@ DelaunayTriangulationBuilder::toVertices(
     return vertexList;
 }
 
+namespace {
+
+/*
+ * Locates vertices walking from the first edge of the frame.
+ * Sites sorted lexicographically are always next to the frame,
+ * so this is shorter than walking from the last located edge.
+ */
+class FrameEdgeLocator : public quadedge::QuadEdgeLocator {
+public:
+    explicit FrameEdgeLocator(quadedge::QuadEdgeSubdivision* p_subdiv)
+        : subdiv(p_subdiv)
+    {}
+
+    quadedge::QuadEdge*
+    locate(const quadedge::Vertex& v) override
+    {
+        return subdiv->locateFromEdge(v, subdiv->getEdges()[0].base());
+    }
+
+private:
+    quadedge::QuadEdgeSubdivision* subdiv;
+};
+
+} // anonymous namespace
+
+void
+DelaunayTriangulationBuilder::sortForInsertion(IncrementalDelaunayTriangulator::VertexList& vertices)
+{
+    using geos::shape::fractal::HilbertCode;
+
+    Envelope env;
+    for(const quadedge::Vertex& v : vertices) {
+        env.expandToInclude(v.getCoordinate());
+    }
+    if(env.isNull()) {
+        return;
+    }
+
+    const uint32_t level = HilbertCode::MAX_LEVEL;
+    const double maxOrd = static_cast<double>(HilbertCode::maxOrdinate(level));
+    const double scaleX = env.getWidth() > 0 ? maxOrd / env.getWidth() : 0;
+    const double scaleY = env.getHeight() > 0 ? maxOrd / env.getHeight() : 0;
+
+    std::vector<std::pair<uint32_t, std::size_t>> keys;
+    keys.reserve(vertices.size());
+    for(std::size_t i = 0; i < vertices.size(); i++) {
+        auto x = static_cast<uint32_t>((vertices[i].getX() - env.getMinX()) * scaleX);
+        auto y = static_cast<uint32_t>((vertices[i].getY() - env.getMinY()) * scaleY);
+        keys.emplace_back(HilbertCode::encode(level, x, y), i);
+    }
+    // Ties are broken by input index, so the order is deterministic
+    std::sort(keys.begin(), keys.end());
+
+    IncrementalDelaunayTriangulator::VertexList sorted;
+    sorted.reserve(vertices.size());
+    for(const auto& k : keys) {
+        sorted.push_back(vertices[k.second]);
+    }
+    vertices.swap(sorted);
+}
+
+void
+DelaunayTriangulationBuilder::insertSites(quadedge::QuadEdgeSubdivision& subdiv,
+                                          const CoordinateSequence& coords,
+                                          bool isHilbertOrder)
+{
+    auto vertices = toVertices(coords);
+    // Best performance from locator when inserting points near each other
+    if(isHilbertOrder) {
+        sortForInsertion(vertices);
+    }
+    else {
+        std::sort(vertices.begin(), vertices.end());
+        subdiv.setLocator(std::unique_ptr<quadedge::QuadEdgeLocator>(new FrameEdgeLocator(&subdiv)));
+    }
+
+    IncrementalDelaunayTriangulator triangulator(&subdiv);
+    triangulator.insertSites(vertices);
+}
+
 DelaunayTriangulationBuilder::DelaunayTriangulationBuilder() :
-    siteCoords(nullptr), tolerance(0.0), subdiv(nullptr)
+    siteCoords(nullptr), tolerance(0.0), isHilbertOrder(false), subdiv(nullptr)
 {
 }
 
@@ -103,12 +186,8 @@ DelaunayTriangulationBuilder::create()
 
     Envelope siteEnv;
     siteCoords ->expandEnvelope(siteEnv);
-    auto vertices = toVertices(*siteCoords);
-    std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
-
     subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, tolerance));
-    IncrementalDelaunayTriangulator triangulator = IncrementalDelaunayTriangulator(subdiv.get());
-    triangulator.insertSites(vertices);
+    insertSites(*subdiv, *siteCoords, isHilbertOrder);
 }
 
 quadedge::QuadEdgeSubdivision&
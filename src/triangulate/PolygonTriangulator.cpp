@@ -0,0 +1,1031 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * The ear clipping triangulation is ported from earcut
+ * (https://github.com/mapbox/earcut), used under the ISC License:
+ *
+ * Copyright (c) 2016, Mapbox
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/PolygonTriangulator.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+namespace {
+
+const std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+/*
+ * Vertex of a ring being clipped. Rings are circular doubly linked
+ * lists, with a second list in Z-order used to find the vertices in
+ * the envelope of a candidate ear.
+ */
+struct Node {
+    std::uint32_t i;
+    double x;
+    double y;
+    Node* prev;
+    Node* next;
+    std::uint32_t z;
+    Node* prevZ;
+    Node* nextZ;
+    bool isSteiner;
+
+    Node(std::uint32_t p_i, double p_x, double p_y)
+        : i(p_i), x(p_x), y(p_y)
+        , prev(nullptr), next(nullptr)
+        , z(0), prevZ(nullptr), nextZ(nullptr)
+        , isSteiner(false)
+    {}
+};
+
+/*
+ * Twice the signed area of pqr, negative when counter-clockwise.
+ */
+double
+area(const Node* p, const Node* q, const Node* r)
+{
+    return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);
+}
+
+bool
+equals(const Node* p, const Node* q)
+{
+    return p->x == q->x && p->y == q->y;
+}
+
+bool
+pointInTriangle(double ax, double ay, double bx, double by, double cx, double cy,
+                double px, double py)
+{
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+           (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+           (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+int
+sign(double v)
+{
+    return (v > 0) - (v < 0);
+}
+
+// for collinear p, q, r, tests if q lies on segment pr
+bool
+onSegment(const Node* p, const Node* q, const Node* r)
+{
+    return q->x <= std::max(p->x, r->x) && q->x >= std::min(p->x, r->x) &&
+           q->y <= std::max(p->y, r->y) && q->y >= std::min(p->y, r->y);
+}
+
+bool
+intersects(const Node* p1, const Node* q1, const Node* p2, const Node* q2)
+{
+    int o1 = sign(area(p1, q1, p2));
+    int o2 = sign(area(p1, q1, q2));
+    int o3 = sign(area(p2, q2, p1));
+    int o4 = sign(area(p2, q2, q1));
+
+    if(o1 != o2 && o3 != o4) {
+        return true;
+    }
+    if(o1 == 0 && onSegment(p1, p2, q1)) {
+        return true;
+    }
+    if(o2 == 0 && onSegment(p1, q2, q1)) {
+        return true;
+    }
+    if(o3 == 0 && onSegment(p2, p1, q2)) {
+        return true;
+    }
+    if(o4 == 0 && onSegment(p2, q1, q2)) {
+        return true;
+    }
+    return false;
+}
+
+// tests if the diagonal ab intersects a ring edge not incident to a or b
+bool
+intersectsPolygon(const Node* a, const Node* b)
+{
+    const Node* p = a;
+    do {
+        if(p->i != a->i && p->next->i != a->i && p->i != b->i && p->next->i != b->i &&
+                intersects(p, p->next, a, b)) {
+            return true;
+        }
+        p = p->next;
+    }
+    while(p != a);
+    return false;
+}
+
+// tests if the diagonal ab is inside the ring around a
+bool
+locallyInside(const Node* a, const Node* b)
+{
+    return area(a->prev, a, a->next) < 0 ?
+           area(a, b, a->next) >= 0 && area(a, a->prev, b) >= 0 :
+           area(a, b, a->prev) < 0 || area(a, a->next, b) < 0;
+}
+
+// tests if the middle of the diagonal ab is inside the ring
+bool
+middleInside(const Node* a, const Node* b)
+{
+    const Node* p = a;
+    bool inside = false;
+    double px = (a->x + b->x) / 2;
+    double py = (a->y + b->y) / 2;
+    do {
+        if(((p->y > py) != (p->next->y > py)) && p->next->y != p->y &&
+                (px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x)) {
+            inside = !inside;
+        }
+        p = p->next;
+    }
+    while(p != a);
+    return inside;
+}
+
+bool
+isValidDiagonal(const Node* a, const Node* b)
+{
+    return a->next->i != b->i && a->prev->i != b->i && !intersectsPolygon(a, b) &&
+           // locally visible and not creating opposite-facing sectors
+           ((locallyInside(a, b) && locallyInside(b, a) && middleInside(a, b) &&
+             (area(a->prev, a, b->prev) != 0 || area(a, b->prev, b) != 0)) ||
+            // zero-length diagonal between touching rings
+            (equals(a, b) && area(a->prev, a, a->next) > 0 && area(b->prev, b, b->next) > 0));
+}
+
+bool
+sectorContainsSector(const Node* m, const Node* p)
+{
+    return area(m->prev, m, p->prev) < 0 && area(p->next, m, m->next) < 0;
+}
+
+void
+removeNode(Node* p)
+{
+    p->next->prev = p->prev;
+    p->prev->next = p->next;
+    if(p->prevZ) {
+        p->prevZ->nextZ = p->nextZ;
+    }
+    if(p->nextZ) {
+        p->nextZ->prevZ = p->prevZ;
+    }
+}
+
+Node*
+getLeftmost(Node* start)
+{
+    Node* p = start;
+    Node* leftmost = start;
+    do {
+        if(p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y)) {
+            leftmost = p;
+        }
+        p = p->next;
+    }
+    while(p != start);
+    return leftmost;
+}
+
+/*
+ * Ear clipping of one polygon, joined with its holes.
+ */
+class EarClipper {
+
+public:
+
+    EarClipper(const std::vector<double>& p_xy, std::vector<std::uint32_t>& p_triangles)
+        : xy(p_xy)
+        , triangles(p_triangles)
+        , minX(0)
+        , minY(0)
+        , invSize(0)
+    {}
+
+    void
+    triangulate(const std::uint32_t* ringStart, std::size_t numRings)
+    {
+        // rings without their closing coordinate
+        Node* outer = linkRing(ringStart[0], ringStart[1] - 1, true);
+        if(!outer || outer->next == outer->prev) {
+            return;
+        }
+
+        std::size_t numVertices = ringStart[1] - ringStart[0];
+        if(numRings > 1) {
+            outer = eliminateHoles(ringStart, numRings, outer);
+            numVertices = ringStart[numRings] - ringStart[0];
+        }
+
+        // index large rings by Z-order, over the shell extent
+        if(numVertices > 80) {
+            minX = std::numeric_limits<double>::infinity();
+            minY = minX;
+            double maxX = -minX;
+            double maxY = -minX;
+            for(std::uint32_t j = ringStart[0]; j < ringStart[1]; j++) {
+                minX = std::min(minX, xy[2 * j]);
+                minY = std::min(minY, xy[2 * j + 1]);
+                maxX = std::max(maxX, xy[2 * j]);
+                maxY = std::max(maxY, xy[2 * j + 1]);
+            }
+            invSize = std::max(maxX - minX, maxY - minY);
+            invSize = invSize != 0 ? 32767 / invSize : 0;
+        }
+
+        clipEars(outer, 0);
+    }
+
+private:
+
+    const std::vector<double>& xy;
+    std::vector<std::uint32_t>& triangles;
+    // deque keeps the nodes at stable addresses
+    std::deque<Node> nodes;
+    double minX;
+    double minY;
+    double invSize;
+
+    Node*
+    insertNode(std::uint32_t i, Node* last)
+    {
+        nodes.emplace_back(i, xy[2 * i], xy[2 * i + 1]);
+        Node* p = &nodes.back();
+        if(!last) {
+            p->prev = p;
+            p->next = p;
+        }
+        else {
+            p->next = last->next;
+            p->prev = last;
+            last->next->prev = p;
+            last->next = p;
+        }
+        return p;
+    }
+
+    /*
+     * Links the vertices [start, end) in counter-clockwise order
+     * for a shell, clockwise order for a hole.
+     */
+    Node*
+    linkRing(std::uint32_t start, std::uint32_t end, bool isShell)
+    {
+        if(end <= start) {
+            return nullptr;
+        }
+        double sum = 0;
+        for(std::uint32_t i = start, j = end - 1; i < end; j = i++) {
+            sum += (xy[2 * j] - xy[2 * i]) * (xy[2 * i + 1] + xy[2 * j + 1]);
+        }
+
+        Node* last = nullptr;
+        if(isShell == (sum > 0)) {
+            for(std::uint32_t i = start; i < end; i++) {
+                last = insertNode(i, last);
+            }
+        }
+        else {
+            for(std::uint32_t i = end; i-- > start;) {
+                last = insertNode(i, last);
+            }
+        }
+
+        if(last && equals(last, last->next)) {
+            removeNode(last);
+            last = last->next;
+        }
+        return last;
+    }
+
+    /*
+     * Removes repeated and collinear vertices between start and end.
+     */
+    Node*
+    filterPoints(Node* start, Node* end = nullptr)
+    {
+        if(!start) {
+            return start;
+        }
+        if(!end) {
+            end = start;
+        }
+
+        Node* p = start;
+        bool again;
+        do {
+            again = false;
+            if(!p->isSteiner && (equals(p, p->next) || area(p->prev, p, p->next) == 0)) {
+                removeNode(p);
+                p = end = p->prev;
+                if(p == p->next) {
+                    break;
+                }
+                again = true;
+            }
+            else {
+                p = p->next;
+            }
+        }
+        while(again || p != end);
+        return end;
+    }
+
+    void
+    addTriangle(const Node* a, const Node* b, const Node* c)
+    {
+        triangles.push_back(a->i);
+        triangles.push_back(b->i);
+        triangles.push_back(c->i);
+    }
+
+    void
+    clipEars(Node* ear, int pass)
+    {
+        if(!ear) {
+            return;
+        }
+        if(pass == 0 && invSize != 0) {
+            indexCurve(ear);
+        }
+
+        Node* stop = ear;
+        while(ear->prev != ear->next) {
+            Node* prev = ear->prev;
+            Node* next = ear->next;
+
+            if(invSize != 0 ? isEarHashed(ear) : isEar(ear)) {
+                addTriangle(prev, ear, next);
+                removeNode(ear);
+                // skipping the next vertex leads to fewer slivers
+                ear = next->next;
+                stop = next->next;
+                continue;
+            }
+
+            ear = next;
+
+            // no ear found in a full loop
+            if(ear == stop) {
+                if(pass == 0) {
+                    clipEars(filterPoints(ear), 1);
+                }
+                else if(pass == 1) {
+                    ear = cureLocalIntersections(filterPoints(ear));
+                    clipEars(ear, 2);
+                }
+                else {
+                    splitClip(ear);
+                }
+                break;
+            }
+        }
+    }
+
+    bool
+    isEar(const Node* ear) const
+    {
+        const Node* a = ear->prev;
+        const Node* b = ear;
+        const Node* c = ear->next;
+
+        // reflex vertex
+        if(area(a, b, c) >= 0) {
+            return false;
+        }
+
+        double x0 = std::min({a->x, b->x, c->x});
+        double y0 = std::min({a->y, b->y, c->y});
+        double x1 = std::max({a->x, b->x, c->x});
+        double y1 = std::max({a->y, b->y, c->y});
+
+        // no reflex vertex of the ring inside the ear
+        const Node* p = c->next;
+        while(p != a) {
+            if(p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 &&
+                    pointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+                    area(p->prev, p, p->next) >= 0) {
+                return false;
+            }
+            p = p->next;
+        }
+        return true;
+    }
+
+    bool
+    isInEar(const Node* a, const Node* b, const Node* c, const Node* p,
+            double x0, double y0, double x1, double y1) const
+    {
+        return p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 &&
+               p != a && p != c &&
+               pointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+               area(p->prev, p, p->next) >= 0;
+    }
+
+    bool
+    isEarHashed(const Node* ear) const
+    {
+        const Node* a = ear->prev;
+        const Node* b = ear;
+        const Node* c = ear->next;
+
+        if(area(a, b, c) >= 0) {
+            return false;
+        }
+
+        double x0 = std::min({a->x, b->x, c->x});
+        double y0 = std::min({a->y, b->y, c->y});
+        double x1 = std::max({a->x, b->x, c->x});
+        double y1 = std::max({a->y, b->y, c->y});
+
+        std::uint32_t minZ = zOrder(x0, y0);
+        std::uint32_t maxZ = zOrder(x1, y1);
+
+        // look for vertices in the ear in both directions of the Z-order
+        const Node* p = ear->prevZ;
+        const Node* n = ear->nextZ;
+        while(p && p->z >= minZ && n && n->z <= maxZ) {
+            if(isInEar(a, b, c, p, x0, y0, x1, y1)) {
+                return false;
+            }
+            p = p->prevZ;
+            if(isInEar(a, b, c, n, x0, y0, x1, y1)) {
+                return false;
+            }
+            n = n->nextZ;
+        }
+        while(p && p->z >= minZ) {
+            if(isInEar(a, b, c, p, x0, y0, x1, y1)) {
+                return false;
+            }
+            p = p->prevZ;
+        }
+        while(n && n->z <= maxZ) {
+            if(isInEar(a, b, c, n, x0, y0, x1, y1)) {
+                return false;
+            }
+            n = n->nextZ;
+        }
+        return true;
+    }
+
+    /*
+     * Clips the two-edge self-intersections a - p - p.next - b
+     * left over by the first passes.
+     */
+    Node*
+    cureLocalIntersections(Node* start)
+    {
+        Node* p = start;
+        do {
+            Node* a = p->prev;
+            Node* b = p->next->next;
+
+            if(!equals(a, b) && intersects(a, p, p->next, b) &&
+                    locallyInside(a, b) && locallyInside(b, a)) {
+                addTriangle(a, p, b);
+                removeNode(p);
+                removeNode(p->next);
+                p = start = b;
+            }
+            p = p->next;
+        }
+        while(p != start);
+        return filterPoints(p);
+    }
+
+    /*
+     * Last resort: splits the ring along a valid diagonal and clips
+     * the two parts separately.
+     */
+    void
+    splitClip(Node* start)
+    {
+        Node* a = start;
+        do {
+            Node* b = a->next->next;
+            while(b != a->prev) {
+                if(a->i != b->i && isValidDiagonal(a, b)) {
+                    Node* c = splitPolygon(a, b);
+                    a = filterPoints(a, a->next);
+                    c = filterPoints(c, c->next);
+                    clipEars(a, 0);
+                    clipEars(c, 0);
+                    return;
+                }
+                b = b->next;
+            }
+            a = a->next;
+        }
+        while(a != start);
+    }
+
+    /*
+     * Links a and b with a bridge, splitting the ring in two if they
+     * are on the same ring, or joining two rings otherwise.
+     * Returns the copy of b on the other side of the bridge.
+     */
+    Node*
+    splitPolygon(Node* a, Node* b)
+    {
+        nodes.emplace_back(a->i, a->x, a->y);
+        Node* a2 = &nodes.back();
+        nodes.emplace_back(b->i, b->x, b->y);
+        Node* b2 = &nodes.back();
+        Node* an = a->next;
+        Node* bp = b->prev;
+
+        a->next = b;
+        b->prev = a;
+
+        a2->next = an;
+        an->prev = a2;
+
+        b2->next = a2;
+        a2->prev = b2;
+
+        bp->next = b2;
+        b2->prev = bp;
+
+        return b2;
+    }
+
+    Node*
+    eliminateHoles(const std::uint32_t* ringStart, std::size_t numRings, Node* outer)
+    {
+        std::vector<Node*> queue;
+        for(std::size_t r = 1; r < numRings; r++) {
+            Node* list = linkRing(ringStart[r], ringStart[r + 1] - 1, false);
+            if(!list) {
+                continue;
+            }
+            if(list == list->next) {
+                list->isSteiner = true;
+            }
+            queue.push_back(getLeftmost(list));
+        }
+        std::stable_sort(queue.begin(), queue.end(), [](const Node* a, const Node* b) {
+            return a->x < b->x;
+        });
+
+        // holes from left to right, so bridges do not cross
+        for(Node* hole : queue) {
+            outer = eliminateHole(hole, outer);
+        }
+        return outer;
+    }
+
+    Node*
+    eliminateHole(Node* hole, Node* outer)
+    {
+        Node* bridge = findHoleBridge(hole, outer);
+        if(!bridge) {
+            return outer;
+        }
+        Node* bridgeReverse = splitPolygon(bridge, hole);
+
+        // remove the collinear vertices around the cuts
+        filterPoints(bridgeReverse, bridgeReverse->next);
+        return filterPoints(bridge, bridge->next);
+    }
+
+    /*
+     * Finds a vertex of the outer ring visible from the leftmost
+     * vertex of a hole.
+     */
+    Node*
+    findHoleBridge(const Node* hole, Node* outer)
+    {
+        Node* p = outer;
+        double hx = hole->x;
+        double hy = hole->y;
+        double qx = -std::numeric_limits<double>::infinity();
+        Node* m = nullptr;
+
+        // segment crossed by a ray from the hole to the left, the
+        // endpoint with the lesser x is a candidate for the bridge
+        do {
+            if(hy <= p->y && hy >= p->next->y && p->next->y != p->y) {
+                double x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);
+                if(x <= hx && x > qx) {
+                    qx = x;
+                    m = p->x < p->next->x ? p : p->next;
+                    // hole touches the outer segment
+                    if(x == hx) {
+                        return m;
+                    }
+                }
+            }
+            p = p->next;
+        }
+        while(p != outer);
+
+        if(!m) {
+            return nullptr;
+        }
+
+        // Vertices in the triangle of the hole vertex, the ray
+        // intersection and the candidate may hide the candidate.
+        // If any, pick the one with the smallest angle to the ray.
+        Node* stop = m;
+        double mx = m->x;
+        double my = m->y;
+        double tanMin = std::numeric_limits<double>::infinity();
+
+        p = m;
+        do {
+            if(hx >= p->x && p->x >= mx && hx != p->x &&
+                    pointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y)) {
+
+                double tan = std::fabs(hy - p->y) / (hx - p->x);
+                if(locallyInside(p, hole) &&
+                        (tan < tanMin || (tan == tanMin &&
+                                          (p->x > m->x || (p->x == m->x && sectorContainsSector(m, p)))))) {
+                    m = p;
+                    tanMin = tan;
+                }
+            }
+            p = p->next;
+        }
+        while(p != stop);
+
+        return m;
+    }
+
+    std::uint32_t
+    zOrder(double px, double py) const
+    {
+        // coordinates scaled to 15 bits, interleaved.
+        // Holes of invalid polygons can be outside the shell extent.
+        std::uint32_t x = static_cast<std::uint32_t>(std::min(std::max((px - minX) * invSize, 0.0), 32767.0));
+        std::uint32_t y = static_cast<std::uint32_t>(std::min(std::max((py - minY) * invSize, 0.0), 32767.0));
+
+        x = (x | (x << 8)) & 0x00FF00FF;
+        x = (x | (x << 4)) & 0x0F0F0F0F;
+        x = (x | (x << 2)) & 0x33333333;
+        x = (x | (x << 1)) & 0x55555555;
+
+        y = (y | (y << 8)) & 0x00FF00FF;
+        y = (y | (y << 4)) & 0x0F0F0F0F;
+        y = (y | (y << 2)) & 0x33333333;
+        y = (y | (y << 1)) & 0x55555555;
+
+        return x | (y << 1);
+    }
+
+    void
+    indexCurve(Node* start)
+    {
+        Node* p = start;
+        do {
+            p->z = zOrder(p->x, p->y);
+            p->prevZ = p->prev;
+            p->nextZ = p->next;
+            p = p->next;
+        }
+        while(p != start);
+
+        p->prevZ->nextZ = nullptr;
+        p->prevZ = nullptr;
+
+        sortLinked(p);
+    }
+
+    /*
+     * Merge sort of the Z-order list.
+     */
+    static Node*
+    sortLinked(Node* list)
+    {
+        std::size_t inSize = 1;
+        std::size_t numMerges;
+        do {
+            Node* p = list;
+            Node* tail = nullptr;
+            list = nullptr;
+            numMerges = 0;
+
+            while(p) {
+                numMerges++;
+                Node* q = p;
+                std::size_t pSize = 0;
+                for(std::size_t i = 0; i < inSize; i++) {
+                    pSize++;
+                    q = q->nextZ;
+                    if(!q) {
+                        break;
+                    }
+                }
+                std::size_t qSize = inSize;
+
+                while(pSize > 0 || (qSize > 0 && q)) {
+                    Node* e;
+                    if(pSize != 0 && (qSize == 0 || !q || p->z <= q->z)) {
+                        e = p;
+                        p = p->nextZ;
+                        pSize--;
+                    }
+                    else {
+                        e = q;
+                        q = q->nextZ;
+                        qSize--;
+                    }
+
+                    if(tail) {
+                        tail->nextZ = e;
+                    }
+                    else {
+                        list = e;
+                    }
+                    e->prevZ = tail;
+                    tail = e;
+                }
+                p = q;
+            }
+
+            tail->nextZ = nullptr;
+            inSize *= 2;
+        }
+        while(numMerges > 1);
+
+        return list;
+    }
+};
+
+std::uint64_t
+edgeKey(std::uint32_t a, std::uint32_t b)
+{
+    return (static_cast<std::uint64_t>(a) << 32) | b;
+}
+
+std::size_t
+nextHalfEdge(std::size_t e)
+{
+    return (e % 3 == 2) ? e - 2 : e + 1;
+}
+
+std::size_t
+prevHalfEdge(std::size_t e)
+{
+    return (e % 3 == 0) ? e + 2 : e - 1;
+}
+
+} // anonymous namespace
+
+PolygonTriangulator::PolygonTriangulator(const Geometry& geom)
+    : geomFact(geom.getFactory())
+    , isDelaunay(false)
+    , isComputed(false)
+{
+    polyStart.push_back(0);
+    ringStart.push_back(0);
+
+    if(const Polygon* poly = dynamic_cast<const Polygon*>(&geom)) {
+        addPolygon(*poly);
+    }
+    else if(const MultiPolygon* mpoly = dynamic_cast<const MultiPolygon*>(&geom)) {
+        for(std::size_t i = 0; i < mpoly->getNumGeometries(); i++) {
+            addPolygon(*static_cast<const Polygon*>(mpoly->getGeometryN(i)));
+        }
+    }
+    else {
+        throw util::IllegalArgumentException("PolygonTriangulator: input must be a Polygon or MultiPolygon");
+    }
+
+    if(xy.size() / 2 >= NONE) {
+        throw util::IllegalArgumentException("PolygonTriangulator: too many vertices");
+    }
+}
+
+void
+PolygonTriangulator::addPolygon(const Polygon& poly)
+{
+    if(poly.isEmpty()) {
+        return;
+    }
+    auto addRing = [this](const LinearRing* ring) {
+        const CoordinateSequence* seq = ring->getCoordinatesRO();
+        for(std::size_t i = 0; i < seq->size(); i++) {
+            const Coordinate& c = seq->getAt(i);
+            xy.push_back(c.x);
+            xy.push_back(c.y);
+        }
+        ringStart.push_back(static_cast<std::uint32_t>(xy.size() / 2));
+    };
+
+    addRing(poly.getExteriorRing());
+    for(std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+        addRing(poly.getInteriorRingN(i));
+    }
+    polyStart.push_back(ringStart.size() - 1);
+}
+
+/* static */
+std::unique_ptr<Geometry>
+PolygonTriangulator::triangulate(const Geometry& geom, bool isDelaunay)
+{
+    PolygonTriangulator triangulator(geom);
+    triangulator.setDelaunay(isDelaunay);
+    return triangulator.getResult();
+}
+
+const std::vector<std::uint32_t>&
+PolygonTriangulator::getTriangleIndices()
+{
+    compute();
+    return triangles;
+}
+
+void
+PolygonTriangulator::compute()
+{
+    if(isComputed) {
+        return;
+    }
+    for(std::size_t p = 0; p + 1 < polyStart.size(); p++) {
+        std::size_t firstTriangle = triangles.size();
+        triangulatePolygon(polyStart[p], polyStart[p + 1]);
+        if(isDelaunay) {
+            flipToDelaunay(firstTriangle);
+        }
+    }
+    isComputed = true;
+}
+
+void
+PolygonTriangulator::triangulatePolygon(std::size_t firstRing, std::size_t endRing)
+{
+    EarClipper clipper(xy, triangles);
+    clipper.triangulate(&ringStart[firstRing], endRing - firstRing);
+}
+
+/*
+ * Flips the edges of the triangles of a polygon until they are all
+ * locally Delaunay. The ring edges are never flipped, so this gives
+ * the constrained Delaunay triangulation.
+ */
+void
+PolygonTriangulator::flipToDelaunay(std::size_t firstTriangle)
+{
+    std::size_t numHalfEdges = triangles.size() - firstTriangle;
+    if(numHalfEdges < 6) {
+        return;
+    }
+
+    // opposite half-edges, the edges found once are on the boundary
+    std::vector<std::uint32_t> opposite(numHalfEdges, NONE);
+    std::unordered_map<std::uint64_t, std::uint32_t> edges(numHalfEdges);
+    for(std::uint32_t e = 0; e < numHalfEdges; e++) {
+        std::uint32_t a = triangles[firstTriangle + e];
+        std::uint32_t b = triangles[firstTriangle + nextHalfEdge(e)];
+        auto it = edges.find(edgeKey(b, a));
+        if(it != edges.end() && opposite[it->second] == NONE) {
+            opposite[e] = it->second;
+            opposite[it->second] = e;
+        }
+        else {
+            edges.emplace(edgeKey(a, b), e);
+        }
+    }
+    std::unordered_map<std::uint64_t, std::uint32_t>().swap(edges);
+
+    auto vertex = [this, firstTriangle](std::size_t e) {
+        std::uint32_t v = triangles[firstTriangle + e];
+        return Coordinate(xy[2 * v], xy[2 * v + 1]);
+    };
+    auto link = [&opposite](std::size_t a, std::uint32_t b) {
+        opposite[a] = b;
+        if(b != NONE) {
+            opposite[b] = static_cast<std::uint32_t>(a);
+        }
+    };
+
+    std::vector<std::uint32_t> stack;
+    for(std::uint32_t e = 0; e < numHalfEdges; e++) {
+        if(opposite[e] != NONE && e < opposite[e]) {
+            stack.push_back(e);
+        }
+    }
+
+    // near-cocircular vertices could make flips cycle
+    std::size_t maxFlips = 16 * numHalfEdges;
+    std::size_t numFlips = 0;
+
+    while(!stack.empty() && numFlips < maxFlips) {
+        std::size_t e = stack.back();
+        stack.pop_back();
+        std::uint32_t f = opposite[e];
+        if(f == NONE) {
+            continue;
+        }
+
+        // triangle abc on e = ab, triangle bad on f = ba
+        std::size_t e1 = nextHalfEdge(e);
+        std::size_t e2 = prevHalfEdge(e);
+        std::size_t f1 = nextHalfEdge(f);
+        std::size_t f2 = prevHalfEdge(f);
+        Coordinate a = vertex(e);
+        Coordinate b = vertex(e1);
+        Coordinate c = vertex(e2);
+        Coordinate d = vertex(f2);
+
+        if(!TrianglePredicate::isInCircleRobust(a, b, c, d)) {
+            continue;
+        }
+        // the quadrilateral adbc must be strictly convex
+        if(algorithm::Orientation::index(c, d, a) != algorithm::Orientation::CLOCKWISE ||
+                algorithm::Orientation::index(c, d, b) != algorithm::Orientation::COUNTERCLOCKWISE) {
+            continue;
+        }
+
+        // replace ab by cd: triangles dbc and cad
+        std::uint32_t vc = triangles[firstTriangle + e2];
+        std::uint32_t vd = triangles[firstTriangle + f2];
+        triangles[firstTriangle + e] = vd;
+        triangles[firstTriangle + f] = vc;
+
+        std::uint32_t oppF2 = opposite[f2];
+        std::uint32_t oppE2 = opposite[e2];
+        link(e, oppF2);
+        link(f, oppE2);
+        link(e2, static_cast<std::uint32_t>(f2));
+        numFlips++;
+
+        for(std::size_t g : { e, e1, std::size_t(f), f1 }) {
+            if(opposite[g] != NONE) {
+                stack.push_back(static_cast<std::uint32_t>(g));
+            }
+        }
+    }
+}
+
+std::unique_ptr<Geometry>
+PolygonTriangulator::getResult()
+{
+    compute();
+
+    std::vector<std::unique_ptr<Geometry>> tris;
+    tris.reserve(triangles.size() / 3);
+    for(std::size_t t = 0; t < triangles.size(); t += 3) {
+        std::vector<Coordinate> pts(4);
+        for(std::size_t k = 0; k < 3; k++) {
+            std::uint32_t v = triangles[t + k];
+            pts[k] = Coordinate(xy[2 * v], xy[2 * v + 1]);
+        }
+        pts[3] = pts[0];
+        auto ring = geomFact->createLinearRing(
+                        geomFact->getCoordinateSequenceFactory()->create(std::move(pts)));
+        tris.push_back(geomFact->createPolygon(std::move(ring)));
+    }
+    return geomFact->createGeometryCollection(std::move(tris));
+}
+
+} //namespace geos.triangulate
+} //namespace geos
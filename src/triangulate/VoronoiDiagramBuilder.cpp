@@ -19,19 +19,29 @@
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <math.h>
+#include <numeric>
 #include <vector>
 #include <iostream>
 
+#include <geos/constants.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/Envelope.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Triangle.h>
+#include <geos/triangulate/CompactDelaunayTriangulator.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/util.h>
+#include <geos/util/ParallelFor.h>
 
 using geos::detail::make_unique;
 
@@ -40,9 +50,133 @@ namespace triangulate { //geos.triangulate
 
 using namespace geos::geom;
 
+namespace {
+
+/*
+ * Sutherland-Hodgman clipping of convex cells, given as rings without
+ * their closing point.
+ *
+ * Crossing points are computed from the endpoints of the crossing
+ * segment taken in a fixed order, so that the two cells sharing an
+ * edge get bit-identical points and the clipped diagram stays a
+ * proper coverage.
+ */
+
+// Clips pts to the side of a rectangle where side * (p - bound) >= 0,
+// along X or along Y
+void
+clipToBound(std::vector<Coordinate>& pts, std::vector<Coordinate>& out,
+            bool isX, double bound, double side)
+{
+    out.clear();
+    if(pts.empty()) {
+        return;
+    }
+    auto isInside = [isX, bound, side](const Coordinate& p) {
+        return side * ((isX ? p.x : p.y) - bound) >= 0;
+    };
+
+    const Coordinate* prev = &pts.back();
+    bool isPrevInside = isInside(*prev);
+    for(const Coordinate& p : pts) {
+        bool isPInside = isInside(p);
+        if(isPInside != isPrevInside) {
+            Coordinate a = *prev;
+            Coordinate b = p;
+            if(b.compareTo(a) < 0) {
+                std::swap(a, b);
+            }
+            if(isX) {
+                double t = (bound - a.x) / (b.x - a.x);
+                out.emplace_back(bound, a.y + t * (b.y - a.y));
+            }
+            else {
+                double t = (bound - a.y) / (b.y - a.y);
+                out.emplace_back(a.x + t * (b.x - a.x), bound);
+            }
+        }
+        if(isPInside) {
+            out.push_back(p);
+        }
+        prev = &p;
+        isPrevInside = isPInside;
+    }
+    pts.swap(out);
+}
+
+// Clips pts to the half-plane of the points closer to site than to other
+void
+clipToBisector(std::vector<Coordinate>& pts, std::vector<Coordinate>& out,
+               const Coordinate& site, const Coordinate& other)
+{
+    out.clear();
+    if(pts.empty()) {
+        return;
+    }
+    double dx = other.x - site.x;
+    double dy = other.y - site.y;
+    double mx = (site.x + other.x) / 2;
+    double my = (site.y + other.y) / 2;
+    auto dist = [dx, dy, mx, my](const Coordinate& p) {
+        return (p.x - mx) * dx + (p.y - my) * dy;
+    };
+
+    const Coordinate* prev = &pts.back();
+    double prevDist = dist(*prev);
+    for(const Coordinate& p : pts) {
+        double pDist = dist(p);
+        if((pDist <= 0) != (prevDist <= 0)) {
+            Coordinate a = *prev;
+            Coordinate b = p;
+            double da = prevDist;
+            double db = pDist;
+            if(b.compareTo(a) < 0) {
+                std::swap(a, b);
+                std::swap(da, db);
+            }
+            double t = da / (da - db);
+            out.emplace_back(a.x + t * (b.x - a.x), a.y + t * (b.y - a.y));
+        }
+        if(pDist <= 0) {
+            out.push_back(p);
+        }
+        prev = &p;
+        prevDist = pDist;
+    }
+    pts.swap(out);
+}
+
+void
+clipToEnvelope(std::vector<Coordinate>& pts, std::vector<Coordinate>& out, const Envelope& env)
+{
+    clipToBound(pts, out, true, env.getMinX(), 1);
+    clipToBound(pts, out, true, env.getMaxX(), -1);
+    clipToBound(pts, out, false, env.getMinY(), 1);
+    clipToBound(pts, out, false, env.getMaxY(), -1);
+}
+
+// Builds a cell polygon from a ring without its closing point,
+// or an empty polygon if it has collapsed
+std::unique_ptr<Geometry>
+createCell(std::vector<Coordinate>& pts, const GeometryFactory& geomFact)
+{
+    pts.erase(std::unique(pts.begin(), pts.end()), pts.end());
+    while(pts.size() > 1 && pts.front() == pts.back()) {
+        pts.pop_back();
+    }
+    if(pts.size() < 3) {
+        return geomFact.createPolygon();
+    }
+    pts.push_back(pts.front());
+    std::unique_ptr<CoordinateSequence> seq(new CoordinateArraySequence(std::move(pts)));
+    return geomFact.createPolygon(geomFact.createLinearRing(std::move(seq)));
+}
+
+} // anonymous namespace
+
 
 VoronoiDiagramBuilder::VoronoiDiagramBuilder() :
-    tolerance(0.0), clipEnv(nullptr)
+    tolerance(0.0), isHilbertOrder(false), isOrdered(false), numThreads(1), clipEnv(nullptr)
 {
 }
 
@@ -50,12 +184,14 @@ void
 VoronoiDiagramBuilder::setSites(const geom::Geometry& geom)
 {
     siteCoords = DelaunayTriangulationBuilder::extractUniqueCoordinates(geom);
+    inputCoords = geom.getCoordinates();
 }
 
 void
 VoronoiDiagramBuilder::setSites(const geom::CoordinateSequence& coords)
 {
     siteCoords = operation::valid::RepeatedPointRemover::removeRepeatedPoints(&coords);
+    inputCoords = coords.clone();
 }
 
 void
@@ -71,12 +207,26 @@ VoronoiDiagramBuilder::setTolerance(double nTolerance)
 }
 
 void
-VoronoiDiagramBuilder::create()
+VoronoiDiagramBuilder::setHilbertOrder(bool p_isHilbertOrder)
 {
-    if(subdiv.get()) {
-        return;
-    }
+    isHilbertOrder = p_isHilbertOrder;
+}
+
+void
+VoronoiDiagramBuilder::setOrdered(bool p_isOrdered)
+{
+    isOrdered = p_isOrdered;
+}
+
+void
+VoronoiDiagramBuilder::setNumThreads(unsigned int p_numThreads)
+{
+    numThreads = p_numThreads;
+}
 
+void
+VoronoiDiagramBuilder::computeDiagramEnvelope()
+{
     diagramEnv = DelaunayTriangulationBuilder::envelope(*siteCoords);
     //adding buffer around the final envelope
     double expandBy = std::max(diagramEnv.getWidth(), diagramEnv.getHeight());
@@ -84,13 +234,19 @@ VoronoiDiagramBuilder::create()
     if(clipEnv) {
         diagramEnv.expandToInclude(clipEnv);
     }
+}
+
+void
+VoronoiDiagramBuilder::create()
+{
+    if(subdiv.get()) {
+        return;
+    }
 
-    auto vertices = DelaunayTriangulationBuilder::toVertices(*siteCoords);
-    std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
+    computeDiagramEnvelope();
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(diagramEnv, tolerance));
-    IncrementalDelaunayTriangulator triangulator(subdiv.get());
-    triangulator.insertSites(vertices);
+    DelaunayTriangulationBuilder::insertSites(*subdiv, *siteCoords, isHilbertOrder);
 }
 
 std::unique_ptr<quadedge::QuadEdgeSubdivision>
@@ -104,6 +260,10 @@ VoronoiDiagramBuilder::getSubdivision()
 std::unique_ptr<geom::GeometryCollection>
 VoronoiDiagramBuilder::getDiagram(const geom::GeometryFactory& geomFact)
 {
+    if(isOrdered) {
+        return getOrderedDiagram(geomFact);
+    }
+
     create();
 
     auto polys = subdiv->getVoronoiCellPolygons(geomFact);
@@ -116,6 +276,148 @@ VoronoiDiagramBuilder::getDiagram(const geom::GeometryFactory& geomFact)
     return ret;
 }
 
+std::unique_ptr<geom::GeometryCollection>
+VoronoiDiagramBuilder::getOrderedDiagram(const geom::GeometryFactory& geomFact)
+{
+    typedef CompactDelaunayTriangulator CDT;
+
+    std::vector<std::unique_ptr<Geometry>> cells;
+    if(siteCoords->isEmpty()) {
+        return geomFact.createGeometryCollection(std::move(cells));
+    }
+    computeDiagramEnvelope();
+
+    // keep the first occurrence of each site, in input order
+    std::size_t numInput = inputCoords->size();
+    std::vector<std::size_t> order(numInput);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+        return inputCoords->getAt(a).compareTo(inputCoords->getAt(b)) < 0;
+    });
+    std::vector<bool> isFirst(numInput, false);
+    for(std::size_t k = 0; k < numInput; k++) {
+        if(k == 0 || !inputCoords->getAt(order[k]).equals2D(inputCoords->getAt(order[k - 1]))) {
+            isFirst[order[k]] = true;
+        }
+    }
+    std::vector<double> xy;
+    xy.reserve(2 * siteCoords->size());
+    for(std::size_t i = 0; i < numInput; i++) {
+        if(isFirst[i]) {
+            xy.push_back(inputCoords->getX(i));
+            xy.push_back(inputCoords->getY(i));
+        }
+    }
+    std::size_t numSites = xy.size() / 2;
+
+    CDT cdt(xy.data(), numSites);
+    const std::vector<std::uint32_t>& tri = cdt.getTriangleVertices();
+    const std::vector<std::uint32_t>& halfEdges = cdt.getHalfEdges();
+    auto site = [&xy](std::size_t i) {
+        return Coordinate(xy[2 * i], xy[2 * i + 1]);
+    };
+
+    // the cells are independent, and each is stored at its site index
+    cells.resize(numSites);
+
+    if(tri.empty()) {
+        // one site, or collinear sites split by parallel bisectors
+        const std::vector<std::uint32_t>& hull = cdt.getHull();
+        std::vector<std::size_t> hullIndex(numSites, 0);
+        for(std::size_t k = 0; k < hull.size(); k++) {
+            hullIndex[hull[k]] = k;
+        }
+        util::parallelFor(numSites, numThreads, [&](std::size_t i) {
+            std::vector<Coordinate> pts = {
+                Coordinate(diagramEnv.getMinX(), diagramEnv.getMinY()),
+                Coordinate(diagramEnv.getMinX(), diagramEnv.getMaxY()),
+                Coordinate(diagramEnv.getMaxX(), diagramEnv.getMaxY()),
+                Coordinate(diagramEnv.getMaxX(), diagramEnv.getMinY())
+            };
+            std::vector<Coordinate> work;
+            std::size_t k = hullIndex[i];
+            if(k > 0) {
+                clipToBisector(pts, work, site(i), site(hull[k - 1]));
+            }
+            if(k + 1 < hull.size()) {
+                clipToBisector(pts, work, site(i), site(hull[k + 1]));
+            }
+            cells[i] = createCell(pts, geomFact);
+        });
+        return geomFact.createGeometryCollection(std::move(cells));
+    }
+
+    // the Voronoi vertices
+    std::size_t numTri = tri.size() / 3;
+    std::vector<Coordinate> centres(numTri);
+    util::parallelFor(numTri, numThreads, [&](std::size_t t) {
+        Triangle triangle(site(tri[3 * t]), site(tri[3 * t + 1]), site(tri[3 * t + 2]));
+        triangle.circumcentreDD(centres[t]);
+    });
+    Envelope extent(diagramEnv);
+    for(const Coordinate& c : centres) {
+        extent.expandToInclude(c);
+    }
+    // the unbounded cells of the hull sites are closed far enough
+    // not to change their part inside the diagram envelope
+    double farDist = 4 * (extent.getWidth() + extent.getHeight()) + 1;
+
+    // an incoming half-edge for every site, the hull one for hull sites
+    std::vector<std::uint32_t> incoming(numSites, CDT::NONE);
+    for(std::size_t e = 0; e < tri.size(); e++) {
+        std::uint32_t v = tri[CDT::nextHalfEdge(e)];
+        if(incoming[v] == CDT::NONE || halfEdges[e] == CDT::NONE) {
+            incoming[v] = static_cast<std::uint32_t>(e);
+        }
+    }
+
+    util::parallelFor(numSites, numThreads, [&](std::size_t i) {
+        std::vector<Coordinate> pts;
+        std::uint32_t start = incoming[i];
+        if(start == CDT::NONE) {
+            cells[i] = createCell(pts, geomFact);
+            return;
+        }
+
+        // circumcentres of the triangles around the site, clockwise
+        std::uint32_t e = start;
+        std::uint32_t last;
+        do {
+            pts.push_back(centres[e / 3]);
+            last = e;
+            e = halfEdges[CDT::nextHalfEdge(e)];
+        }
+        while(e != CDT::NONE && e != start);
+
+        if(e == CDT::NONE) {
+            // hull site: follow the outward normals of the two hull
+            // edges, joined by an arc
+            Coordinate prev = site(tri[start]);
+            Coordinate next = site(tri[CDT::nextHalfEdge(CDT::nextHalfEdge(last))]);
+            Coordinate p = site(i);
+            double angleIn = std::atan2(-(p.x - prev.x), p.y - prev.y);
+            double angleOut = std::atan2(-(next.x - p.x), next.y - p.y);
+            double sweep = std::fmod(angleOut - angleIn + 4 * MATH_PI, 2 * MATH_PI);
+            Coordinate first = pts.front();
+            Coordinate arcCentre = pts.back();
+            int numArcPts = std::max(1, static_cast<int>(std::ceil(sweep / (MATH_PI / 4))));
+            for(int k = 0; k < numArcPts; k++) {
+                double angle = angleOut - k * sweep / numArcPts;
+                pts.emplace_back(arcCentre.x + farDist * std::cos(angle),
+                                 arcCentre.y + farDist * std::sin(angle));
+            }
+            pts.emplace_back(first.x + farDist * std::cos(angleIn),
+                             first.y + farDist * std::sin(angleIn));
+        }
+
+        std::vector<Coordinate> work;
+        clipToEnvelope(pts, work, diagramEnv);
+        cells[i] = createCell(pts, geomFact);
+    });
+
+    return geomFact.createGeometryCollection(std::move(cells));
+}
+
 std::unique_ptr<geom::Geometry>
 VoronoiDiagramBuilder::getDiagramEdges(const geom::GeometryFactory& geomFact)
 {
@@ -138,8 +440,9 @@ VoronoiDiagramBuilder::clipGeometryCollection(std::vector<std::unique_ptr<Geomet
 
     auto gfact = geoms[0]->getFactory();
 
-    std::unique_ptr<geom::Geometry> clipPoly(gfact->toGeometry(&clipEnv));
     std::vector<std::unique_ptr<Geometry>> clipped;
+    std::vector<Coordinate> pts;
+    std::vector<Coordinate> work;
 
     for(auto& g : geoms) {
         // don't clip unless necessary
@@ -147,7 +450,12 @@ VoronoiDiagramBuilder::clipGeometryCollection(std::vector<std::unique_ptr<Geomet
             clipped.push_back(std::move(g));
             // TODO: check if userData is correctly cloned here?
         } else if(clipEnv.intersects(g->getEnvelopeInternal())) {
-            auto result = clipPoly->intersection(g.get());
+            // cells are convex, so the clip needs no overlay
+            const Polygon* cell = static_cast<const Polygon*>(g.get());
+            cell->getExteriorRing()->getCoordinatesRO()->toVector(pts);
+            pts.pop_back();
+            clipToEnvelope(pts, work, clipEnv);
+            auto result = createCell(pts, *gfact);
             result->setUserData(g->getUserData()); // TODO: needed ?
             if (!result->isEmpty()) {
                 clipped.push_back(std::move(result));
@@ -138,12 +138,12 @@ QuadEdge*
 QuadEdgeSubdivision::locateFromEdge(const Vertex& v,
                                     const QuadEdge& startEdge) const
 {
-    ::geos::ignore_unused_variable_warning(startEdge);
-
     size_t iter = 0;
     auto maxIter = quadEdges.size();
 
-    QuadEdge* e = startingEdges[0];
+    // Removed edges are kept in quadEdges, so a stale start edge is
+    // still valid memory, but it is no longer part of the subdivision.
+    QuadEdge* e = startEdge.isLive() ? const_cast<QuadEdge*>(&startEdge) : startingEdges[0];
 
     for(;;) {
         ++iter;
@@ -552,11 +552,9 @@ QuadEdgeSubdivision::getVoronoiCellPolygon(const QuadEdge* qe, const geom::Geome
     auto seq = geomFact.getCoordinateSequenceFactory()->create(std::move(cellPts));
     std::unique_ptr<Geometry> cellPoly = geomFact.createPolygon(geomFact.createLinearRing(std::move(seq)));
 
-    // FIXME why is this returning a pointer to a local variable?
-    Vertex v = startQE->orig();
-    Coordinate c(0, 0);
-    c = v.getCoordinate();
-    cellPoly->setUserData(reinterpret_cast<void*>(&c));
+    // the site coordinate, owned by this subdivision
+    const Coordinate& site = startQE->orig().getCoordinate();
+    cellPoly->setUserData(reinterpret_cast<void*>(const_cast<Coordinate*>(&site)));
     return cellPoly;
 }
 
@@ -584,11 +582,9 @@ QuadEdgeSubdivision::getVoronoiCellEdge(const QuadEdge* qe, const geom::Geometry
     std::unique_ptr<geom::Geometry> cellEdge(
         geomFact.createLineString(new geom::CoordinateArraySequence(std::move(cellPts))));
 
-    // FIXME why is this returning a pointer to a local variable?
-    Vertex v = startQE->orig();
-    Coordinate c(0, 0);
-    c = v.getCoordinate();
-    cellEdge->setUserData(reinterpret_cast<void*>(&c));
+    // the site coordinate, owned by this subdivision
+    const Coordinate& site = startQE->orig().getCoordinate();
+    cellEdge->setUserData(reinterpret_cast<void*>(const_cast<Coordinate*>(&site)));
     return cellEdge;
 }
 
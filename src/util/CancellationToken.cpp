@@ -0,0 +1,108 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/CancellationToken.h>
+
+namespace {
+
+thread_local geos::util::CancellationToken* currentToken = nullptr;
+
+}
+
+namespace geos {
+namespace util { // geos::util
+
+CancellationToken::CancellationToken()
+    : requested(false)
+    , deadlineSet(false)
+    , callback(nullptr)
+    , callbackData(nullptr)
+{}
+
+void
+CancellationToken::request()
+{
+    requested.store(true, std::memory_order_relaxed);
+}
+
+void
+CancellationToken::cancel()
+{
+    requested.store(false, std::memory_order_relaxed);
+}
+
+bool
+CancellationToken::isRequested() const
+{
+    return requested.load(std::memory_order_relaxed);
+}
+
+void
+CancellationToken::setDeadline(Clock::time_point p_deadline)
+{
+    deadline = p_deadline;
+    deadlineSet = true;
+}
+
+void
+CancellationToken::setTimeout(Clock::duration timeout)
+{
+    setDeadline(Clock::now() + timeout);
+}
+
+void
+CancellationToken::clearDeadline()
+{
+    deadlineSet = false;
+}
+
+void
+CancellationToken::setCallback(Callback* cb, void* userData)
+{
+    callback = cb;
+    callbackData = userData;
+}
+
+bool
+CancellationToken::check()
+{
+    if(callback && (*callback)(callbackData)) {
+        return true;
+    }
+    // Only pay for the read-modify-write when a request is pending
+    if(requested.load(std::memory_order_relaxed) &&
+            requested.exchange(false, std::memory_order_relaxed)) {
+        return true;
+    }
+    return deadlineSet && Clock::now() >= deadline;
+}
+
+CancellationScope::CancellationScope(CancellationToken* token)
+    : previous(currentToken)
+{
+    currentToken = token;
+}
+
+CancellationScope::~CancellationScope()
+{
+    currentToken = previous;
+}
+
+/* static */
+CancellationToken*
+CancellationScope::current()
+{
+    return currentToken;
+}
+
+} // namespace geos::util
+} // namespace geos
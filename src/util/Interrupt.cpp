@@ -14,6 +14,7 @@
 
 #include <geos/util/Interrupt.h>
 #include <geos/util/GEOSException.h> // for inheritance
+#include <geos/util/CancellationToken.h>
 
 namespace {
 /* Could these be portably stored in thread-specific space ? */
@@ -67,6 +68,10 @@ Interrupt::process()
         requested = false;
         interrupt();
     }
+    CancellationToken* token = CancellationScope::current();
+    if(token && token->check()) {
+        interrupt();
+    }
 }
 
 
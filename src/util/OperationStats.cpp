@@ -0,0 +1,134 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/OperationStats.h>
+
+namespace {
+
+thread_local geos::util::OperationStats* currentStats = nullptr;
+
+}
+
+namespace geos {
+namespace util { // geos::util
+
+OperationStats::OperationStats()
+{
+    reset();
+}
+
+void
+OperationStats::reset()
+{
+    for(int i = 0; i < NUM_PHASES; i++) {
+        times[i] = Clock::duration::zero();
+    }
+    for(int i = 0; i < NUM_COUNTERS; i++) {
+        counts[i] = 0;
+    }
+}
+
+void
+OperationStats::merge(const OperationStats& other)
+{
+    for(int i = 0; i < NUM_PHASES; i++) {
+        times[i] += other.times[i];
+    }
+    for(int i = 0; i < NUM_COUNTERS; i++) {
+        counts[i] += other.counts[i];
+    }
+}
+
+bool
+OperationStats::isEmpty() const
+{
+    for(int i = 0; i < NUM_PHASES; i++) {
+        if(times[i] != Clock::duration::zero()) {
+            return false;
+        }
+    }
+    for(int i = 0; i < NUM_COUNTERS; i++) {
+        if(counts[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double
+OperationStats::getTime(Phase phase) const
+{
+    return std::chrono::duration<double>(times[phase]).count();
+}
+
+/* static */
+const char*
+OperationStats::getName(Phase phase)
+{
+    switch(phase) {
+    case NODING:
+        return "noding";
+    case GRAPH_BUILD:
+        return "graph build";
+    case LABELLING:
+        return "labelling";
+    case RESULT_BUILD:
+        return "result build";
+    case BUFFER_CURVES:
+        return "buffer curves";
+    default:
+        return "unknown";
+    }
+}
+
+/* static */
+const char*
+OperationStats::getName(Counter counter)
+{
+    switch(counter) {
+    case SEGMENTS_NODED:
+        return "segments noded";
+    case NODED_EDGES:
+        return "noded edges";
+    case INTERSECTIONS_FOUND:
+        return "intersections found";
+    case OVERLAY_SNAPPING_TRIES:
+        return "overlay snapping tries";
+    case OVERLAY_SNAP_ROUNDING_TRIES:
+        return "overlay snap-rounding tries";
+    case LOCAL_SNAP_ROUNDED_SEGMENTS:
+        return "segments snap-rounded locally";
+    default:
+        return "unknown";
+    }
+}
+
+/* static */
+OperationStats*
+OperationStats::current()
+{
+    return currentStats;
+}
+
+OperationStatsScope::OperationStatsScope(OperationStats* stats)
+    : previous(currentStats)
+{
+    currentStats = stats;
+}
+
+OperationStatsScope::~OperationStatsScope()
+{
+    currentStats = previous;
+}
+
+} // namespace geos::util
+} // namespace geos
@@ -0,0 +1,81 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/ParallelFor.h>
+#include <geos/util/CancellationToken.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace util { // geos::util
+
+void
+parallelFor(std::size_t n, unsigned int numThreads,
+            const std::function<void(std::size_t)>& task)
+{
+    if(numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if(numThreads > n) {
+        numThreads = static_cast<unsigned int>(std::max<std::size_t>(1, n));
+    }
+
+    CancellationToken* token = CancellationScope::current();
+    std::atomic<std::size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        CancellationScope scope(token);
+        try {
+            for(std::size_t i = next++; i < n && !failed; i = next++) {
+                task(i);
+            }
+        }
+        catch(...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if(!firstError) {
+                firstError = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(unsigned int t = 1; t < numThreads; t++) {
+        try {
+            threads.emplace_back(worker);
+        }
+        catch(const std::system_error&) {
+            // run on the threads we could get
+            break;
+        }
+    }
+    worker();
+    for(std::thread& t : threads) {
+        t.join();
+    }
+
+    if(firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+} // namespace geos::util
+} // namespace geos
@@ -18,6 +18,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 
 
@@ -173,8 +174,76 @@ void object::test<6>
        0.01, 100, 100, 0 );
 }
 
+//
+// Batch of polygons
+//
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.push_back(reader_.read("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))"));
+    geoms.push_back(reader_.read("POLYGON ((10 10, 100 10, 100 100, 10 100, 10 10), (50 50, 50 90, 90 90, 90 50, 50 50))"));
+    geoms.push_back(reader_.read("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 50 0, 50 30, 20 30, 20 0)))"));
+
+    std::vector<const Geometry*> polygonals;
+    for (const auto& g : geoms) {
+        polygonals.push_back(g.get());
+    }
+
+    std::vector<Coordinate> centers;
+    std::vector<double> radii;
+    MaximumInscribedCircle::getCenters(polygonals, 0.01, centers, radii);
+    ensure_equals(centers.size(), 3u);
+    ensure_equals(radii.size(), 3u);
+
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        MaximumInscribedCircle mic(geoms[i].get(), 0.01);
+        ensure_equals_coordinate(centers[i], *mic.getCenter()->getCoordinate(), 0);
+        ensure_equals("radius", radii[i], mic.getRadiusLine()->getLength(), 0);
+    }
+    ensure_equals_coordinate(centers[0], Coordinate(150, 150), 0.02);
+    ensure_equals("radius", radii[2], 15.0, 0.02);
+}
 
 
 
+
+// getCenters over several threads, with a polygon listed twice
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    for (int i = 0; i < 50; i++) {
+        std::ostringstream wkt;
+        wkt << "POLYGON ((0 0, " << 10 + i << " 0, " << 10 + i << " " << 5 + i << ", 0 20, 0 0))";
+        geoms.push_back(reader_.read(wkt.str()));
+    }
+
+    std::vector<const Geometry*> polygonals;
+    for (const auto& g : geoms) {
+        polygonals.push_back(g.get());
+    }
+    polygonals.push_back(geoms[0].get());
+
+    std::vector<Coordinate> expectedCenters;
+    std::vector<double> expectedRadii;
+    MaximumInscribedCircle::getCenters(polygonals, 0.01, expectedCenters, expectedRadii);
+
+    std::vector<Coordinate> centers;
+    std::vector<double> radii;
+    MaximumInscribedCircle::getCenters(polygonals, 0.01, centers, radii, 4);
+    ensure_equals(centers.size(), polygonals.size());
+    ensure_equals(radii.size(), polygonals.size());
+    for (std::size_t i = 0; i < polygonals.size(); i++) {
+        ensure_equals_coordinate(centers[i], expectedCenters[i], 0);
+        ensure_equals("radius", radii[i], expectedRadii[i], 0);
+    }
+    ensure_equals_coordinate(centers.back(), centers[0], 0);
+}
+
 } // namespace tut
 
@@ -11,11 +11,14 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/util/IllegalArgumentException.h>
 // std
 #include <cmath>
 #include <sstream>
 #include <string>
 #include <memory>
+#include <random>
 
 namespace geos {
 namespace geom {
@@ -72,6 +75,34 @@ struct test_DiscreteFrechetDistance_data {
         ensure(diff <= TOLERANCE);
     }
 
+    void
+    checkWithinDistance(const Geometry& g1, const Geometry& g2)
+    {
+        double distance = DiscreteFrechetDistance::distance(g1, g2);
+        ensure(DiscreteFrechetDistance::isWithinDistance(g1, g2, distance));
+        ensure(DiscreteFrechetDistance::isWithinDistance(g1, g2, distance * (1 + 1e-9)));
+        ensure(distance == 0 || !DiscreteFrechetDistance::isWithinDistance(g1, g2, distance * (1 - 1e-9)));
+    }
+
+    // A random walk, and the same walk with its points moved a little
+    std::unique_ptr<Geometry>
+    randomTrace(std::size_t n, double noise, unsigned int seed)
+    {
+        std::default_random_engine walk(17);
+        std::default_random_engine jitter(seed);
+        std::uniform_real_distribution<> step(-1, 1);
+        std::uniform_real_distribution<> offset(-noise, noise);
+        std::vector<Coordinate> coords(n);
+        double x = 0;
+        double y = 0;
+        for(Coordinate& c : coords) {
+            x += 1 + step(walk);
+            y += step(walk);
+            c = Coordinate(x + offset(jitter), y + offset(jitter));
+        }
+        return std::unique_ptr<Geometry>(gf->createLineString(new CoordinateArraySequence(std::move(coords))));
+    }
+
     PrecisionModel pm;
     GeometryFactory::Ptr gf;
     geos::io::WKTReader reader;
@@ -132,4 +163,54 @@ void object::test<4>
     runTest("LINESTRING (0 0, 100 0)", "LINESTRING (0 0, 50 50, 100 0)", 0.5, 50.0);
 }
 
+// 5 - isWithinDistance agrees with the distance
+template<>
+template<>
+void object::test<5>
+()
+{
+    GeomPtr a(reader.read("LINESTRING (0 0, 50 200, 100 0, 150 200, 200 0)"));
+    GeomPtr b(reader.read("LINESTRING (0 200, 200 150, 0 100, 200 50, 0 0)"));
+    GeomPtr c(reader.read("LINESTRING (0 0, 200 50, 0 100, 200 150, 0 200)"));
+    checkWithinDistance(*a, *b);
+    checkWithinDistance(*a, *c);
+    checkWithinDistance(*b, *c);
+    checkWithinDistance(*a, *a);
+
+    GeomPtr pt(reader.read("POINT (1 1)"));
+    checkWithinDistance(*pt, *a);
+
+    auto trace1 = randomTrace(2000, 0.5, 1);
+    auto trace2 = randomTrace(1500, 0.5, 2);
+    checkWithinDistance(*trace1, *trace2);
+}
+
+// 6 - Long traces, with a linear amount of memory
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto trace1 = randomTrace(100000, 0.5, 1);
+    auto trace2 = randomTrace(100000, 0.5, 2);
+    ensure(DiscreteFrechetDistance::isWithinDistance(*trace1, *trace2, 1.5));
+    ensure(!DiscreteFrechetDistance::isWithinDistance(*trace1, *trace2, 0.1));
+}
+
+// 7 - Empty input
+template<>
+template<>
+void object::test<7>
+()
+{
+    GeomPtr empty(reader.read("LINESTRING EMPTY"));
+    GeomPtr line(reader.read("LINESTRING (0 0, 1 1)"));
+    try {
+        DiscreteFrechetDistance::distance(*empty, *line);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,159 @@
+//
+// Test Suite for geos::algorithm::distance::IndexedHausdorffDistance
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKTReader.h>
+#include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
+#include <geos/algorithm/distance/IndexedHausdorffDistance.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <string>
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::algorithm::distance;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_indexedhausdorffdistance_data {
+    geos::io::WKTReader reader;
+
+    // Checks the distance against the discrete distance of the
+    // inputs densified to a much finer step than their features
+    void
+    checkDenseDistance(const std::string& wkt1, const std::string& wkt2)
+    {
+        auto g1 = reader.read(wkt1);
+        auto g2 = reader.read(wkt2);
+
+        double distance = IndexedHausdorffDistance::distance(*g1, *g2);
+        double discrete = DiscreteHausdorffDistance::distance(*g1, *g2);
+        double dense = DiscreteHausdorffDistance::distance(*g1, *g2, 0.0001);
+        ensure(distance >= discrete - 1e-12);
+        ensure(distance >= dense - 1e-12);
+        ensure_distance(distance, dense, 1e-2);
+
+        ensure_distance(IndexedHausdorffDistance::distance(*g2, *g1), distance, 1e-9);
+    }
+};
+
+typedef test_group<test_indexedhausdorffdistance_data> group;
+typedef group::object object;
+
+group test_indexedhausdorffdistance_group("geos::algorithm::distance::IndexedHausdorffDistance");
+
+//
+// Test Cases
+//
+
+// 1 - The largest distance is reached inside a segment
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto line = reader.read("LINESTRING (0 0, 10 0)");
+    auto pts = reader.read("MULTIPOINT ((0 1), (10 1))");
+
+    IndexedHausdorffDistance dist(*line, *pts);
+    ensure_distance(dist.orientedDistance(), std::sqrt(26.0), 1e-8);
+    ensure_distance(dist.getCoordinates()[0].x, 5.0, 1e-7);
+    ensure_distance(dist.getCoordinates()[0].y, 0.0, 1e-12);
+
+    ensure_distance(DiscreteHausdorffDistance::distance(*line, *pts), 1.0, 1e-12);
+}
+
+// 2 - Example where the discrete distance is far from the exact one
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkDenseDistance("LINESTRING (0 0, 100 0, 10 100, 10 100)",
+                       "LINESTRING (0 100, 0 10, 80 10)");
+
+    auto g1 = reader.read("LINESTRING (0 0, 100 0, 10 100, 10 100)");
+    auto g2 = reader.read("LINESTRING (0 100, 0 10, 80 10)");
+    ensure(IndexedHausdorffDistance::distance(*g1, *g2) > 47.0);
+}
+
+// 3 - Lines running along each other
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto g1 = reader.read("LINESTRING (0 0, 50 0, 100 0, 100 100)");
+    auto g2 = reader.read("LINESTRING (0 0, 100 0, 100 50, 100 100)");
+    ensure_equals(IndexedHausdorffDistance::distance(*g1, *g2), 0.0);
+
+    checkDenseDistance("LINESTRING (0 0, 20 1, 40 -1, 60 2, 80 0, 100 1)",
+                       "LINESTRING (0 3, 25 4, 50 2, 75 5, 100 3)");
+}
+
+// 4 - Oriented distance and the points separated by the distance
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto line = reader.read("LINESTRING (0 0, 10 0)");
+    auto pt = reader.read("POINT (5 5)");
+
+    IndexedHausdorffDistance lineToPoint(*line, *pt);
+    ensure_distance(lineToPoint.orientedDistance(), std::sqrt(50.0), 1e-12);
+
+    IndexedHausdorffDistance pointToLine(*pt, *line);
+    ensure_distance(pointToLine.orientedDistance(), 5.0, 1e-12);
+    ensure(pointToLine.getCoordinates()[0].equals2D(Coordinate(5, 5)));
+    ensure(pointToLine.getCoordinates()[1].equals2D(Coordinate(5, 0)));
+
+    ensure_distance(IndexedHausdorffDistance::distance(*line, *pt), std::sqrt(50.0), 1e-12);
+}
+
+// 5 - Polygons are measured on their boundaries
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkDenseDistance("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (20 20, 20 80, 80 80, 80 20, 20 20))",
+                       "MULTILINESTRING ((10 -5, 90 5), (50 50, 60 90, 110 110))");
+    checkDenseDistance("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 25 10, 20 0)))",
+                       "POLYGON ((1 1, 28 1, 15 12, 1 1))");
+}
+
+// 6 - Tolerance and empty inputs
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto g1 = reader.read("LINESTRING (0 0, 100 0, 10 100, 10 100)");
+    auto g2 = reader.read("LINESTRING (0 100, 0 10, 80 10)");
+    double exact = IndexedHausdorffDistance::distance(*g1, *g2);
+    double coarse = IndexedHausdorffDistance::distance(*g1, *g2, 1.0);
+    ensure(coarse <= exact + 1e-9);
+    ensure(coarse >= exact - 1.0);
+
+    auto empty = reader.read("LINESTRING EMPTY");
+    ensure_equals(IndexedHausdorffDistance::distance(*g1, *empty), 0.0);
+    ensure_equals(IndexedHausdorffDistance::distance(*empty, *g1), 0.0);
+
+    IndexedHausdorffDistance dist(*g1, *g2);
+    try {
+        dist.setTolerance(-1);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,137 @@
+//
+// Test Suite for C-API per-context interruption
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_capicontextinterrupt_data {
+    GEOSContextHandle_t ctxt1;
+    GEOSContextHandle_t ctxt2;
+    GEOSGeometry* geom1;
+    GEOSGeometry* geom2;
+
+    static int
+    interruptNow(void* userData)
+    {
+        int* calls = static_cast<int*>(userData);
+        ++(*calls);
+        return 1;
+    }
+
+    static int
+    countCalls(void* userData)
+    {
+        int* calls = static_cast<int*>(userData);
+        ++(*calls);
+        return 0;
+    }
+
+    test_capicontextinterrupt_data()
+    {
+        ctxt1 = GEOS_init_r();
+        ctxt2 = GEOS_init_r();
+        geom1 = GEOSGeomFromWKT_r(ctxt1, "LINESTRING(0 0, 1 0)");
+        geom2 = GEOSGeomFromWKT_r(ctxt2, "LINESTRING(0 0, 1 0)");
+    }
+
+    ~test_capicontextinterrupt_data()
+    {
+        GEOSGeom_destroy_r(ctxt1, geom1);
+        GEOSGeom_destroy_r(ctxt2, geom2);
+        GEOS_finish_r(ctxt1);
+        GEOS_finish_r(ctxt2);
+    }
+};
+
+typedef test_group<test_capicontextinterrupt_data> group;
+typedef group::object object;
+
+group test_capicontextinterrupt_group("capi::GEOSContextInterrupt");
+
+//
+// Test Cases
+//
+
+// Callback only applies to its own context
+template<>
+template<>
+void object::test<1>
+()
+{
+    int calls1 = 0;
+    int calls2 = 0;
+    ensure(GEOSContext_setInterruptCallback_r(ctxt1, interruptNow, &calls1) == nullptr);
+    ensure(GEOSContext_setInterruptCallback_r(ctxt2, countCalls, &calls2) == nullptr);
+
+    GEOSGeometry* buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure("GEOSBuffer wasn't interrupted", buf1 == nullptr);
+    ensure_equals(calls1, 1);
+
+    GEOSGeometry* buf2 = GEOSBuffer_r(ctxt2, geom2, 1, 8);
+    ensure("GEOSBuffer was interrupted", buf2 != nullptr);
+    ensure(calls2 > 0);
+    GEOSGeom_destroy_r(ctxt2, buf2);
+
+    ensure(GEOSContext_setInterruptCallback_r(ctxt1, nullptr, nullptr) == interruptNow);
+    buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure(buf1 != nullptr);
+    GEOSGeom_destroy_r(ctxt1, buf1);
+}
+
+// Requests only apply to their own context, and are cleared once processed
+template<>
+template<>
+void object::test<2>
+()
+{
+    GEOSContext_interruptRequest_r(ctxt1);
+
+    GEOSGeometry* buf2 = GEOSBuffer_r(ctxt2, geom2, 1, 8);
+    ensure(buf2 != nullptr);
+    GEOSGeom_destroy_r(ctxt2, buf2);
+
+    GEOSGeometry* buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure("GEOSBuffer wasn't interrupted", buf1 == nullptr);
+
+    buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure(buf1 != nullptr);
+    GEOSGeom_destroy_r(ctxt1, buf1);
+
+    GEOSContext_interruptRequest_r(ctxt1);
+    GEOSContext_interruptCancel_r(ctxt1);
+    buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure(buf1 != nullptr);
+    GEOSGeom_destroy_r(ctxt1, buf1);
+}
+
+// Timeouts are measured per operation
+template<>
+template<>
+void object::test<3>
+()
+{
+    GEOSContext_setTimeout_r(ctxt1, 1e-9);
+    GEOSGeometry* buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure("GEOSBuffer wasn't interrupted", buf1 == nullptr);
+
+    GEOSContext_setTimeout_r(ctxt1, 3600);
+    buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure(buf1 != nullptr);
+    GEOSGeom_destroy_r(ctxt1, buf1);
+
+    GEOSContext_setTimeout_r(ctxt1, 0);
+    buf1 = GEOSBuffer_r(ctxt1, geom1, 1, 8);
+    ensure(buf1 != nullptr);
+    GEOSGeom_destroy_r(ctxt1, buf1);
+}
+
+} // namespace tut
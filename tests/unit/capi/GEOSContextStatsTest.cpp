@@ -0,0 +1,100 @@
+//
+// Test Suite for C-API operation statistics
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_capicontextstats_data {
+    GEOSContextHandle_t ctxt;
+    GEOSGeometry* geom1;
+    GEOSGeometry* geom2;
+
+    test_capicontextstats_data()
+    {
+        ctxt = GEOS_init_r();
+        geom1 = GEOSGeomFromWKT_r(ctxt, "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+        geom2 = GEOSGeomFromWKT_r(ctxt, "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    }
+
+    ~test_capicontextstats_data()
+    {
+        GEOSGeom_destroy_r(ctxt, geom1);
+        GEOSGeom_destroy_r(ctxt, geom2);
+        GEOS_finish_r(ctxt);
+    }
+
+    double
+    stat(int which, int cumulative)
+    {
+        double value = -1;
+        ensure_equals(GEOSContext_getStat_r(ctxt, which, cumulative, &value), 1);
+        return value;
+    }
+};
+
+typedef test_group<test_capicontextstats_data> group;
+typedef group::object object;
+
+group test_capicontextstats_group("capi::GEOSContextStats");
+
+//
+// Test Cases
+//
+
+// Statistics are disabled by default
+template<>
+template<>
+void object::test<1>
+()
+{
+    GEOSGeometry* result = GEOSIntersection_r(ctxt, geom1, geom2);
+    ensure(result != nullptr);
+    GEOSGeom_destroy_r(ctxt, result);
+
+    ensure_equals(stat(GEOS_STAT_SEGMENTS_NODED, 0), 0.0);
+    ensure_equals(stat(GEOS_STAT_TIME_NODING, 1), 0.0);
+}
+
+// Last and cumulative statistics, surviving calls that record nothing
+template<>
+template<>
+void object::test<2>
+()
+{
+    GEOSContext_setStatsEnabled_r(ctxt, 1);
+
+    for(int i = 0; i < 2; i++) {
+        GEOSGeometry* result = GEOSIntersection_r(ctxt, geom1, geom2);
+        ensure(result != nullptr);
+        GEOSGeom_destroy_r(ctxt, result);
+    }
+
+    ensure_equals(stat(GEOS_STAT_SEGMENTS_NODED, 0), 8.0);
+    ensure_equals(stat(GEOS_STAT_SEGMENTS_NODED, 1), 16.0);
+    ensure_equals(stat(GEOS_STAT_INTERSECTIONS_FOUND, 0), 2.0);
+    ensure(stat(GEOS_STAT_TIME_NODING, 0) > 0);
+    ensure(stat(GEOS_STAT_TIME_NODING, 1) >= stat(GEOS_STAT_TIME_NODING, 0));
+
+    GEOSContext_resetStats_r(ctxt);
+    ensure_equals(stat(GEOS_STAT_SEGMENTS_NODED, 0), 0.0);
+    ensure_equals(stat(GEOS_STAT_SEGMENTS_NODED, 1), 0.0);
+}
+
+// Unknown statistics are reported as errors
+template<>
+template<>
+void object::test<3>
+()
+{
+    double value = 0;
+    ensure_equals(GEOSContext_getStat_r(ctxt, 42, 0, &value), 0);
+    ensure_equals(GEOSContext_getStat_r(ctxt, -1, 1, &value), 0);
+}
+
+} // namespace tut
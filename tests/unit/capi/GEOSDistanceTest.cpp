@@ -150,5 +150,22 @@ void object::test<3>
     GEOSGeom_destroy(g2);
 }
 
+// 4 - GEOSDistanceWithin
+template<>
+template<>
+void object::test<4>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (13 0, 13 10)");
+    geom3_ = GEOSGeomFromWKT("POINT (5 5)");
+
+    ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 3), 1);
+    ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 2.9), 0);
+    ensure_equals(GEOSDistanceWithin(geom2_, geom1_, 3), 1);
+    ensure_equals(GEOSDistanceWithin(geom1_, geom3_, 0), 1);
+    ensure_equals(GEOSDistanceWithin(geom3_, geom2_, 7.9), 0);
+}
+
 } // namespace tut
 
@@ -97,4 +97,18 @@ void object::test<2>
     ensure_distance(dist, 50., 1e-12);
 }
 
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 100 0)");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (0 0, 50 50, 100 0)");
+    geom3_ = GEOSGeomFromWKT("LINESTRING EMPTY");
+
+    ensure_equals(GEOSFrechetDistanceWithin(geom1_, geom2_, 71), 1);
+    ensure_equals(GEOSFrechetDistanceWithin(geom1_, geom2_, 70), 0);
+    ensure_equals(GEOSFrechetDistanceWithin(geom1_, geom3_, 70), 2);
+}
+
 } // namespace tut
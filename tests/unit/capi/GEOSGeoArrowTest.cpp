@@ -0,0 +1,111 @@
+//
+// Test Suite for C-API GEOSGeom_createFromGeoArrow and GEOSGeom_toGeoArrow
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_capigeoarrow_data : public capitest::utility {};
+
+typedef test_group<test_capigeoarrow_data> group;
+typedef group::object object;
+
+group test_capigeoarrow_group("capi::GEOSGeoArrow");
+
+//
+// Test Cases
+//
+
+// Read polygons from interleaved buffers
+template<>
+template<>
+void object::test<1>
+()
+{
+    double xy[] = {
+        0, 0, 10, 0, 10, 10, 0, 10, 0, 0,
+        1, 1, 1, 2, 2, 2, 1, 1,
+        20, 20, 30, 20, 30, 30, 20, 20
+    };
+    int geomOffsets[] = { 0, 2, 3 };
+    int ringOffsets[] = { 0, 5, 9, 13 };
+    GEOSGeometry* geoms[2];
+
+    int ret = GEOSGeom_createFromGeoArrow(GEOS_POLYGON, 0, xy, xy + 1, nullptr, 2, 13,
+                                          geomOffsets, nullptr, ringOffsets, 2, geoms);
+    ensure_equals(ret, 1);
+
+    ensure_geometry_equals(geoms[0], "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 1 2, 2 2, 1 1))");
+    ensure_geometry_equals(geoms[1], "POLYGON ((20 20, 30 20, 30 30, 20 20))");
+
+    GEOSGeom_destroy(geoms[0]);
+    GEOSGeom_destroy(geoms[1]);
+}
+
+// Inconsistent buffers report an error
+template<>
+template<>
+void object::test<2>
+()
+{
+    double xy[] = { 0, 0, 1, 1 };
+    int geomOffsets[] = { 0, 5 };
+    GEOSGeometry* geoms[1];
+
+    int ret = GEOSGeom_createFromGeoArrow(GEOS_LINESTRING, 0, xy, xy + 1, nullptr, 2, 2,
+                                          geomOffsets, nullptr, nullptr, 1, geoms);
+    ensure_equals(ret, 0);
+}
+
+// Round trip through GEOSGeom_toGeoArrow
+template<>
+template<>
+void object::test<3>
+()
+{
+    GEOSGeometry* input[2];
+    input[0] = GEOSGeomFromWKT("MULTILINESTRING ((0 0, 1 1), (2 2, 3 3, 4 4))");
+    input[1] = GEOSGeomFromWKT("LINESTRING (5 5, 6 6)");
+
+    int type;
+    double* coords;
+    unsigned int ncoords;
+    int* geomOffsets;
+    int* partOffsets;
+    int* ringOffsets;
+
+    int ret = GEOSGeom_toGeoArrow(input, 2, 0, &type, &coords, &ncoords,
+                                  &geomOffsets, &partOffsets, &ringOffsets);
+    ensure_equals(ret, 1);
+    ensure_equals(type, GEOS_MULTILINESTRING);
+    ensure_equals(ncoords, 7u);
+    ensure(ringOffsets == nullptr);
+    ensure_equals(geomOffsets[2], 3);
+    ensure_equals(partOffsets[3], 7);
+
+    GEOSGeometry* output[2];
+    ret = GEOSGeom_createFromGeoArrow(type, 0, coords, coords + 1, nullptr, 2, ncoords,
+                                      geomOffsets, partOffsets, ringOffsets, 2, output);
+    ensure_equals(ret, 1);
+
+    ensure_geometry_equals(output[0], input[0]);
+    ensure_geometry_equals(output[1], "MULTILINESTRING ((5 5, 6 6))");
+
+    GEOSFree(coords);
+    GEOSFree(geomOffsets);
+    GEOSFree(partOffsets);
+    for(int i = 0; i < 2; i++) {
+        GEOSGeom_destroy(input[i]);
+        GEOSGeom_destroy(output[i]);
+    }
+}
+
+} // namespace tut
+
@@ -163,5 +163,30 @@ void object::test<5>
     ensure_equals(toWKT(geom3_), "LINESTRING (0 0, 0 0)");
 }
 
+// Reduce the precision of a layer, keeping shared edges shared
+template<>
+template<>
+void object::test<6>
+()
+{
+    geom1_ = fromWKT("POLYGON ((0 0, 10 0, 10 12.6, 0 10, 0 0))");
+    geom2_ = fromWKT("POLYGON ((0 10, 10 12.6, 10 20, 5.3 11.45, 0 20, 0 10))");
+
+    const GEOSGeometry* layer[] = { geom1_, geom2_ };
+    GEOSGeometry* results[2];
+    ensure_equals(GEOSGeom_setPrecisionLayer(layer, 2, 1.0, 2, results), 1);
+
+    ensure_geometry_equals(results[0], "POLYGON ((0 0, 10 0, 10 13, 5 11, 0 10, 0 0))");
+    ensure_equals(GEOSGeom_getPrecision(results[0]), 1.0);
+    geom3_ = GEOSIntersection(results[0], results[1]);
+    ensure(geom3_ != 0);
+    double area;
+    ensure_equals(GEOSArea(geom3_, &area), 1);
+    ensure_equals(area, 0.0);
+
+    GEOSGeom_destroy(results[0]);
+    GEOSGeom_destroy(results[1]);
+}
+
 } // namespace tut
 
@@ -66,5 +66,21 @@ void object::test<1>
     GEOSGeom_destroy(expected);
 }
 
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto input = GEOSGeomFromWKT("MULTILINESTRING((0 0, 0 100),(0 -5, 0 0),(0 100, 10 100),(20 100, 10 100))");
+    auto result = GEOSLineMergeDirected(input);
+    auto expected = GEOSGeomFromWKT("MULTILINESTRING((0 -5, 0 0, 0 100, 10 100),(20 100, 10 100))");
+
+    ensure(GEOSEqualsExact(result, expected, 0));
+
+    GEOSGeom_destroy(input);
+    GEOSGeom_destroy(result);
+    GEOSGeom_destroy(expected);
+}
+
 } // namespace tut
 
@@ -100,8 +100,28 @@ void object::test<2>
     ensure(GEOSEqualsExact(geom2_, expect_, 0.01));
 }
 
-
-
-
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((2 2, 8 2, 8 8, 2 8, 2 2)))");
+
+    GEOSMakeValidParams* params = GEOSMakeValidParams_create();
+    ensure_equals(GEOSMakeValidParams_setMethod(params, GEOS_MAKE_VALID_EVEN_ODD), 1);
+    geom2_ = GEOSMakeValidWithParams(geom1_, params);
+    expect_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))");
+    ensure_equals(GEOSEquals(geom2_, expect_), 1);
+    GEOSGeom_destroy(geom2_);
+    GEOSGeom_destroy(expect_);
+
+    ensure_equals(GEOSMakeValidParams_setMethod(params, GEOS_MAKE_VALID_WINDING), 1);
+    geom2_ = GEOSMakeValidWithParams(geom1_, params);
+    expect_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    ensure_equals(GEOSEquals(geom2_, expect_), 1);
+
+    ensure_equals(GEOSMakeValidParams_setMethod(params, 3), 0);
+    GEOSMakeValidParams_destroy(params);
+}
 
 } // namespace tut
@@ -102,5 +102,52 @@ void object::test<2>
 }
 
 
-} // namespace tut
+// Batch of polygons
+template<>
+template<>
+void object::test<3>
+()
+{
+    GEOSGeometry* geoms[2];
+    geoms[0] = GEOSGeomFromWKT("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))");
+    geoms[1] = GEOSGeomFromWKT("POLYGON ((0 0, 40 0, 40 20, 0 20, 0 0))");
+
+    double x[2], y[2], radius[2];
+    int ret = GEOSMaximumInscribedCircles(geoms, 2, 0.001, 1, x, y, radius);
+    ensure_equals(ret, 1);
+    ensure_distance(x[0], 150.0, 0.001);
+    ensure_distance(y[0], 150.0, 0.001);
+    ensure_distance(radius[0], 50.0, 0.001);
+    ensure_distance(y[1], 10.0, 0.001);
+    ensure_distance(radius[1], 10.0, 0.001);
+
+    GEOSGeom_destroy(geoms[0]);
+    GEOSGeom_destroy(geoms[1]);
+}
+
+// Batch of polygons over several threads
+template<>
+template<>
+void object::test<4>
+()
+{
+    GEOSGeometry* geoms[3];
+    geoms[0] = GEOSGeomFromWKT("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))");
+    geoms[1] = GEOSGeomFromWKT("POLYGON ((0 0, 40 0, 40 20, 0 20, 0 0))");
+    geoms[2] = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+
+    double x[3], y[3], radius[3];
+    int ret = GEOSMaximumInscribedCircles(geoms, 3, 0.001, 0, x, y, radius);
+    ensure_equals(ret, 1);
+    ensure_distance(x[0], 150.0, 0.001);
+    ensure_distance(radius[0], 50.0, 0.001);
+    ensure_distance(radius[1], 10.0, 0.001);
+    ensure_distance(x[2], 5.0, 0.001);
+    ensure_distance(radius[2], 5.0, 0.001);
+
+    for (GEOSGeometry* g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+}
 
+} // namespace tut
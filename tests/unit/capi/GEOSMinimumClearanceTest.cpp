@@ -75,6 +75,11 @@ struct test_capigeosminimumclearance_data {
         ensure(result != nullptr);
         ensure_equals(1, GEOSEquals(result, expected_result));
 
+        ensure_equals(GEOSMinimumClearanceAtLeast(input, d), 1);
+        if(d != std::numeric_limits<double>::infinity()) {
+            ensure_equals(GEOSMinimumClearanceAtLeast(input, d * 1.000001), 0);
+        }
+
         GEOSGeom_destroy(input);
         GEOSGeom_destroy(expected_result);
         GEOSGeom_destroy(result);
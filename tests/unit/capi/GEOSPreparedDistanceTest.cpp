@@ -8,6 +8,7 @@
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
+#include <limits>
 
 namespace tut {
 //
@@ -177,5 +178,107 @@ void object::test<8>
     );
 }
 
+// Distances and within distance tests of point arrays
+template<>
+template<>
+void object::test<9>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    pgeom1_ = GEOSPrepare(geom1_);
+
+    double x[] = { 5, 15, 10, -3, 5 };
+    double y[] = { 5, 5, 10, -4, 12 };
+    double expected[] = { 0, 5, 0, 5, 2 };
+    double distances[5];
+    ensure_equals(GEOSPreparedDistancePoints(pgeom1_, x, y, 5, distances), 1);
+    for(int i = 0; i < 5; i++) {
+        ensure_distance(distances[i], expected[i], 1e-12);
+    }
+
+    char results[5];
+    ensure_equals(GEOSPreparedDistanceWithinPoints(pgeom1_, x, y, 5, 2.5, results), 1);
+    ensure_equals(results[0], 1);
+    ensure_equals(results[1], 0);
+    ensure_equals(results[2], 1);
+    ensure_equals(results[3], 0);
+    ensure_equals(results[4], 1);
+}
+
+template<>
+template<>
+void object::test<10>
+()
+{
+    double x[] = { 0, 3 };
+    double y[] = { 1, 4 };
+    double distances[2];
+    char results[2];
+
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 10 0)");
+    pgeom1_ = GEOSPrepare(geom1_);
+    ensure_equals(GEOSPreparedDistancePoints(pgeom1_, x, y, 2, distances), 1);
+    ensure_distance(distances[0], 1.0, 1e-12);
+    ensure_distance(distances[1], 4.0, 1e-12);
+    ensure_equals(GEOSPreparedDistanceWithinPoints(pgeom1_, x, y, 2, 1, results), 1);
+    ensure_equals(results[0], 1);
+    ensure_equals(results[1], 0);
+    GEOSPreparedGeom_destroy(pgeom1_);
+    GEOSGeom_destroy(geom1_);
+
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT ((0 0), (3 0))");
+    pgeom1_ = GEOSPrepare(geom1_);
+    ensure_equals(GEOSPreparedDistancePoints(pgeom1_, x, y, 2, distances), 1);
+    ensure_distance(distances[0], 1.0, 1e-12);
+    ensure_distance(distances[1], 4.0, 1e-12);
+    ensure_equals(GEOSPreparedDistanceWithinPoints(pgeom1_, x, y, 2, 4, results), 1);
+    ensure_equals(results[0], 1);
+    ensure_equals(results[1], 1);
+    GEOSPreparedGeom_destroy(pgeom1_);
+    GEOSGeom_destroy(geom1_);
+
+    geom1_ = GEOSGeomFromWKT("LINESTRING EMPTY");
+    pgeom1_ = GEOSPrepare(geom1_);
+    ensure_equals(GEOSPreparedDistancePoints(pgeom1_, x, y, 2, distances), 1);
+    ensure_equals(distances[0], std::numeric_limits<double>::infinity());
+    ensure_equals(GEOSPreparedDistanceWithinPoints(pgeom1_, x, y, 2, 4, results), 1);
+    ensure_equals(results[0], 0);
+}
+
+// 11 - GEOSPreparedDistanceWithin
+template<>
+template<>
+void object::test<11>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (13 0, 13 10)");
+    pgeom1_ = GEOSPrepare(geom1_);
+
+    ensure_equals(GEOSPreparedDistanceWithin(pgeom1_, geom2_, 3), 1);
+    ensure_equals(GEOSPreparedDistanceWithin(pgeom1_, geom2_, 2.9), 0);
+    GEOSGeom_destroy(geom2_);
+
+    // contained in the polygon
+    geom2_ = GEOSGeomFromWKT("LINESTRING (2 2, 8 8)");
+    ensure_equals(GEOSPreparedDistanceWithin(pgeom1_, geom2_, 0), 1);
+    GEOSGeom_destroy(geom2_);
+
+    geom2_ = GEOSGeomFromWKT("POINT EMPTY");
+    ensure_equals(GEOSPreparedDistanceWithin(pgeom1_, geom2_, 100), 0);
+    GEOSPreparedGeom_destroy(pgeom1_);
+    GEOSGeom_destroy(geom1_);
+
+    // a line contained in a polygon
+    geom1_ = GEOSGeomFromWKT("LINESTRING (2 2, 8 8)");
+    pgeom1_ = GEOSPrepare(geom1_);
+    geom2_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    ensure_equals(GEOSPreparedDistanceWithin(pgeom1_, geom2_, 0), 1);
+    GEOSGeom_destroy(geom2_);
+    geom2_ = GEOSGeomFromWKT("MULTIPOINT ((2 5), (8 3))");
+    ensure_equals(GEOSPreparedDistanceWithin(pgeom1_, geom2_, 2.2), 1);
+    ensure_equals(GEOSPreparedDistanceWithin(pgeom1_, geom2_, 2.1), 0);
+}
+
 } // namespace tut
 
@@ -74,5 +74,96 @@ void object::test<1>
     ensure(0 != GEOSisEmpty(geom2_));
 }
 
+// Test GEOSSimplifyVW
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTILINESTRING ((0 0, 50 10, 100 0), (40 3, 60 3))");
+
+    geom2_ = GEOSSimplifyVW(geom1_, 30.0, 0, 1);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSGetNumCoordinates(geom2_), 5);
+    GEOSGeom_destroy(geom2_);
+
+    geom2_ = GEOSSimplifyVW(geom1_, 30.0, 0, 0);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSGetNumCoordinates(geom2_), 4);
+    GEOSGeom_destroy(geom2_);
+
+    geom2_ = GEOSSimplifyVW(geom1_, 0.0, 4, 0);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSGetNumCoordinates(geom2_), 4);
+    GEOSGeom_destroy(geom2_);
+
+    geom2_ = GEOSSimplifyVW(geom1_, -1.0, 0, 0);
+    ensure(geom2_ == nullptr);
+}
+
+// Test GEOSCoverageSimplify
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("GEOMETRYCOLLECTION (POLYGON ((0 0, 10 0, 10.1 5, 10 10, 0 10, 0 0)), POLYGON ((10 0, 20 0, 20 10, 10 10, 10.1 5, 10 0)))");
+
+    geom2_ = GEOSCoverageSimplify(geom1_, 1.0, 2);
+    ensure(geom2_ != nullptr);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_GEOMETRYCOLLECTION);
+    ensure_equals(GEOSGetNumCoordinates(geom2_), 10);
+
+    GEOSGeometry* expected = GEOSGeomFromWKT("POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))");
+    ensure(GEOSEquals(GEOSGetGeometryN(geom2_, 1), expected) == 1);
+    GEOSGeom_destroy(expected);
+}
+
+// Test GEOSSimplifyLevels
+template<>
+template<>
+void object::test<4>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)");
+    GEOSSetSRID(geom1_, 4326);
+
+    double tolerances[] = { 0.0, 1.0, 10.0 };
+    GEOSGeometry* results[3];
+    ensure_equals(GEOSSimplifyLevels(geom1_, tolerances, 3, GEOS_SIMPLIFY_DOUGLAS_PEUCKER, results), 1);
+    ensure_equals(GEOSGetNumCoordinates(results[0]), 5);
+    ensure_equals(GEOSGetNumCoordinates(results[1]), 4);
+    ensure_equals(GEOSGetNumCoordinates(results[2]), 2);
+    ensure_equals(GEOSGetSRID(results[1]), 4326);
+    for(GEOSGeometry* g : results) {
+        GEOSGeom_destroy(g);
+    }
+
+    ensure_equals(GEOSSimplifyLevels(geom1_, tolerances, 3, GEOS_SIMPLIFY_VISVALINGAM_WHYATT, results), 1);
+    geom2_ = GEOSSimplifyVW(geom1_, 1.0, 0, 0);
+    ensure(GEOSEqualsExact(results[1], geom2_, 0) == 1);
+    for(GEOSGeometry* g : results) {
+        GEOSGeom_destroy(g);
+    }
+
+    tolerances[2] = -1.0;
+    ensure_equals(GEOSSimplifyLevels(geom1_, tolerances, 3, GEOS_SIMPLIFY_DOUGLAS_PEUCKER, results), 0);
+}
+
+// GEOSSimplifyLevels rejects an unknown method
+template<>
+template<>
+void object::test<5>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)");
+
+    double tolerances[] = { 1.0 };
+    GEOSGeometry* results[1] = { nullptr };
+    ensure_equals(GEOSSimplifyLevels(geom1_, tolerances, 1, 2, results), 0);
+    ensure_equals(GEOSSimplifyLevels(geom1_, tolerances, 1, -1, results), 0);
+    ensure(results[0] == nullptr);
+}
+
 } // namespace tut
 
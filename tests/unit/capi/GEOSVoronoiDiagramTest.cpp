@@ -195,5 +195,25 @@ void object::test<7>
     geom2_ = GEOSVoronoiDiagram(geom1_, nullptr, 0, 1);
 }
 
-} // namespace tut
+// Cells in the order of the input sites
+template<>
+template<>
+void object::test<8>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT ((240 310), (123 245), (260 260), (123 245), (180 210))");
+    geom2_ = GEOSVoronoiDiagram(geom1_, nullptr, 0, GEOS_VORONOI_PRESERVE_ORDER);
+    ensure_equals(GEOSGetNumGeometries(geom2_), 4);
+
+    const int sites[] = { 0, 1, 2, 4 };
+    for(int i = 0; i < 4; i++) {
+        const GEOSGeometry* cell = GEOSGetGeometryN(geom2_, i);
+        ensure_equals(GEOSContains(cell, GEOSGetGeometryN(geom1_, sites[i])), 1);
+    }
 
+    GEOSGeom_destroy(geom2_);
+    geom2_ = GEOSVoronoiDiagram(geom1_, nullptr, 0, GEOS_VORONOI_ONLY_EDGES | GEOS_VORONOI_PRESERVE_ORDER);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_MULTILINESTRING);
+}
+
+} // namespace tut
@@ -6,6 +6,7 @@
 #include <geos_c.h>
 // std
 #include <cctype>
+#include <cmath>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
@@ -174,5 +175,36 @@ void object::test<6>
     ensure_equals(r, 0); // invalid
 }
 
+// Batch validation
+template<>
+template<>
+void object::test<7>
+()
+{
+    GEOSGeometry* geoms[3];
+    geoms[0] = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    geoms[1] = GEOSGeomFromWKT("POLYGON ((0 0, 10 10, 10 0, 0 10, 0 0))");
+    geoms[2] = GEOSGeomFromWKT("POLYGON((0 1, -10 10, 10 10, 0 1, 4 6, -4 6, 0 1))");
+
+    int errors[3];
+    double x[3];
+    double y[3];
+    ensure_equals(GEOSisValidBatch(geoms, 3, 0, 2, errors, x, y), 1);
+    ensure_equals(errors[0], GEOSVALID_NO_ERROR);
+    ensure(std::isnan(x[0]) && std::isnan(y[0]));
+    ensure_equals(errors[1], GEOSVALID_SELF_INTERSECTION);
+    ensure_equals(x[1], 5.0);
+    ensure_equals(y[1], 5.0);
+    ensure_equals(errors[2], GEOSVALID_RING_SELF_INTERSECTION);
+
+    ensure_equals(GEOSisValidBatch(geoms, 3, GEOSVALID_ALLOW_SELFTOUCHING_RING_FORMING_HOLE, 0,
+                                   errors, nullptr, nullptr), 1);
+    ensure_equals(errors[2], GEOSVALID_NO_ERROR);
+
+    for(GEOSGeometry* g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+}
+
 } // namespace tut
 
@@ -0,0 +1,133 @@
+//
+// Test Suite for geos::geom::CoordinateHashMap class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateHashMap.h>
+// std
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_coordinatehashmap_data {
+    typedef geos::geom::Coordinate Coordinate;
+    typedef geos::geom::CoordinateHashMap<int> Map;
+
+    test_coordinatehashmap_data() {}
+};
+
+typedef test_group<test_coordinatehashmap_data> group;
+typedef group::object object;
+
+group test_coordinatehashmap_group("geos::geom::CoordinateHashMap");
+
+//
+// Test Cases
+//
+
+// Insert, find and iteration in insertion order
+template<>
+template<>
+void object::test<1>
+()
+{
+    Map map;
+    ensure(map.empty());
+    ensure(map.find(Coordinate(0, 0)) == nullptr);
+
+    std::vector<Coordinate> pts;
+    for(int i = 0; i < 100; i++) {
+        pts.emplace_back(100 - i, i % 7, i);
+    }
+    for(int i = 0; i < 100; i++) {
+        auto inserted = map.insert(pts[i], i);
+        ensure(inserted.second);
+        ensure_equals(*inserted.first, i);
+    }
+    ensure_equals(map.size(), 100u);
+
+    // z is ignored, and the first value stays
+    auto inserted = map.insert(Coordinate(100, 0, 5), 1000);
+    ensure(!inserted.second);
+    ensure_equals(*inserted.first, 0);
+    ensure_equals(map.size(), 100u);
+
+    int i = 0;
+    for(const auto& entry : map) {
+        ensure(entry.first.equals3D(pts[i]));
+        ensure_equals(entry.second, i);
+        i++;
+    }
+
+    ensure(map.find(Coordinate(0.5, 0)) == nullptr);
+    map[Coordinate(0.5, 0)] = 7;
+    ensure_equals(*map.find(Coordinate(0.5, 0)), 7);
+
+    // -0.0 equals 0.0
+    map.insert(Coordinate(-0.0, 3), 8);
+    ensure(map.find(Coordinate(0.0, 3)) != nullptr);
+    ensure_equals(*map.find(Coordinate(0.0, 3)), 8);
+}
+
+// Erase matches std::map through random operations
+template<>
+template<>
+void object::test<2>
+()
+{
+    Map map;
+    std::map<Coordinate, int> expected;
+    std::mt19937 rng(42);
+    for(int i = 0; i < 20000; i++) {
+        Coordinate pt(static_cast<double>(rng() % 50), static_cast<double>(rng() % 50));
+        if(rng() % 3 == 0) {
+            ensure_equals(map.erase(pt), expected.erase(pt) == 1);
+        }
+        else {
+            ensure_equals(map.insert(pt, i).second, expected.emplace(pt, i).second);
+        }
+        if(i % 1000 == 0) {
+            map.reserve(map.size() + 500);
+        }
+    }
+    ensure_equals(map.size(), expected.size());
+    for(const auto& entry : expected) {
+        const int* value = map.find(entry.first);
+        ensure(value != nullptr);
+        ensure_equals(*value, entry.second);
+    }
+    for(const auto& entry : map) {
+        ensure(expected.count(entry.first) == 1);
+    }
+
+    map.clear();
+    ensure(map.empty());
+    ensure(map.find(Coordinate(1, 1)) == nullptr);
+    ensure(!map.erase(Coordinate(1, 1)));
+}
+
+// NaN coordinates equal nothing
+template<>
+template<>
+void object::test<3>
+()
+{
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    Map map;
+    ensure(map.insert(Coordinate(nan, nan), 1).second);
+    ensure(map.insert(Coordinate(nan, nan), 2).second);
+    ensure(map.find(Coordinate(nan, nan)) == nullptr);
+    ensure_equals(map.size(), 2u);
+}
+
+} // namespace tut
@@ -0,0 +1,221 @@
+//
+// Test Suite for geos::io::GeoArrowReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+// std
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geoarrowreader_data {
+    geos::io::GeoArrowReader reader;
+    geos::io::WKTReader wktreader;
+
+    typedef std::unique_ptr<geos::geom::Geometry> GeomPtr;
+
+    void
+    ensure_equals_wkt(const geos::geom::Geometry& g, const std::string& wkt)
+    {
+        GeomPtr expected(wktreader.read(wkt));
+        ensure_equals(g.toString(), expected->toString());
+        ensure_equals("dimension", g.getCoordinateDimension(), expected->getCoordinateDimension());
+    }
+
+    geos::io::GeoArrowBuffers
+    interleaved(geos::geom::GeometryTypeId type, const std::vector<double>& xy, std::size_t numGeoms)
+    {
+        geos::io::GeoArrowBuffers b;
+        b.type = type;
+        b.x = xy.data();
+        b.y = xy.data() + 1;
+        b.stride = 2;
+        b.numCoords = xy.size() / 2;
+        b.numGeoms = numGeoms;
+        return b;
+    }
+};
+
+typedef test_group<test_geoarrowreader_data> group;
+typedef group::object object;
+
+group test_geoarrowreader_group("geos::io::GeoArrowReader");
+
+//
+// Test Cases
+//
+
+// Points from separated buffers, including an empty point
+template<>
+template<>
+void object::test<1>
+()
+{
+    double nan = std::nan("");
+    std::vector<double> x{ 1, nan, 5 };
+    std::vector<double> y{ 2, nan, 6 };
+
+    geos::io::GeoArrowBuffers b;
+    b.type = geos::geom::GEOS_POINT;
+    b.x = x.data();
+    b.y = y.data();
+    b.stride = 1;
+    b.numCoords = 3;
+    b.numGeoms = 3;
+
+    auto geoms = reader.read(b);
+    ensure_equals(geoms.size(), 3u);
+    ensure_equals_wkt(*geoms[0], "POINT (1 2)");
+    ensure(geoms[1]->isEmpty());
+    ensure_equals_wkt(*geoms[2], "POINT (5 6)");
+}
+
+// Interleaved XYZ linestrings, including an empty one
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::vector<double> xyz{ 0, 0, 1, 1, 1, 2, 5, 5, 3, 6, 6, 4 };
+    std::vector<int32_t> geomOffsets{ 0, 2, 2, 4 };
+
+    geos::io::GeoArrowBuffers b;
+    b.type = geos::geom::GEOS_LINESTRING;
+    b.hasZ = true;
+    b.x = xyz.data();
+    b.y = xyz.data() + 1;
+    b.z = xyz.data() + 2;
+    b.stride = 3;
+    b.numCoords = 4;
+    b.geomOffsets = geomOffsets.data();
+    b.numGeoms = 3;
+
+    auto geoms = reader.read(b);
+    ensure_equals(geoms.size(), 3u);
+    ensure_equals_wkt(*geoms[0], "LINESTRING Z (0 0 1, 1 1 2)");
+    ensure(geoms[1]->isEmpty());
+    ensure_equals_wkt(*geoms[2], "LINESTRING Z (5 5 3, 6 6 4)");
+}
+
+// Polygon with a hole
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::vector<double> xy{
+        0, 0, 10, 0, 10, 10, 0, 10, 0, 0,
+        1, 1, 1, 2, 2, 2, 1, 1
+    };
+    std::vector<int32_t> geomOffsets{ 0, 2 };
+    std::vector<int32_t> ringOffsets{ 0, 5, 9 };
+
+    auto b = interleaved(geos::geom::GEOS_POLYGON, xy, 1);
+    b.geomOffsets = geomOffsets.data();
+    b.ringOffsets = ringOffsets.data();
+
+    auto geoms = reader.read(b);
+    ensure_equals(geoms.size(), 1u);
+    ensure_equals_wkt(*geoms[0], "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 1 2, 2 2, 1 1))");
+}
+
+// MultiPoint and MultiLineString
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::vector<double> xy{ 0, 0, 1, 1, 2, 2, 3, 3 };
+
+    std::vector<int32_t> mpOffsets{ 0, 3, 4 };
+    auto mp = interleaved(geos::geom::GEOS_MULTIPOINT, xy, 2);
+    mp.geomOffsets = mpOffsets.data();
+
+    auto points = reader.read(mp);
+    ensure_equals_wkt(*points[0], "MULTIPOINT ((0 0), (1 1), (2 2))");
+    ensure_equals_wkt(*points[1], "MULTIPOINT ((3 3))");
+
+    std::vector<int32_t> mlGeomOffsets{ 0, 2 };
+    std::vector<int32_t> mlPartOffsets{ 0, 2, 4 };
+    auto ml = interleaved(geos::geom::GEOS_MULTILINESTRING, xy, 1);
+    ml.geomOffsets = mlGeomOffsets.data();
+    ml.partOffsets = mlPartOffsets.data();
+
+    auto lines = reader.read(ml);
+    ensure_equals_wkt(*lines[0], "MULTILINESTRING ((0 0, 1 1), (2 2, 3 3))");
+}
+
+// MultiPolygon with an empty row
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::vector<double> xy{
+        0, 0, 1, 0, 1, 1, 0, 0,
+        5, 5, 6, 5, 6, 6, 5, 5
+    };
+    std::vector<int32_t> geomOffsets{ 0, 2, 2 };
+    std::vector<int32_t> partOffsets{ 0, 1, 2 };
+    std::vector<int32_t> ringOffsets{ 0, 4, 8 };
+
+    auto b = interleaved(geos::geom::GEOS_MULTIPOLYGON, xy, 2);
+    b.geomOffsets = geomOffsets.data();
+    b.partOffsets = partOffsets.data();
+    b.ringOffsets = ringOffsets.data();
+
+    auto geoms = reader.read(b);
+    ensure_equals(geoms.size(), 2u);
+    ensure_equals_wkt(*geoms[0], "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5)))");
+    ensure(geoms[1]->isEmpty());
+    ensure_equals(geoms[1]->getGeometryTypeId(), geos::geom::GEOS_MULTIPOLYGON);
+}
+
+// Inconsistent offsets are rejected
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::vector<double> xy{ 0, 0, 1, 1 };
+    std::vector<int32_t> tooFar{ 0, 3 };
+    std::vector<int32_t> decreasing{ 0, 2, 1 };
+
+    auto b = interleaved(geos::geom::GEOS_LINESTRING, xy, 1);
+    b.geomOffsets = tooFar.data();
+    try {
+        reader.read(b);
+        fail("Expected ParseException for out of range offset");
+    }
+    catch(const geos::io::ParseException&) {}
+
+    b.geomOffsets = decreasing.data();
+    b.numGeoms = 2;
+    try {
+        reader.read(b);
+        fail("Expected ParseException for decreasing offsets");
+    }
+    catch(const geos::io::ParseException&) {}
+
+    b.geomOffsets = nullptr;
+    try {
+        reader.read(b);
+        fail("Expected ParseException for missing offsets");
+    }
+    catch(const geos::io::ParseException&) {}
+}
+
+} // namespace tut
+
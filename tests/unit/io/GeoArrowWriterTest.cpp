@@ -0,0 +1,152 @@
+//
+// Test Suite for geos::io::GeoArrowWriter
+// Uses geos::io::GeoArrowReader to check round trips.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/GeoArrowWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geoarrowwriter_data {
+    geos::io::WKTReader wktreader;
+    geos::io::GeoArrowReader reader;
+
+    typedef std::unique_ptr<geos::geom::Geometry> GeomPtr;
+
+    std::vector<GeomPtr>
+    readAll(const std::vector<std::string>& wkts)
+    {
+        std::vector<GeomPtr> geoms;
+        for(const auto& wkt : wkts) {
+            geoms.push_back(wktreader.read(wkt));
+        }
+        return geoms;
+    }
+
+    void
+    checkRoundTrip(const std::vector<std::string>& wkts,
+                   geos::geom::GeometryTypeId expectedType,
+                   int dims, bool interleaved)
+    {
+        auto input = readAll(wkts);
+        std::vector<const geos::geom::Geometry*> ptrs;
+        for(const auto& g : input) {
+            ptrs.push_back(g.get());
+        }
+
+        geos::io::GeoArrowWriter writer(dims, interleaved);
+        auto arr = writer.write(ptrs);
+        ensure_equals("column type", arr.type, expectedType);
+        ensure_equals("number of geometries", arr.numGeoms, input.size());
+
+        auto output = reader.read(arr.buffers());
+        ensure_equals(output.size(), input.size());
+        for(std::size_t i = 0; i < input.size(); i++) {
+            ensure(output[i]->toString() + " != " + input[i]->toString(),
+                   output[i]->equalsExact(input[i].get()) ||
+                   (output[i]->isEmpty() && input[i]->isEmpty()));
+        }
+    }
+};
+
+typedef test_group<test_geoarrowwriter_data> group;
+typedef group::object object;
+
+group test_geoarrowwriter_group("geos::io::GeoArrowWriter");
+
+//
+// Test Cases
+//
+
+// Points
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkRoundTrip({ "POINT (1 2)", "POINT EMPTY", "POINT (3 4)" },
+                   geos::geom::GEOS_POINT, 2, true);
+    checkRoundTrip({ "POINT (1 2)", "POINT EMPTY", "POINT (3 4)" },
+                   geos::geom::GEOS_POINT, 2, false);
+}
+
+// LineStrings with Z, interleaved and separated
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::vector<std::string> wkts{ "LINESTRING Z (0 0 1, 1 1 2, 2 0 3)", "LINESTRING EMPTY" };
+    checkRoundTrip(wkts, geos::geom::GEOS_LINESTRING, 3, true);
+    checkRoundTrip(wkts, geos::geom::GEOS_LINESTRING, 3, false);
+}
+
+// Polygons
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkRoundTrip({
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 1 2, 2 2, 1 1))",
+        "POLYGON EMPTY",
+        "POLYGON ((20 20, 30 20, 30 30, 20 20))"
+    }, geos::geom::GEOS_POLYGON, 2, true);
+}
+
+// Single geometries are promoted in a multi column
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkRoundTrip({
+        "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5), (5.1 5.1, 5.2 5.1, 5.2 5.2, 5.1 5.1)))",
+        "MULTIPOLYGON EMPTY"
+    }, geos::geom::GEOS_MULTIPOLYGON, 2, true);
+
+    checkRoundTrip({
+        "MULTILINESTRING ((0 0, 1 1), (2 2, 3 3))",
+        "MULTILINESTRING ((4 4, 5 5))"
+    }, geos::geom::GEOS_MULTILINESTRING, 2, false);
+
+    geos::io::GeoArrowWriter writer;
+    auto input = readAll({ "POINT (1 1)", "MULTIPOINT ((2 2), (3 3))" });
+    auto arr = writer.write({ input[0].get(), nullptr, input[1].get() });
+    ensure_equals(arr.type, geos::geom::GEOS_MULTIPOINT);
+    ensure_equals(arr.geomOffsets.size(), 4u);
+    ensure_equals(arr.geomOffsets[1], 1);
+    ensure_equals(arr.geomOffsets[2], 1);
+    ensure_equals(arr.geomOffsets[3], 3);
+}
+
+// Mixed families are rejected
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto input = readAll({ "POINT (1 1)", "LINESTRING (0 0, 1 1)" });
+    geos::io::GeoArrowWriter writer;
+    try {
+        writer.write({ input[0].get(), input[1].get() });
+        fail("Expected IllegalArgumentException for mixed types");
+    }
+    catch(const geos::util::IllegalArgumentException&) {}
+}
+
+} // namespace tut
+
@@ -0,0 +1,90 @@
+//
+// Test Suite for geos::noding::snapround::LocalSnapRoundingNoder class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+#include <util/NodingTestUtil.h>
+
+// geos
+#include <geos/noding/snapround/LocalSnapRoundingNoder.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/PrecisionModel.h>
+
+// std
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::noding::snapround;
+using geos::io::WKTReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_localsnaproundingnoder_data {
+
+    WKTReader r;
+
+    std::unique_ptr<Geometry>
+    node(const std::string& wkt, LocalSnapRoundingNoder& noder)
+    {
+        std::unique_ptr<Geometry> geom = r.read(wkt);
+        return geos::NodingTestUtil::nodeValidated(geom.get(), nullptr, &noder);
+    }
+
+    bool
+    containsLine(const Geometry* geom, const std::string& wkt)
+    {
+        std::unique_ptr<Geometry> line = r.read(wkt);
+        for (std::size_t i = 0; i < geom->getNumGeometries(); i++) {
+            if (geom->getGeometryN(i)->equalsExact(line.get())) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+typedef test_group<test_localsnaproundingnoder_data> group;
+typedef group::object object;
+
+group test_localsnaproundingnoder_group("geos::noding::snapround::LocalSnapRoundingNoder");
+
+//
+// Test Cases
+//
+
+// Input which floating noding handles is not rounded
+template<>
+template<>
+void object::test<1> ()
+{
+    PrecisionModel pm(1.0);
+    LocalSnapRoundingNoder noder(&pm);
+    std::unique_ptr<Geometry> result = node("MULTILINESTRING ((0.1 0.1, 9.9 0.1), (5.05 5.05, 5.05 -5.05))", noder);
+
+    std::unique_ptr<Geometry> expected = r.read("MULTILINESTRING ((0.1 0.1, 5.05 0.1), (5.05 0.1, 9.9 0.1), (5.05 5.05, 5.05 0.1), (5.05 0.1, 5.05 -5.05))");
+    ensure_equals_geometry(result.get(), expected.get());
+    ensure_equals(noder.getNumSnapRounded(), 0u);
+}
+
+// Only the segments near floating noding failures are rounded
+template<>
+template<>
+void object::test<2> ()
+{
+    PrecisionModel pm(1e6);
+    LocalSnapRoundingNoder noder(&pm);
+    std::unique_ptr<Geometry> result = node("MULTILINESTRING ("
+        "(654948.3853299792 1794977.105854025, 655016.3812220972 1794939.918901604, 655016.2022581929 1794940.1099794197, 655014.9264068712 1794941.4254068714, 655014.7408834674 1794941.6101225375, 654948.3853299792 1794977.105854025), "
+        "(655103.6628454948 1794805.456674405, 655016.20226 1794940.10998, 655014.8317182435 1794941.5196832407, 655014.8295602322 1794941.5218318563, 655014.740883467 1794941.610122538, 655016.6029214273 1794938.7590508445, 655103.6628454948 1794805.456674405), "
+        "(654000.123456789 1794000.123456789, 654010.123456789 1794000.123456789))", noder);
+
+    ensure(noder.getNumSnapRounded() > 0u);
+    ensure(containsLine(result.get(), "LINESTRING (654000.123456789 1794000.123456789, 654010.123456789 1794000.123456789)"));
+}
+
+} // namespace tut
@@ -18,6 +18,7 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/CoordinateArraySequence.h>
 // std
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -565,6 +566,55 @@ void object::test<21>()
     ensure_equals(g1->distance(g2.get()), 1.9996999774966246);
 }
 
+// 22 - isWithinDistance of geometries large enough to be indexed
+template<>
+template<>
+void object::test<22>()
+{
+    using geos::operation::distance::DistanceOp;
+
+    // circles of 600 vertices around the origin
+    auto circle = [](double r) {
+        std::string wkt = "(";
+        for(int i = 0; i <= 600; i++) {
+            double angle = 2 * geos::MATH_PI * (i % 600) / 600;
+            if(i > 0) {
+                wkt += ", ";
+            }
+            wkt += std::to_string(r * std::cos(angle)) + " " + std::to_string(r * std::sin(angle));
+        }
+        return wkt + ")";
+    };
+    auto poly = wktreader.read("POLYGON (" + circle(100) + ", " + circle(50) + ")");
+
+    std::vector<std::string> others = {
+        // in the hole
+        "POLYGON " + std::string("(") + circle(20) + ")",
+        "LINESTRING " + circle(30),
+        // inside the polygon
+        "LINESTRING " + circle(75),
+        "MULTIPOINT ((0 0), (80 0))",
+        "MULTIPOINT ((0 0), (0 10), (45 0))",
+        // covering the polygon
+        "POLYGON (" + circle(200) + ")",
+        // outside
+        "LINESTRING " + circle(110),
+        "MULTILINESTRING (" + circle(10) + ", " + circle(120) + ")",
+    };
+    for(const std::string& wkt : others) {
+        auto other = wktreader.read(wkt);
+        double dist = DistanceOp::distance(*poly, *other);
+        for(double d : { 0.0, 1.0, 9.0, 11.0, 40.0 }) {
+            ensure_equals(wkt + " " + std::to_string(d),
+                          DistanceOp::isWithinDistance(*poly, *other, d), dist <= d);
+            ensure_equals(DistanceOp::isWithinDistance(*other, *poly, d), dist <= d);
+        }
+    }
+
+    auto empty = wktreader.read("LINESTRING EMPTY");
+    ensure(DistanceOp::isWithinDistance(*poly, *empty, 0.0));
+}
+
 // TODO: finish the tests by adding:
 // 	LINESTRING - *all*
 // 	MULTILINESTRING - *all*
@@ -364,6 +364,85 @@ void object::test<11>
         fail("IndexedFacedDistance::nearestPoints did not throw on empty input");
     }
     catch (const GEOSException&) { }
+
+    try {
+        ifd.distance(geos::geom::Coordinate(150, 150));
+        fail("IndexedFacedDistance::distance did not throw on empty input");
+    }
+    catch (const GEOSException&) { }
+}
+
+// Distances to coordinates, one by one and in batches
+template<>
+template<>
+void object::test<12>
+()
+{
+    using geos::geom::Coordinate;
+    using geos::operation::distance::IndexedFacetDistance;
+
+    GeomPtr g(_wktreader.read("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (20 20, 20 80, 80 80, 80 20, 20 20))"));
+    IndexedFacetDistance ifd(g.get());
+
+    std::vector<Coordinate> pts;
+    for (int i = 0; i < 12; i++) {
+        pts.emplace_back(-30 + 13.7 * i, 50 + 9.1 * std::sin(i));
+    }
+
+    std::vector<double> distances;
+    ifd.distance(pts, distances);
+    ensure_equals(distances.size(), pts.size());
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        GeomPtr pt(_factory->createPoint(pts[i]));
+        double expected = g->getBoundary()->distance(pt.get());
+        ensure_equals("distance", ifd.distance(pts[i]), expected, 1e-9);
+        ensure_equals("batch distance", distances[i], expected, 1e-9);
+    }
+
+    // a batch of close points
+    std::vector<Coordinate> cell = { Coordinate(49, 49), Coordinate(51, 49), Coordinate(49, 51), Coordinate(51, 51) };
+    ifd.distance(cell, distances);
+    for (double d : distances) {
+        ensure_equals("cell distance", d, 29.0, 1e-9);
+    }
+
+    ifd.distance(std::vector<Coordinate>(), distances);
+    ensure(distances.empty());
+}
+
+// 13 - Distances to coordinate arrays, and within distance tests
+template<>
+template<>
+void object::test<13>
+()
+{
+    using geos::geom::Coordinate;
+    using geos::operation::distance::IndexedFacetDistance;
+
+    GeomPtr g(_wktreader.read("LINESTRING (0 0, 100 0, 100 100, 50 150)"));
+    IndexedFacetDistance ifd(g.get());
+
+    // a track along the line, then scattered points
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 100; i++) {
+        x.push_back(0.3 * i);
+        y.push_back(2 + std::sin(i));
+    }
+    for (int i = 0; i < 50; i++) {
+        x.push_back(-50 + 97.3 * i - 200 * std::floor(97.3 * i / 200));
+        y.push_back(-40 + 61.7 * i - 200 * std::floor(61.7 * i / 200));
+    }
+
+    std::vector<double> distances(x.size());
+    ifd.distance(x.data(), y.data(), x.size(), distances.data());
+    for (std::size_t i = 0; i < x.size(); i++) {
+        GeomPtr pt(_factory->createPoint(Coordinate(x[i], y[i])));
+        double expected = g->distance(pt.get());
+        ensure_equals("array distance", distances[i], expected, 1e-9);
+        ensure(ifd.isWithinDistance(Coordinate(x[i], y[i]), expected + 1e-9));
+        ensure(expected == 0 || !ifd.isWithinDistance(Coordinate(x[i], y[i]), expected - 1e-9));
+    }
 }
 
 
@@ -66,9 +66,10 @@ struct test_linemerger_data {
     void
     doTest(const char* const* inputWKT,
            const char* const* expectedWKT,
-           bool compareDirections = true)
+           bool compareDirections = true,
+           bool directed = false)
     {
-        LineMerger lineMerger;
+        LineMerger lineMerger(directed);
 
         readWKT(inputWKT, inpGeoms);
         readWKT(expectedWKT, expGeoms);
@@ -261,6 +262,61 @@ void object::test<7>
     doTest(inpWKT, expWKT);
 }
 
+// Directed merging only sews lines with the same direction
+template<> template<>
+void object::test<8>
+()
+{
+    const char* inpWKT[] = {
+        "LINESTRING(0 0, 0 5)",
+        "LINESTRING(0 5, 5 5)",
+        "LINESTRING(0 0, 5 5)",
+        "LINESTRING(10 0, 11 1)",
+        "LINESTRING(12 2, 11 1)",
+        "LINESTRING(20 0, 21 1)",
+        "LINESTRING(21 1, 22 2)",
+        "LINESTRING(30 2, 30 1)",
+        "LINESTRING(31 2, 30 2)",
+        "LINESTRING(31 2, 32 2)",
+        nullptr
+    };
+    const char* expWKT[] = {
+        "LINESTRING(0 0, 0 5, 5 5)",
+        "LINESTRING(0 0, 5 5)",
+        "LINESTRING(10 0, 11 1)",
+        "LINESTRING(12 2, 11 1)",
+        "LINESTRING(20 0, 21 1, 22 2)",
+        "LINESTRING(31 2, 30 2, 30 1)",
+        "LINESTRING(31 2, 32 2)",
+        nullptr
+    };
+
+    doTest(inpWKT, expWKT, true, true);
+}
+
+// Directed merging of loops, and of lines with repeated points
+template<> template<>
+void object::test<9>
+()
+{
+    const char* inpWKT[] = {
+        "LINESTRING(0 0, 0 5)",
+        "LINESTRING(0 5, 5 5)",
+        "LINESTRING(5 5, 5 0)",
+        "LINESTRING(5 0, 0 0)",
+        "LINESTRING(10 0, 10 0, 10 5, 10 5)",
+        "LINESTRING(10 5, 15 5, 15 5)",
+        "LINESTRING(20 0, 20 0)",
+        nullptr
+    };
+    const char* expWKT[] = {
+        "LINESTRING(0 0, 0 5, 5 5, 5 0, 0 0)",
+        "LINESTRING(10 0, 10 5, 15 5)",
+        nullptr
+    };
+
+    doTest(inpWKT, expWKT, true, true);
+}
 
 } // namespace tut
 
@@ -14,6 +14,7 @@
 // geos
 #include <geos/operation/overlayng/OverlayNGRobust.h>
 #include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/util/OperationStats.h>
 
 // std
 #include <memory>
@@ -23,6 +24,8 @@ using geos::io::WKTReader;
 using geos::io::WKTWriter;
 using geos::operation::overlayng::OverlayNGRobust;
 using geos::operation::overlayng::OverlayNG;
+using geos::util::OperationStats;
+using geos::util::OperationStatsScope;
 
 namespace tut {
 //
@@ -93,6 +96,71 @@ void object::test<2> ()
     checkOverlaySuccess(a, b, OverlayNG::INTERSECTION);
 }
 
+// OverlayFast gives the floating overlay result when it succeeds
+template<>
+template<>
+void object::test<3> ()
+{
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    std::unique_ptr<Geometry> b = r.read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+
+    OperationStats stats;
+    std::unique_ptr<Geometry> result;
+    {
+        OperationStatsScope scope(&stats);
+        result = OverlayNGRobust::OverlayFast(a.get(), b.get(), OverlayNG::UNION);
+    }
+    std::unique_ptr<Geometry> expected = OverlayNGRobust::Overlay(a.get(), b.get(), OverlayNG::UNION);
+    ensure_equals_geometry(expected.get(), result.get());
+    ensure_equals(stats.getCount(OperationStats::OVERLAY_SNAP_ROUNDING_TRIES), 0u);
+}
+
+// OverlayFast snap-rounds only around the failures of floating noding
+template<>
+template<>
+void object::test<4> ()
+{
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((654948.3853299792 1794977.105854025, 655016.3812220972 1794939.918901604, 655016.2022581929 1794940.1099794197, 655014.9264068712 1794941.4254068714, 655014.7408834674 1794941.6101225375, 654948.3853299792 1794977.105854025))");
+    std::unique_ptr<Geometry> b = r.read("POLYGON ((655103.6628454948 1794805.456674405, 655016.20226 1794940.10998, 655014.8317182435 1794941.5196832407, 655014.8295602322 1794941.5218318563, 655014.740883467 1794941.610122538, 655016.6029214273 1794938.7590508445, 655103.6628454948 1794805.456674405))");
 
+    OperationStats stats;
+    std::unique_ptr<Geometry> result;
+    {
+        OperationStatsScope scope(&stats);
+        result = OverlayNGRobust::OverlayFast(a.get(), b.get(), OverlayNG::INTERSECTION);
+    }
+    ensure(result != nullptr);
+    ensure(result->isValid());
+    ensure_equals(stats.getCount(OperationStats::OVERLAY_SNAPPING_TRIES), 0u);
+    ensure_equals(stats.getCount(OperationStats::OVERLAY_SNAP_ROUNDING_TRIES), 0u);
+    ensure(stats.getCount(OperationStats::LOCAL_SNAP_ROUNDED_SEGMENTS) > 0u);
+
+    std::unique_ptr<Geometry> expected = OverlayNGRobust::Overlay(a.get(), b.get(), OverlayNG::INTERSECTION);
+    ensure_equals("area", result->getArea(), expected->getArea(), 1e-6);
+}
+
+// Coordinates away from the failures of floating noding keep their precision
+template<>
+template<>
+void object::test<5> ()
+{
+    std::unique_ptr<Geometry> a = r.read("MULTIPOLYGON (((654948.3853299792 1794977.105854025, 655016.3812220972 1794939.918901604, 655016.2022581929 1794940.1099794197, 655014.9264068712 1794941.4254068714, 655014.7408834674 1794941.6101225375, 654948.3853299792 1794977.105854025)), ((654000.123456789123 1794000.123456789123, 654010.123456789123 1794000.123456789123, 654010.123456789123 1794010.123456789123, 654000.123456789123 1794010.123456789123, 654000.123456789123 1794000.123456789123)))");
+    std::unique_ptr<Geometry> b = r.read("MULTIPOLYGON (((655103.6628454948 1794805.456674405, 655016.20226 1794940.10998, 655014.8317182435 1794941.5196832407, 655014.8295602322 1794941.5218318563, 655014.740883467 1794941.610122538, 655016.6029214273 1794938.7590508445, 655103.6628454948 1794805.456674405)), ((654005.987654321987 1794005.987654321987, 654015.987654321987 1794005.987654321987, 654015.987654321987 1794015.987654321987, 654005.987654321987 1794015.987654321987, 654005.987654321987 1794005.987654321987)))");
+
+    std::unique_ptr<Geometry> result = OverlayNGRobust::OverlayFast(a.get(), b.get(), OverlayNG::UNION);
+    ensure(result->isValid());
+
+    std::unique_ptr<Geometry> farA = r.read("POLYGON ((654000.123456789123 1794000.123456789123, 654010.123456789123 1794000.123456789123, 654010.123456789123 1794010.123456789123, 654000.123456789123 1794010.123456789123, 654000.123456789123 1794000.123456789123))");
+    std::unique_ptr<Geometry> farB = r.read("POLYGON ((654005.987654321987 1794005.987654321987, 654015.987654321987 1794005.987654321987, 654015.987654321987 1794015.987654321987, 654005.987654321987 1794015.987654321987, 654005.987654321987 1794005.987654321987))");
+    std::unique_ptr<Geometry> farUnion = OverlayNG::overlay(farA.get(), farB.get(), OverlayNG::UNION);
+
+    bool found = false;
+    for (std::size_t i = 0; i < result->getNumGeometries(); i++) {
+        if (result->getGeometryN(i)->equalsExact(farUnion.get())) {
+            found = true;
+        }
+    }
+    ensure(found);
+}
 
 } // namespace tut
@@ -326,5 +326,56 @@ void object::test<8>()
     doTest(inp, exp, true);
 }
 
-} // namespace tut
+// Several threads give the same polygons, holes, dangles and cut edges
+template<>
+template<>
+void object::test<9>()
+{
+    // a grid of cells, each holding a square with a smaller square inside,
+    // with a dangle and repeated points on some lines
+    std::vector<std::unique_ptr<geos::geom::Geometry>> inputGeoms;
+    const int n = 6;
+    for(int i = 0; i <= n; i++) {
+        for(int j = 0; j < n; j++) {
+            std::string x = std::to_string(10 * i), y0 = std::to_string(10 * j), y1 = std::to_string(10 * j + 10);
+            inputGeoms.push_back(wktreader.read("LINESTRING (" + x + " " + y0 + ", " + x + " " + y0 + ", "
+                                                + x + " " + y1 + ")"));
+            inputGeoms.push_back(wktreader.read("LINESTRING (" + y0 + " " + x + ", " + y1 + " " + x + ", "
+                                                + y1 + " " + x + ")"));
+        }
+    }
+    for(int i = 0; i < n; i++) {
+        for(int j = 0; j < n; j++) {
+            for(int k = 2; k <= 4; k += 2) {
+                double x0 = 10 * i + k, y0 = 10 * j + k, x1 = 10 * i + 10 - k, y1 = 10 * j + 10 - k;
+                std::string a = std::to_string(x0) + " ", b = std::to_string(x1) + " ";
+                inputGeoms.push_back(wktreader.read("LINESTRING (" + a + std::to_string(y0) + ", "
+                                                    + b + std::to_string(y0) + ", " + b + std::to_string(y1) + ", "
+                                                    + a + std::to_string(y1) + ", " + a + std::to_string(y0) + ")"));
+            }
+        }
+        inputGeoms.push_back(wktreader.read("LINESTRING (" + std::to_string(10 * i + 1) + " 1, "
+                                            + std::to_string(10 * i) + " 0)"));
+    }
+
+    Polygonizer polygonizer;
+    Polygonizer polygonizerThreads;
+    polygonizerThreads.setNumThreads(4);
+    for(const auto& g : inputGeoms) {
+        polygonizer.add(g.get());
+        polygonizerThreads.add(g.get());
+    }
 
+    auto polys = polygonizer.getPolygons();
+    auto polysThreads = polygonizerThreads.getPolygons();
+    ensure_equals(polys.size(), static_cast<std::size_t>(3 * n * n));
+    ensure_equals(polysThreads.size(), polys.size());
+    for(std::size_t i = 0; i < polys.size(); i++) {
+        ensure(polys[i]->equalsExact(polysThreads[i].get()));
+    }
+    ensure_equals(polygonizer.getDangles().size(), static_cast<std::size_t>(n));
+    ensure_equals(polygonizerThreads.getDangles().size(), static_cast<std::size_t>(n));
+    ensure_equals(polygonizerThreads.getCutEdges().size(), 0u);
+}
+
+} // namespace tut
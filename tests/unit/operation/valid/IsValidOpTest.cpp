@@ -118,4 +118,89 @@ void object::test<3>
     ensure(g_rev->isValid());
 }
 
+// 4 - Polygons without holes, checked without a topology graph when simple
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto checkError = [this](const std::string& wkt, int errorType, const Coordinate& pt) {
+        GeomPtr g(wktreader.read(wkt));
+        IsValidOp isValidOp(g.get());
+        ensure(wkt, !isValidOp.isValid());
+        TopologyValidationError* err = isValidOp.getValidationError();
+        ensure_equals(wkt, err->getErrorType(), errorType);
+        ensure(wkt, err->getCoordinate().equals2D(pt));
+    };
+
+    ensure(wktreader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))")->isValid());
+    ensure(wktreader.read("POLYGON ((0 0, 10 0, 10 0, 10 10, 0 10, 0 0, 0 0))")->isValid());
+    ensure(wktreader.read("POLYGON ((0 0, 5 0, 10 0, 10 10, 0 10, 0 0))")->isValid());
+    ensure(wktreader.read("LINEARRING (0 0, 10 0, 10 10, 0 10, 0 0)")->isValid());
+
+    checkError("POLYGON ((0 0, 10 10, 10 0, 0 10, 0 0))",
+               TopologyValidationError::eSelfIntersection, Coordinate(5, 5));
+    checkError("POLYGON ((0 0, 10 0, 5 5, 10 10, 0 10, 5 5, 0 0))",
+               TopologyValidationError::eRingSelfIntersection, Coordinate(5, 5));
+    checkError("POLYGON ((0 0, 10 0, 0 0, 0 0))",
+               TopologyValidationError::eTooFewPoints, Coordinate(0, 0));
+    checkError("LINEARRING (0 0, 10 10, 10 0, 0 10, 0 0)",
+               TopologyValidationError::eRingSelfIntersection, Coordinate(5, 5));
+
+    // spike along the boundary
+    ensure(!wktreader.read("POLYGON ((0 0, 10 0, 10 10, 10 20, 10 10, 0 10, 0 0))")->isValid());
+    // collinear segments overlapping at the closing vertex
+    ensure(!wktreader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 -5, 0 0))")->isValid());
+}
+
+// 5 - Batch validation over several threads
+template<>
+template<>
+void object::test<5>
+()
+{
+    const char* wkts[] = {
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((0 0, 10 10, 10 0, 0 10, 0 0))",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (20 20, 21 20, 21 21, 20 20))",
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((5 5, 15 5, 15 15, 5 15, 5 5)))",
+        "POLYGON ((0 1, -10 10, 10 10, 0 1, 4 6, -4 6, 0 1))",
+        "LINESTRING (0 0, 10 10)"
+    };
+    std::vector<GeomPtr> owned;
+    std::vector<const Geometry*> geoms;
+    for(std::size_t i = 0; i < 600; i++) {
+        owned.push_back(wktreader.read(wkts[i % 6]));
+        geoms.push_back(owned.back().get());
+    }
+
+    for(bool isSelfTouchingValid : { false, true }) {
+        std::vector<int> errors;
+        std::vector<Coordinate> locations;
+        IsValidOp::validate(geoms, isSelfTouchingValid, 4, errors, locations);
+        ensure_equals(errors.size(), geoms.size());
+        ensure_equals(locations.size(), geoms.size());
+
+        for(std::size_t i = 0; i < geoms.size(); i++) {
+            IsValidOp op(geoms[i]);
+            op.setSelfTouchingRingFormingHoleValid(isSelfTouchingValid);
+            TopologyValidationError* err = op.getValidationError();
+            if(err == nullptr) {
+                ensure_equals(errors[i], -1);
+                ensure(locations[i].isNull());
+            }
+            else {
+                ensure_equals(errors[i], err->getErrorType());
+                ensure(locations[i].equals2D(err->getCoordinate()));
+            }
+        }
+        ensure_equals(errors[4], isSelfTouchingValid ? -1 : static_cast<int>(TopologyValidationError::eRingSelfIntersection));
+    }
+
+    std::vector<int> errors;
+    std::vector<Coordinate> locations;
+    IsValidOp::validate(std::vector<const Geometry*>(), false, 0, errors, locations);
+    ensure(errors.empty());
+}
+
 } // namespace tut
@@ -23,7 +23,24 @@ namespace tut {
 //
 
 struct test_makevalid_data {
+    geos::io::WKTReader reader;
+
     test_makevalid_data() {}
+
+    void
+    checkMethod(const std::string& wkt, MakeValid::Method method, const std::string& wktExpected)
+    {
+        auto geom = reader.read(wkt);
+        auto expected = reader.read(wktExpected);
+
+        MakeValid mkvalid;
+        mkvalid.setMethod(method);
+        auto result = mkvalid.build(geom.get());
+
+        ensure("MakeValid output is not valid", result->isValid());
+        ensure_equals(result->getGeometryTypeId(), expected->getGeometryTypeId());
+        ensure(result->equals(expected.get()));
+    }
 };
 
 typedef test_group<test_makevalid_data> group;
@@ -104,5 +121,89 @@ void object::test<1>
 // }
 
 
+// 3 - Self-intersecting ring
+template<>
+template<>
+void object::test<3>
+()
+{
+    const char* bowtie = "POLYGON ((0 0, 10 10, 10 0, 0 10, 0 0))";
+    const char* expected = "MULTIPOLYGON (((0 0, 5 5, 0 10, 0 0)), ((5 5, 10 10, 10 0, 5 5)))";
+    checkMethod(bowtie, MakeValid::EVEN_ODD, expected);
+    checkMethod(bowtie, MakeValid::WINDING, expected);
+}
+
+// 4 - Overlapping shells
+template<>
+template<>
+void object::test<4>
+()
+{
+    const char* wkt = "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((5 5, 15 5, 15 15, 5 15, 5 5)))";
+    checkMethod(wkt, MakeValid::EVEN_ODD,
+                "MULTIPOLYGON (((0 0, 10 0, 10 5, 5 5, 5 10, 0 10, 0 0)), ((10 5, 15 5, 15 15, 5 15, 5 10, 10 10, 10 5)))");
+    checkMethod(wkt, MakeValid::WINDING,
+                "POLYGON ((0 0, 10 0, 10 5, 15 5, 15 15, 5 15, 5 10, 0 10, 0 0))");
+}
+
+// 5 - Nested shells, and a hole partly outside its shell
+template<>
+template<>
+void object::test<5>
+()
+{
+    const char* nested = "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((2 2, 8 2, 8 8, 2 8, 2 2)))";
+    checkMethod(nested, MakeValid::EVEN_ODD,
+                "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))");
+    checkMethod(nested, MakeValid::WINDING,
+                "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+
+    const char* hole = "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (5 2, 15 2, 15 8, 5 8, 5 2))";
+    const char* holeExpected = "MULTIPOLYGON (((0 0, 10 0, 10 2, 5 2, 5 8, 10 8, 10 10, 0 10, 0 0)), ((10 2, 15 2, 15 8, 10 8, 10 2)))";
+    checkMethod(hole, MakeValid::EVEN_ODD, holeExpected);
+    checkMethod(hole, MakeValid::WINDING, holeExpected);
+}
+
+// 6 - Collapsed rings are dropped, collections keep the method
+template<>
+template<>
+void object::test<6>
+()
+{
+    checkMethod("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (0 0, 5 0, 5 0, 0 0))", MakeValid::EVEN_ODD,
+                "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    checkMethod("POLYGON ((0 0, 10 0, 10 0, 0 0))", MakeValid::WINDING, "POLYGON EMPTY");
+    checkMethod("GEOMETRYCOLLECTION (POINT (1 1), MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((2 2, 8 2, 8 8, 2 8, 2 2))))",
+                MakeValid::WINDING,
+                "GEOMETRYCOLLECTION (POINT (1 1), POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0)))");
+}
+
+// 7 - Many crossing rings are repaired in a single pass
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::string wkt = "POLYGON ((";
+    const int n = 101;
+    for(int i = 0; i <= n; i++) {
+        // a star polygon crossing itself at every vertex
+        double angle = 2 * geos::MATH_PI * (45 * (i % n) % n) / n;
+        if(i > 0) {
+            wkt += ", ";
+        }
+        wkt += std::to_string(100 * std::cos(angle)) + " " + std::to_string(100 * std::sin(angle));
+    }
+    wkt += "))";
+    auto geom = reader.read(wkt);
+
+    for(MakeValid::Method method : { MakeValid::EVEN_ODD, MakeValid::WINDING }) {
+        MakeValid mkvalid;
+        mkvalid.setMethod(method);
+        auto result = mkvalid.build(geom.get());
+        ensure("MakeValid output is not valid", result->isValid());
+        ensure(result->getArea() > 0);
+    }
+}
 
 } // namespace tut
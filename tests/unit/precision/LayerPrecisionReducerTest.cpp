@@ -0,0 +1,211 @@
+//
+// Test Suite for geos::precision::LayerPrecisionReducer class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/precision/GeometryPrecisionReducer.h>
+#include <geos/precision/LayerPrecisionReducer.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_lpr_data {
+    typedef std::unique_ptr<geos::geom::Geometry> GeometryPtr;
+    typedef geos::geom::GeometryFactory GeometryFactory;
+
+    geos::geom::PrecisionModel pm_fixed_;
+    geos::io::WKTReader reader_;
+
+    test_lpr_data()
+        : pm_fixed_(1)
+    {}
+
+    std::vector<GeometryPtr>
+    read(const std::vector<std::string>& wkts)
+    {
+        std::vector<GeometryPtr> geoms;
+        for(const std::string& wkt : wkts) {
+            geoms.push_back(reader_.read(wkt));
+        }
+        return geoms;
+    }
+
+    static std::vector<const geos::geom::Geometry*>
+    pointers(const std::vector<GeometryPtr>& geoms)
+    {
+        std::vector<const geos::geom::Geometry*> ptrs;
+        for(const GeometryPtr& g : geoms) {
+            ptrs.push_back(g.get());
+        }
+        return ptrs;
+    }
+
+    // Checks that the polygons are valid, and neither overlap nor leave
+    // a gap between them
+    static void
+    checkCoverage(const std::vector<GeometryPtr>& result)
+    {
+        double areaSum = 0;
+        for(const GeometryPtr& g : result) {
+            ensure(g->toString(), g->isValid());
+            areaSum += g->getArea();
+        }
+        auto resultUnion = GeometryFactory::getDefaultInstance()
+                           ->createGeometryCollection(pointers(result))->Union();
+        ensure_equals(resultUnion->getArea(), areaSum);
+        const geos::geom::Polygon* poly = dynamic_cast<const geos::geom::Polygon*>(resultUnion.get());
+        ensure(resultUnion->toString(), poly != nullptr);
+        ensure_equals(poly->getNumInteriorRing(), 0u);
+    }
+};
+
+typedef test_group<test_lpr_data> group;
+typedef group::object object;
+
+group test_lpr_group("geos::precision::LayerPrecisionReducer");
+
+//
+// Test Cases
+//
+
+// 1 - A shared edge is snapped to the hot pixels of both polygons
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto input = read({
+        "POLYGON ((0 0, 10 0, 10 12.6, 0 10, 0 0))",
+        "POLYGON ((0 10, 10 12.6, 10 20, 5.3 11.45, 0 20, 0 10))"
+    });
+
+    // reduced one at a time, the polygons overlap
+    GeometryPtr a = geos::precision::GeometryPrecisionReducer::reduce(*input[0], pm_fixed_);
+    GeometryPtr b = geos::precision::GeometryPrecisionReducer::reduce(*input[1], pm_fixed_);
+    ensure(a->intersection(b.get())->getArea() > 0);
+
+    auto result = geos::precision::LayerPrecisionReducer::reduce(pointers(input), pm_fixed_);
+    ensure_equals(result.size(), 2u);
+    checkCoverage(result);
+    GeometryPtr expected = reader_.read("POLYGON ((0 0, 10 0, 10 13, 5 11, 0 10, 0 0))");
+    ensure(result[0]->toString(), result[0]->equals(expected.get()));
+}
+
+// 2 - Several threads give the same result
+template<>
+template<>
+void object::test<2>
+()
+{
+    // a grid of cells with wavy shared edges
+    const int n = 8;
+    auto vertex = [](int i, int j) {
+        double x = 10 * i + 3 * std::sin(1.7 * i + 2.3 * j);
+        double y = 10 * j + 3 * std::cos(2.9 * i + 1.3 * j);
+        if(i == 0 || i == n) {
+            x = 10 * i;
+        }
+        if(j == 0 || j == n) {
+            y = 10 * j;
+        }
+        return std::to_string(x) + " " + std::to_string(y);
+    };
+    std::vector<std::string> wkts;
+    for(int i = 0; i < n; i++) {
+        for(int j = 0; j < n; j++) {
+            wkts.push_back("POLYGON ((" + vertex(i, j) + ", " + vertex(i + 1, j) + ", "
+                           + vertex(i + 1, j + 1) + ", " + vertex(i, j + 1) + ", " + vertex(i, j) + "))");
+        }
+    }
+    auto input = read(wkts);
+
+    geos::geom::PrecisionModel pm(0.5);
+    auto result = geos::precision::LayerPrecisionReducer::reduce(pointers(input), pm);
+    checkCoverage(result);
+
+    geos::precision::LayerPrecisionReducer reducer(pm);
+    reducer.setNumThreads(4);
+    auto resultThreads = reducer.reduce(pointers(input));
+    ensure_equals(resultThreads.size(), result.size());
+    for(std::size_t i = 0; i < result.size(); i++) {
+        ensure(result[i]->equalsExact(resultThreads[i].get()));
+    }
+}
+
+// 3 - Lines, points, empty geometries and changing the precision model
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto input = read({
+        "POLYGON ((0.2 0.2, 10.2 0.2, 10.2 10.2, 0.2 10.2, 0.2 0.2))",
+        "LINESTRING (0.3 0.3, 5.4 5.6)",
+        "POINT (1.6 1.4)",
+        "POLYGON EMPTY"
+    });
+    input[0]->setSRID(4326);
+
+    geos::precision::LayerPrecisionReducer reducer(pm_fixed_);
+    reducer.setChangePrecisionModel(true);
+    auto result = reducer.reduce(pointers(input));
+    ensure_equals(result.size(), 4u);
+    ensure(result[0]->equals(reader_.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))").get()));
+    ensure_equals(result[0]->getSRID(), 4326);
+    ensure(result[0]->getPrecisionModel()->isFloating() == false);
+    ensure(result[1]->equalsExact(reader_.read("LINESTRING (0 0, 5 6)").get()));
+    ensure(result[2]->equalsExact(reader_.read("POINT (2 1)").get()));
+    ensure(result[3]->isEmpty());
+
+    // nothing to snap to with a floating precision model
+    geos::geom::PrecisionModel pmFloat;
+    result = geos::precision::LayerPrecisionReducer::reduce(pointers(input), pmFloat);
+    ensure(result[0]->equalsExact(input[0].get()));
+}
+
+// 4 - The polygons of a mixed collection are snapped to the layer hot pixels
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto input = read({
+        "POLYGON ((0 0, 10 0, 10 12.6, 0 10, 0 0))",
+        "GEOMETRYCOLLECTION (POLYGON ((0 10, 10 12.6, 10 20, 5.3 11.45, 0 20, 0 10)), LINESTRING (20.3 20.3, 25.4 25.6), POINT (1.6 1.4))"
+    });
+
+    auto result = geos::precision::LayerPrecisionReducer::reduce(pointers(input), pm_fixed_);
+    ensure_equals(result.size(), 2u);
+    ensure_equals(result[1]->getGeometryTypeId(), geos::geom::GEOS_GEOMETRYCOLLECTION);
+
+    // the polygon is reduced as when it is given alone, which splits it in two
+    auto polygons = read({
+        "POLYGON ((0 0, 10 0, 10 12.6, 0 10, 0 0))",
+        "POLYGON ((0 10, 10 12.6, 10 20, 5.3 11.45, 0 20, 0 10))"
+    });
+    auto expected = geos::precision::LayerPrecisionReducer::reduce(pointers(polygons), pm_fixed_);
+    ensure_equals(expected[1]->getNumGeometries(), 2u);
+    ensure_equals(result[1]->getNumGeometries(), 4u);
+    for(std::size_t i = 0; i < 2; i++) {
+        ensure(result[1]->getGeometryN(i)->equalsExact(expected[1]->getGeometryN(i)));
+        ensure_equals(result[0]->intersection(result[1]->getGeometryN(i))->getArea(), 0.0);
+    }
+    ensure(result[1]->getGeometryN(2)->equalsExact(reader_.read("LINESTRING (20 20, 25 26)").get()));
+    ensure(result[1]->getGeometryN(3)->equalsExact(reader_.read("POINT (2 1)").get()));
+}
+
+} // namespace tut
@@ -0,0 +1,247 @@
+//
+// Test Suite for geos::precision::MinimumClearance class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/precision/MinimumClearance.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/index/strtree/ItemDistance.h>
+#include <geos/index/strtree/SimpleSTRdistance.h>
+#include <geos/index/strtree/SimpleSTRtree.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::Geometry;
+using geos::precision::MinimumClearance;
+using namespace geos::index::strtree;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_minimumclearance_data {
+
+    geos::io::WKTReader reader_;
+
+    /*
+     * Distance of point items, ignoring the pair of an item with itself
+     * so that a tree can be searched against itself.
+     */
+    struct PointItemDistance : public ItemDistance {
+        double
+        distance(const ItemBoundable* item1, const ItemBoundable* item2) override
+        {
+            const Coordinate* p1 = static_cast<const Coordinate*>(item1->getItem());
+            const Coordinate* p2 = static_cast<const Coordinate*>(item2->getItem());
+            if(p1 == p2) {
+                return std::numeric_limits<double>::infinity();
+            }
+            return p1->distance(*p2);
+        }
+    };
+
+    void
+    checkClearance(const std::string& wkt, double expected)
+    {
+        std::unique_ptr<Geometry> g = reader_.read(wkt);
+
+        // isAtLeast searches with its own bound before anything is computed
+        MinimumClearance bounded(g.get());
+        if(expected == std::numeric_limits<double>::infinity()) {
+            ensure(bounded.isAtLeast(std::numeric_limits<double>::max()));
+        }
+        else {
+            ensure(bounded.isAtLeast(expected));
+            ensure(!bounded.isAtLeast(expected * 1.000001 + 1e-12));
+        }
+
+        MinimumClearance mc(g.get());
+        double d = mc.getDistance();
+        if(expected == std::numeric_limits<double>::infinity()) {
+            ensure(d == expected);
+            ensure(mc.getLine()->isEmpty());
+            ensure(mc.isAtLeast(std::numeric_limits<double>::max()));
+            return;
+        }
+        ensure_equals("clearance", d, expected, 1e-12);
+        ensure_equals("line length", mc.getLine()->getLength(), expected, 1e-12);
+
+        // once computed, isAtLeast uses the distance
+        ensure(mc.isAtLeast(expected));
+        ensure(!mc.isAtLeast(expected * 1.000001 + 1e-12));
+    }
+
+    static double
+    bruteForceNearest(const std::vector<Coordinate>& pts1, const std::vector<Coordinate>& pts2)
+    {
+        double minDist = std::numeric_limits<double>::infinity();
+        for(const Coordinate& p1 : pts1) {
+            for(const Coordinate& p2 : pts2) {
+                if(&p1 != &p2 && p1.distance(p2) < minDist) {
+                    minDist = p1.distance(p2);
+                }
+            }
+        }
+        return minDist;
+    }
+
+    static std::vector<Coordinate>
+    randomPoints(std::mt19937& rng, std::size_t n)
+    {
+        std::vector<Coordinate> pts;
+        pts.reserve(n);
+        for(std::size_t i = 0; i < n; i++) {
+            pts.emplace_back(static_cast<double>(rng() % 1000),
+                             static_cast<double>(rng() % 1000));
+        }
+        return pts;
+    }
+
+    static void
+    fillTree(SimpleSTRtree& tree, std::vector<Coordinate>& pts)
+    {
+        for(Coordinate& p : pts) {
+            geos::geom::Envelope env(p);
+            tree.insert(&env, &p);
+        }
+    }
+
+    void
+    checkNearest(SimpleSTRtree& tree1, SimpleSTRtree& tree2,
+                 const std::vector<Coordinate>& pts1, const std::vector<Coordinate>& pts2)
+    {
+        double expected = bruteForceNearest(pts1, pts2);
+        PointItemDistance itemDist;
+
+        SimpleSTRdistance unbounded(tree1.getRoot(), tree2.getRoot(), &itemDist);
+        std::pair<const void*, const void*> nearest = unbounded.nearestNeighbour();
+        const Coordinate* p1 = static_cast<const Coordinate*>(nearest.first);
+        const Coordinate* p2 = static_cast<const Coordinate*>(nearest.second);
+        ensure_equals("unbounded", p1->distance(*p2), expected);
+
+        for(double maxDistance : {
+                    expected * 0.5, expected, expected * 1.5, expected + 100.0
+                }) {
+            SimpleSTRdistance bounded(tree1.getRoot(), tree2.getRoot(), &itemDist);
+            nearest = bounded.nearestNeighbour(maxDistance);
+            if(expected >= maxDistance) {
+                ensure(nearest.first == nullptr);
+                ensure(nearest.second == nullptr);
+                continue;
+            }
+            p1 = static_cast<const Coordinate*>(nearest.first);
+            p2 = static_cast<const Coordinate*>(nearest.second);
+            ensure(p1 != p2);
+            ensure_equals("bounded", p1->distance(*p2), expected);
+        }
+    }
+};
+
+typedef test_group<test_minimumclearance_data> group;
+typedef group::object object;
+
+group test_minimumclearance_group("geos::precision::MinimumClearance");
+
+//
+// Test Cases
+//
+
+// Polygons: the clearance is the distance of a vertex to a segment
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkClearance("POLYGON ((100 100, 300 100, 200 200, 100 100))", 100.0);
+    checkClearance("POLYGON ((0 0, 10 0, 10 10, 5 0.25, 0 10, 0 0))", 0.25);
+    checkClearance("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((12 0, 20 0, 20 10, 12 10, 12 0)))", 2.0);
+    checkClearance("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (1 1, 99 1, 99 99, 1 99, 1 1))", 1.0);
+}
+
+// Lines: the shortest segment bounds the clearance
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkClearance("LINESTRING (0 0, 10 0, 10 10, 5 0.5)", 0.5);
+    checkClearance("LINESTRING (0 0, 10 0, 10 0.1)", 0.1);
+    checkClearance("MULTILINESTRING ((0 0, 10 0), (0 3, 10 3))", 3.0);
+}
+
+// Multipoints: the clearance is the distance of the closest points
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkClearance("MULTIPOINT ((0 0), (3 4), (10 0))", 5.0);
+    checkClearance("MULTIPOINT ((0 0), (3 4), (10 0), (0 0))", 5.0);
+    checkClearance("POINT (1 1)", std::numeric_limits<double>::infinity());
+}
+
+// Collapsed inputs
+template<>
+template<>
+void object::test<4>
+()
+{
+    // coincident vertices only: no clearance
+    checkClearance("LINESTRING (1 1, 1 1)", std::numeric_limits<double>::infinity());
+    checkClearance("MULTIPOINT ((1 1), (1 1))", std::numeric_limits<double>::infinity());
+
+    // a vertex lying on a segment
+    checkClearance("POLYGON ((0 0, 1 1, 2 2, 0 0))", 0.0);
+    checkClearance("LINESTRING (0 0, 10 0, 5 0)", 0.0);
+}
+
+// Empty inputs
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkClearance("POLYGON EMPTY", std::numeric_limits<double>::infinity());
+    checkClearance("LINESTRING EMPTY", std::numeric_limits<double>::infinity());
+    checkClearance("GEOMETRYCOLLECTION EMPTY", std::numeric_limits<double>::infinity());
+}
+
+// SimpleSTRdistance with and without a bound, and searching a tree
+// against itself, gives the brute force nearest distance
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::mt19937 rng(42);
+    for(std::size_t n : {
+                2, 5, 17, 100, 500
+            }) {
+        std::vector<Coordinate> pts1 = randomPoints(rng, n);
+        std::vector<Coordinate> pts2 = randomPoints(rng, n + 3);
+        // repeated locations are distinct items at distance zero
+        pts1.push_back(pts1.front());
+
+        SimpleSTRtree tree1(4);
+        SimpleSTRtree tree2(4);
+        fillTree(tree1, pts1);
+        fillTree(tree2, pts2);
+
+        checkNearest(tree1, tree2, pts1, pts2);
+        checkNearest(tree2, tree2, pts2, pts2);
+        checkNearest(tree1, tree1, pts1, pts1);
+    }
+}
+
+} // namespace tut
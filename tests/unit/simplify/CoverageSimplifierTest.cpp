@@ -0,0 +1,275 @@
+//
+// Test Suite for geos::simplify::CoverageSimplifier
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Polygon.h>
+#include <geos/simplify/CoverageSimplifier.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace tut {
+using namespace geos::simplify;
+using geos::geom::Geometry;
+
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_coveragesimp_data {
+    geos::io::WKTReader wktreader;
+
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+
+    std::vector<GeomPtr>
+    read(const std::vector<std::string>& wkts)
+    {
+        std::vector<GeomPtr> geoms;
+        for(const std::string& wkt : wkts) {
+            geoms.push_back(wktreader.read(wkt));
+        }
+        return geoms;
+    }
+
+    static std::vector<const Geometry*>
+    pointers(const std::vector<GeomPtr>& geoms)
+    {
+        std::vector<const Geometry*> ptrs;
+        for(const GeomPtr& g : geoms) {
+            ptrs.push_back(g.get());
+        }
+        return ptrs;
+    }
+
+    // Checks that the geometries are valid, do not overlap,
+    // and leave no gaps where the input had none
+    static void
+    checkCoverage(const std::vector<GeomPtr>& input, const std::vector<GeomPtr>& result)
+    {
+        ensure_equals(result.size(), input.size());
+        double areaSum = 0;
+        for(const GeomPtr& g : result) {
+            ensure(g->toString(), g->isValid());
+            areaSum += g->getArea();
+        }
+        auto inputUnion = geos::geom::GeometryFactory::getDefaultInstance()
+                          ->createGeometryCollection(pointers(input))->Union();
+        auto resultUnion = geos::geom::GeometryFactory::getDefaultInstance()
+                           ->createGeometryCollection(pointers(result))->Union();
+        ensure_distance(resultUnion->getArea(), areaSum, 1e-9 * areaSum);
+        ensure_equals(resultUnion->getNumGeometries(), inputUnion->getNumGeometries());
+        ensure_equals(numHoles(*resultUnion), numHoles(*inputUnion));
+    }
+
+    static std::size_t
+    numHoles(const Geometry& g)
+    {
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < g.getNumGeometries(); i++) {
+            auto poly = dynamic_cast<const geos::geom::Polygon*>(g.getGeometryN(i));
+            if(poly) {
+                n += poly->getNumInteriorRing();
+            }
+        }
+        return n;
+    }
+
+    static std::string
+    wigglyEdge(double x0, double y0, double x1, double y1, int n, double amplitude)
+    {
+        std::string wkt;
+        for(int i = 1; i < n; i++) {
+            double t = static_cast<double>(i) / n;
+            double offset = (i % 2 == 0 ? 1 : -1) * amplitude;
+            double x = x0 + t * (x1 - x0) - offset * (y1 - y0) / 100;
+            double y = y0 + t * (y1 - y0) + offset * (x1 - x0) / 100;
+            wkt += ", " + std::to_string(x) + " " + std::to_string(y);
+        }
+        return wkt;
+    }
+};
+
+typedef test_group<test_coveragesimp_data> group;
+typedef group::object object;
+
+group test_coveragesimp_group("geos::simplify::CoverageSimplifier");
+
+//
+// Test Cases
+//
+
+// 1 - The shared edge is simplified once for both polygons
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::string edge = wigglyEdge(10, 0, 10, 10, 20, 0.5);
+    auto input = read({
+        "POLYGON ((0 0, 10 0" + edge + ", 10 10, 0 10, 0 0))",
+        "POLYGON ((10 0, 20 0, 20 10, 10 10" + wigglyEdge(10, 10, 10, 0, 20, -0.5) + ", 10 0))"
+    });
+
+    auto result = CoverageSimplifier::simplify(pointers(input), 1.0);
+    checkCoverage(input, result);
+    ensure_equals(result[0]->getNumPoints(), 5u);
+    ensure_equals(result[1]->getNumPoints(), 5u);
+    ensure_equals(result[0]->intersection(result[1].get())->getLength(), 10.0);
+}
+
+// 2 - Edges are split at nodes, which stay in place
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto input = read({
+        "POLYGON ((0 0, 5 0.1, 10 0, 10 5, 10.1 10, 5 10.1, 0 10, 0 0))",
+        "POLYGON ((10 0, 20 0, 20 10, 10.1 10, 10 5, 10 0))",
+        "POLYGON ((0 10, 5 10.1, 10.1 10, 20 10, 20 20, 0 20, 0 10))"
+    });
+
+    auto result = CoverageSimplifier::simplify(pointers(input), 1.0);
+    checkCoverage(input, result);
+    auto expected = wktreader.read("POLYGON ((0 0, 10 0, 10.1 10, 0 10, 0 0))");
+    ensure_equals(result[0]->getNumPoints(), 5u);
+    ensure(result[0]->toString(), result[0]->equals(expected.get()));
+}
+
+// 3 - A hole filled by an island shares a ring without nodes
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::string island = "2 2, 3 1.9, 4 2, 4.1 3, 4 4, 3 4.1, 2 4, 1.9 3, 2 2";
+    auto input = read({
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (" + island + "))",
+        "POLYGON ((" + island + "))"
+    });
+
+    auto result = CoverageSimplifier::simplify(pointers(input), 0.5);
+    checkCoverage(input, result);
+    const geos::geom::Polygon* outer = dynamic_cast<const geos::geom::Polygon*>(result[0].get());
+    ensure_equals(outer->getNumInteriorRing(), 1u);
+    ensure(result[1]->getNumPoints() < input[1]->getNumPoints());
+    ensure(outer->getInteriorRingN(0)->equals(result[1]->getBoundary().get()));
+}
+
+// 4 - Edges which would sweep over another edge keep more vertices
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::string island = "45 10.5, 55 10.5, 55 11, 45 11, 45 10.5";
+    auto input = read({
+        "POLYGON ((0 0, 50 -1, 100 0, 100 10, 50 12, 0 10, 0 0), (" + island + "))",
+        "POLYGON ((" + island + "))"
+    });
+
+    // the top vertex is kept, the bottom one is not
+    auto result = CoverageSimplifier::simplify(pointers(input), 5.0);
+    checkCoverage(input, result);
+    const geos::geom::Polygon* outer = dynamic_cast<const geos::geom::Polygon*>(result[0].get());
+    ensure_equals(outer->getNumInteriorRing(), 1u);
+    ensure_equals(outer->getExteriorRing()->getNumPoints(), 6u);
+    ensure(outer->getExteriorRing()->getEnvelopeInternal()->getMaxY() == 12);
+}
+
+// 5 - Several threads give the same result
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::vector<std::string> wkts;
+    const int n = 6;
+    for(int i = 0; i < n; i++) {
+        for(int j = 0; j < n; j++) {
+            double x = 10 * i;
+            double y = 10 * j;
+            std::string wkt = "POLYGON ((" + std::to_string(x) + " " + std::to_string(y);
+            wkt += wigglyEdge(x, y, x + 10, y, 10, (j % 2 ? 1 : -1) * 0.3);
+            wkt += ", " + std::to_string(x + 10) + " " + std::to_string(y);
+            wkt += wigglyEdge(x + 10, y, x + 10, y + 10, 10, ((i + 1) % 2 ? 1 : -1) * 0.3);
+            wkt += ", " + std::to_string(x + 10) + " " + std::to_string(y + 10);
+            wkt += wigglyEdge(x + 10, y + 10, x, y + 10, 10, ((j + 1) % 2 ? -1 : 1) * 0.3);
+            wkt += ", " + std::to_string(x) + " " + std::to_string(y + 10);
+            wkt += wigglyEdge(x, y + 10, x, y, 10, (i % 2 ? -1 : 1) * 0.3);
+            wkt += ", " + std::to_string(x) + " " + std::to_string(y) + "))";
+            wkts.push_back(wkt);
+        }
+    }
+    auto input = read(wkts);
+
+    CoverageSimplifier simp(pointers(input));
+    simp.setDistanceTolerance(1.0);
+    auto result = simp.getResult();
+    checkCoverage(input, result);
+
+    CoverageSimplifier simpThreads(pointers(input));
+    simpThreads.setDistanceTolerance(1.0);
+    simpThreads.setNumThreads(4);
+    auto resultThreads = simpThreads.getResult();
+    for(std::size_t i = 0; i < result.size(); i++) {
+        ensure(result[i]->equalsExact(resultThreads[i].get()));
+        ensure_equals(result[i]->getNumPoints(), 5u);
+    }
+}
+
+// 6 - MultiPolygons, empty and non-polygonal inputs
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto input = read({
+        "MULTIPOLYGON (((0 0, 5 0.1, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0)))",
+        "POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))",
+        "POLYGON EMPTY"
+    });
+    auto result = CoverageSimplifier::simplify(pointers(input), 1.0);
+    checkCoverage(input, result);
+    ensure_equals(result[0]->getGeometryTypeId(), geos::geom::GEOS_MULTIPOLYGON);
+    ensure_equals(result[0]->getNumPoints(), 10u);
+    ensure(result[2]->isEmpty());
+
+    auto line = wktreader.read("LINESTRING (0 0, 1 1)");
+    std::vector<const Geometry*> bad{ line.get() };
+    try {
+        CoverageSimplifier::simplify(bad, 1.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+// 7 - An island which collapses at every tolerance gets its input points
+// back, and the edge which swept over them is checked again
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::string island = "10 2, 10.05 -2, 10.1 2, 10.1 12, 10 12, 10 2";
+    auto input = read({
+        "POLYGON ((0 0, 10 -3, 20 0, 1000 0, 1000 1000, 0 1000, 0 0), (" + island + "))",
+        "POLYGON ((0 0, 0 -1000, 20 -1000, 20 0, 10 -3, 0 0))",
+        "POLYGON ((" + island + "))"
+    });
+
+    auto result = CoverageSimplifier::simplify(pointers(input), 100.0);
+    checkCoverage(input, result);
+    ensure(result[2]->equalsExact(input[2].get()));
+    ensure_equals(result[2]->intersection(result[1].get())->getArea(), 0.0);
+}
+
+} // namespace tut
@@ -0,0 +1,153 @@
+//
+// Test Suite for geos::simplify::MultiResolutionSimplifier
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/simplify/DouglasPeuckerLineSimplifier.h>
+#include <geos/simplify/DouglasPeuckerSimplifier.h>
+#include <geos/simplify/MultiResolutionSimplifier.h>
+#include <geos/simplify/VWSimplifier.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <limits>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace tut {
+using namespace geos::simplify;
+
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_multiressimp_data {
+    geos::io::WKTReader wktreader;
+
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+
+    std::vector<double> tolerances{ 0.0, 0.05, 0.1, 0.3, 0.5, 1.0, 2.0, 5.0, 10.0, 100.0 };
+
+    static std::string
+    wavyRing(double cx, double cy, double r, int n, int waves)
+    {
+        std::string wkt = "(";
+        for(int i = 0; i <= n; i++) {
+            double angle = 2 * M_PI * (i % n) / n;
+            double rr = r + 0.1 * r * std::sin(waves * angle) + 0.02 * r * std::cos(7 * waves * angle);
+            if(i > 0) {
+                wkt += ", ";
+            }
+            wkt += std::to_string(cx + rr * std::cos(angle)) + " " + std::to_string(cy + rr * std::sin(angle));
+        }
+        return wkt + ")";
+    }
+
+    // Checks that each level is the result of the single level simplifier
+    void
+    checkLevels(const std::string& wkt)
+    {
+        GeomPtr g(wktreader.read(wkt));
+
+        MultiResolutionSimplifier dp(g.get());
+        auto dpLevels = dp.getResultGeometries(tolerances);
+        MultiResolutionSimplifier vw(g.get(), MultiResolutionSimplifier::VISVALINGAM_WHYATT);
+        auto vwLevels = vw.getResultGeometries(tolerances);
+
+        ensure_equals(dpLevels.size(), tolerances.size());
+        for(std::size_t i = 0; i < tolerances.size(); i++) {
+            auto expected = DouglasPeuckerSimplifier::simplify(g.get(), tolerances[i]);
+            ensure("DP " + std::to_string(tolerances[i]) + ": " + dpLevels[i]->toString(),
+                   dpLevels[i]->equalsExact(expected.get()));
+
+            expected = VWSimplifier::simplify(g.get(), tolerances[i]);
+            ensure("VW " + std::to_string(tolerances[i]) + ": " + vwLevels[i]->toString(),
+                   vwLevels[i]->equalsExact(expected.get()));
+        }
+    }
+};
+
+typedef test_group<test_multiressimp_data> group;
+typedef group::object object;
+
+group test_multiressimp_group("geos::simplify::MultiResolutionSimplifier");
+
+//
+// Test Cases
+//
+
+// 1 - Significance of the points of a line
+template<>
+template<>
+void object::test<1>
+()
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<geos::geom::Coordinate> pts{ {0, 0}, {1, -1}, {2, 1}, {10, 0} };
+    auto sig = DouglasPeuckerLineSimplifier::computeSignificance(pts);
+    ensure_equals(sig.size(), 4u);
+    ensure_equals(sig[0], inf);
+    ensure_equals(sig[1], 1.0);
+    // farther from its section than the point splitting the enclosing one
+    ensure_equals(sig[2], 1.0);
+    ensure_equals(sig[3], inf);
+
+    ensure(DouglasPeuckerLineSimplifier::computeSignificance({}).empty());
+}
+
+// 2 - Lines
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::string wkt = "LINESTRING (";
+    for(int i = 0; i < 300; i++) {
+        if(i > 0) {
+            wkt += ", ";
+        }
+        wkt += std::to_string(i * 0.1) + " " + std::to_string(std::sin(i * 0.05) * 5 + std::sin(i * 0.9) * 0.3);
+    }
+    wkt += ")";
+    checkLevels(wkt);
+    checkLevels("MULTILINESTRING ((0 0, 1 0.1, 2 0, 3 5, 4 0), (10 10, 11 11, 12 10, 13 13, 14 10))");
+    checkLevels("LINESTRING (0 0, 10 0, 10 10, 0 10, 0 0)");
+}
+
+// 3 - Polygons are repaired as by the single level simplifiers
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkLevels("POLYGON (" + wavyRing(0, 0, 10, 200, 5) + ", " + wavyRing(1, 0, 4, 100, 3) + ")");
+    checkLevels("MULTIPOLYGON ((" + wavyRing(0, 0, 10, 200, 5) + "), (" + wavyRing(30, 0, 5, 60, 2) + "))");
+    checkLevels("GEOMETRYCOLLECTION (POINT (1 1), LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0), POLYGON ("
+                + wavyRing(50, 50, 3, 40, 3) + "))");
+}
+
+// 4 - Empty input and bad tolerance
+template<>
+template<>
+void object::test<4>
+()
+{
+    GeomPtr g(wktreader.read("POLYGON EMPTY"));
+    MultiResolutionSimplifier simp(g.get());
+    ensure(simp.getResultGeometry(1.0)->isEmpty());
+
+    g = wktreader.read("LINESTRING (0 0, 1 1)");
+    MultiResolutionSimplifier simp2(g.get());
+    try {
+        simp2.getResultGeometry(-1.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,193 @@
+//
+// Test Suite for geos::simplify::VWSimplifier
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/simplify/VWSimplifier.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <string>
+#include <memory>
+
+namespace tut {
+using namespace geos::simplify;
+
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_vwsimp_data {
+    geos::io::WKTReader wktreader;
+
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+
+    GeomPtr
+    simplify(const std::string& wkt, double tolerance, bool isPreserveTopology = false)
+    {
+        GeomPtr g(wktreader.read(wkt));
+        VWSimplifier simp(g.get());
+        simp.setDistanceTolerance(tolerance);
+        simp.setPreserveTopology(isPreserveTopology);
+        return simp.getResultGeometry();
+    }
+
+    void
+    checkSimplify(const std::string& wkt, double tolerance, bool isPreserveTopology,
+                  const std::string& wktExpected)
+    {
+        GeomPtr result = simplify(wkt, tolerance, isPreserveTopology);
+        GeomPtr expected(wktreader.read(wktExpected));
+        ensure_equals_exact_geometry(result.get(), expected.get(), 0);
+    }
+
+    void
+    ensure_equals_exact_geometry(const geos::geom::Geometry* g1,
+                                 const geos::geom::Geometry* g2, double tolerance)
+    {
+        ensure("result " + g1->toString() + " != " + g2->toString(),
+               g1->equalsExact(g2, tolerance));
+    }
+};
+
+typedef test_group<test_vwsimp_data> group;
+typedef group::object object;
+
+group test_vwsimp_group("geos::simplify::VWSimplifier");
+
+//
+// Test Cases
+//
+
+// 1 - Vertices with a small effective area are removed
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkSimplify("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)", 1.0, false,
+                  "LINESTRING (0 0, 2 0, 3 5, 4 0)");
+    checkSimplify("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)", 0.0, false,
+                  "LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)");
+    checkSimplify("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)", 100.0, false,
+                  "LINESTRING (0 0, 4 0)");
+}
+
+// 2 - Vertex budget
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::string wkt = "LINESTRING (";
+    for(int i = 0; i < 200; i++) {
+        if(i > 0) {
+            wkt += ", ";
+        }
+        double angle = 2 * M_PI * i / 200.0;
+        wkt += std::to_string(100 * std::cos(angle) + std::sin(13 * angle))
+               + " " + std::to_string(100 * std::sin(angle));
+    }
+    wkt += ")";
+    GeomPtr g(wktreader.read(wkt));
+
+    VWSimplifier simp(g.get());
+    simp.setMaxVertices(10);
+    GeomPtr result = simp.getResultGeometry();
+    ensure_equals(result->getNumPoints(), 10u);
+
+    // the tolerance still applies when the budget is met
+    simp.setDistanceTolerance(100.0);
+    result = simp.getResultGeometry();
+    ensure(result->getNumPoints() < 10u);
+}
+
+// 3 - The budget is shared by all the lines
+template<>
+template<>
+void object::test<3>
+()
+{
+    GeomPtr g(wktreader.read("MULTILINESTRING ((0 0, 1 0, 2 0, 3 0, 4 0), (0 10, 5 15, 10 10, 15 15, 20 10))"));
+    VWSimplifier simp(g.get());
+    simp.setMaxVertices(7);
+    GeomPtr expected(wktreader.read("MULTILINESTRING ((0 0, 4 0), (0 10, 5 15, 10 10, 15 15, 20 10))"));
+    ensure_equals_exact_geometry(simp.getResultGeometry().get(), expected.get(), 0);
+}
+
+// 4 - Rings keep 4 points
+template<>
+template<>
+void object::test<4>
+()
+{
+    GeomPtr result = simplify("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", 1000.0);
+    ensure(result->isValid());
+    ensure_equals(result->getNumPoints(), 4u);
+
+    result = simplify("LINESTRING (0 0, 10 0, 10 10, 0 10, 0 0)", 1000.0, true);
+    ensure_equals(result->getNumPoints(), 4u);
+}
+
+// 5 - Topology preservation keeps lines from crossing
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::string wkt = "MULTILINESTRING ((0 0, 50 10, 100 0), (40 3, 60 3))";
+    checkSimplify(wkt, 30.0, false, "MULTILINESTRING ((0 0, 100 0), (40 3, 60 3))");
+    checkSimplify(wkt, 30.0, true, wkt);
+
+    // points are obstacles too
+    wkt = "GEOMETRYCOLLECTION (LINESTRING (0 0, 50 10, 100 0), POINT (50 5))";
+    checkSimplify(wkt, 30.0, false, "GEOMETRYCOLLECTION (LINESTRING (0 0, 100 0), POINT (50 5))");
+    checkSimplify(wkt, 30.0, true, wkt);
+
+    // lines touching at a vertex keep touching
+    wkt = "MULTILINESTRING ((0 0, 50 10, 100 0), (50 10, 50 50))";
+    checkSimplify(wkt, 30.0, true, wkt);
+}
+
+// 6 - Topology preservation keeps holes inside their shell
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::string wkt = "POLYGON ((0 0, 100 0, 100 10, 50 12, 0 10, 0 0), (45 10.5, 55 10.5, 55 11, 45 11, 45 10.5))";
+    GeomPtr result = simplify(wkt, 20.0, true);
+    ensure(result->isValid());
+    const geos::geom::Polygon* poly = dynamic_cast<const geos::geom::Polygon*>(result.get());
+    ensure(poly != nullptr);
+    ensure_equals(poly->getNumInteriorRing(), 1u);
+    ensure(result->getNumPoints() < 11u);
+
+    result = simplify(wkt, 20.0);
+    ensure(result->isValid());
+}
+
+// 7 - Empty input and bad tolerance
+template<>
+template<>
+void object::test<7>
+()
+{
+    ensure(simplify("POLYGON EMPTY", 1.0)->isEmpty());
+    ensure(simplify("MULTILINESTRING EMPTY", 1.0, true)->isEmpty());
+
+    GeomPtr g(wktreader.read("LINESTRING (0 0, 1 1)"));
+    VWSimplifier simp(g.get());
+    try {
+        simp.setDistanceTolerance(-1.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,253 @@
+//
+// Test Suite for geos::triangulate::CompactDelaunayTriangulator
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/CompactDelaunayTriangulator.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/algorithm/ConvexHull.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/io/WKTReader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace geos::triangulate;
+using namespace geos::geom;
+using namespace geos::io;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_compactdelaunay_data {
+    typedef CompactDelaunayTriangulator CDT;
+
+    const GeometryFactory& geomFact;
+    WKTReader reader;
+
+    test_compactdelaunay_data()
+        : geomFact(*GeometryFactory::getDefaultInstance())
+    {}
+
+    std::unique_ptr<CoordinateSequence>
+    randomSites(std::size_t n)
+    {
+        std::default_random_engine e(31);
+        std::uniform_real_distribution<> dis(0, 1000);
+        std::vector<Coordinate> coords(n);
+        for(Coordinate& c : coords) {
+            c = Coordinate(dis(e), dis(e));
+        }
+        return std::unique_ptr<CoordinateSequence>(new CoordinateArraySequence(std::move(coords)));
+    }
+
+    double
+    cross(CDT& cdt, std::size_t a, std::size_t b, std::size_t c)
+    {
+        return (cdt.getX(b) - cdt.getX(a)) * (cdt.getY(c) - cdt.getY(a))
+               - (cdt.getY(b) - cdt.getY(a)) * (cdt.getX(c) - cdt.getX(a));
+    }
+
+    // Checks the half-edge links, the orientation of the triangles
+    // and the empty circumcircle of every interior edge
+    void
+    checkTriangulation(CDT& cdt)
+    {
+        const std::vector<std::uint32_t>& tri = cdt.getTriangleVertices();
+        const std::vector<std::uint32_t>& he = cdt.getHalfEdges();
+        ensure_equals(he.size(), tri.size());
+
+        std::size_t numHullEdges = 0;
+        for(std::size_t e = 0; e < tri.size(); e++) {
+            std::size_t t = e - e % 3;
+            if(e == t) {
+                ensure("triangle is not CCW", cross(cdt, tri[t], tri[t + 1], tri[t + 2]) > 0);
+            }
+            std::uint32_t opp = he[e];
+            if(opp == CDT::NONE) {
+                numHullEdges++;
+                continue;
+            }
+            ensure_equals(he[opp], e);
+            ensure_equals(tri[opp], tri[CDT::nextHalfEdge(e)]);
+            ensure_equals(tri[CDT::nextHalfEdge(opp)], tri[e]);
+
+            // vertex opposite to the edge in the adjacent triangle
+            Coordinate a(cdt.getX(tri[e]), cdt.getY(tri[e]));
+            Coordinate b(cdt.getX(tri[CDT::nextHalfEdge(e)]), cdt.getY(tri[CDT::nextHalfEdge(e)]));
+            Coordinate c(cdt.getX(tri[CDT::prevHalfEdge(e)]), cdt.getY(tri[CDT::prevHalfEdge(e)]));
+            std::uint32_t pi = tri[CDT::prevHalfEdge(opp)];
+            Coordinate p(cdt.getX(pi), cdt.getY(pi));
+            ensure("edge is not locally Delaunay", !isStrictlyInCircle(a, b, c, p));
+        }
+        ensure_equals(numHullEdges, cdt.getHull().size());
+    }
+
+    static bool
+    isStrictlyInCircle(const Coordinate& a, const Coordinate& b, const Coordinate& c,
+                       const Coordinate& p)
+    {
+        double adx = a.x - p.x, ady = a.y - p.y;
+        double bdx = b.x - p.x, bdy = b.y - p.y;
+        double cdx = c.x - p.x, cdy = c.y - p.y;
+        double det = (adx * adx + ady * ady) * (bdx * cdy - cdx * bdy)
+                     - (bdx * bdx + bdy * bdy) * (adx * cdy - cdx * ady)
+                     + (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady);
+        double m = std::max({ std::fabs(adx), std::fabs(ady), std::fabs(bdx),
+                              std::fabs(bdy), std::fabs(cdx), std::fabs(cdy) });
+        return det > 1e-12 * m * m * m * m;
+    }
+};
+
+typedef test_group<test_compactdelaunay_data> group;
+typedef group::object object;
+
+group test_compactdelaunay_group("geos::triangulate::CompactDelaunayTriangulator");
+
+//
+// Test Cases
+//
+
+// 1 - Fewer than three sites give no triangles
+template<>
+template<>
+void object::test<1>
+()
+{
+    CDT empty(nullptr, 0);
+    ensure_equals(empty.getNumTriangles(), 0u);
+    ensure(empty.getHull().empty());
+
+    double xy[] = { 1, 1, 2, 2 };
+    CDT two(xy, 2);
+    ensure_equals(two.getNumTriangles(), 0u);
+    ensure_equals(two.getNumEdges(), 0u);
+    ensure_equals(two.getHull().size(), 2u);
+}
+
+// 2 - Collinear sites give no triangles, the hull is the ordered sites
+template<>
+template<>
+void object::test<2>
+()
+{
+    double xy[] = { 2, 2, 0, 0, 3, 3, 1, 1, 2, 2 };
+    CDT cdt(xy, 5);
+    ensure_equals(cdt.getNumTriangles(), 0u);
+    const std::vector<std::uint32_t>& hull = cdt.getHull();
+    ensure_equals(hull.size(), 4u);
+    ensure_equals(hull[0], 1u);
+    ensure_equals(hull[1], 3u);
+    ensure_equals(hull[2], 0u);
+    ensure_equals(hull[3], 2u);
+}
+
+// 3 - Square with a centre point
+template<>
+template<>
+void object::test<3>
+()
+{
+    double xy[] = { 0, 0, 10, 0, 10, 10, 0, 10, 5, 5 };
+    CDT cdt(xy, 5);
+    ensure_equals(cdt.getNumTriangles(), 4u);
+    ensure_equals(cdt.getNumEdges(), 8u);
+    ensure_equals(cdt.getHull().size(), 4u);
+    checkTriangulation(cdt);
+
+    auto expected = reader.read(
+                        "GEOMETRYCOLLECTION (POLYGON ((0 0, 5 5, 0 10, 0 0)), POLYGON ((0 0, 10 0, 5 5, 0 0)), POLYGON ((0 10, 5 5, 10 10, 0 10)), POLYGON ((5 5, 10 0, 10 10, 5 5)))");
+    auto tris = cdt.getTriangles(geomFact);
+    tris->normalize();
+    expected->normalize();
+    ensure(tris->equalsExact(expected.get()));
+}
+
+// 4 - Random sites cover the convex hull with 2n - 2 - h triangles
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto sites = randomSites(5000);
+    CDT cdt(*sites);
+    checkTriangulation(cdt);
+
+    std::size_t h = cdt.getHull().size();
+    ensure_equals(cdt.getNumTriangles(), 2 * sites->size() - 2 - h);
+
+    std::unique_ptr<Geometry> mp(geomFact.createMultiPoint(*sites));
+    geos::algorithm::ConvexHull hull(mp.get());
+    auto hullGeom = hull.getConvexHull();
+    ensure_equals(h, hullGeom->getNumPoints() - 1);
+
+    auto tris = cdt.getTriangles(geomFact);
+    ensure_distance(tris->getArea(), hullGeom->getArea(), 1e-6);
+}
+
+// 5 - Duplicate sites are ignored
+template<>
+template<>
+void object::test<5>
+()
+{
+    double xy[] = { 0, 0, 10, 0, 10, 10, 0, 0, 10, 10, 0, 10, 0, 10 };
+    CDT cdt(xy, 7);
+    ensure_equals(cdt.getNumTriangles(), 2u);
+    ensure_equals(cdt.getHull().size(), 4u);
+    checkTriangulation(cdt);
+}
+
+// 6 - Coordinate buffers match the index arrays
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto sites = randomSites(200);
+    CDT cdt(*sites);
+
+    const std::vector<std::uint32_t>& tri = cdt.getTriangleVertices();
+    std::vector<double> buf(6 * cdt.getNumTriangles());
+    cdt.getTriangleCoordinates(buf.data());
+    for(std::size_t e = 0; e < tri.size(); e++) {
+        ensure_equals(buf[2 * e], sites->getX(tri[e]));
+        ensure_equals(buf[2 * e + 1], sites->getY(tri[e]));
+    }
+
+    std::vector<double> edgeBuf(4 * cdt.getNumEdges());
+    cdt.getEdgeCoordinates(edgeBuf.data());
+    auto edges = cdt.getEdges(geomFact);
+    ensure_equals(edges->getNumGeometries(), cdt.getNumEdges());
+    ensure_equals(edges->getNumGeometries(), 3 * sites->size() - 3 - cdt.getHull().size());
+}
+
+// 7 - Same triangulation as the QuadEdge builder on a grid-free input
+template<>
+template<>
+void object::test<7>
+()
+{
+    auto sites = reader.read("MULTIPOINT ((10 10), (10 20), (20 20), (20 10), (20 0), (10 0), (0 0), (0 10), (0 20), (15 7))");
+    auto seq = sites->getCoordinates();
+    CDT cdt(*seq);
+    checkTriangulation(cdt);
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(*sites);
+    auto expected = builder.getTriangles(geomFact);
+    auto tris = cdt.getTriangles(geomFact);
+    ensure_equals(tris->getNumGeometries(), expected->getNumGeometries());
+    ensure_distance(tris->getArea(), expected->getArea(), 1e-9);
+}
+
+} // namespace tut
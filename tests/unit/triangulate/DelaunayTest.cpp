@@ -16,6 +16,8 @@
 #include <geos/geom/CoordinateArraySequence.h>
 //#include <stdio.h>
 
+#include <random>
+
 using namespace geos::triangulate;
 using namespace geos::triangulate::quadedge;
 using namespace geos::geom;
@@ -257,4 +259,61 @@ void object::test<12>
     }
 }
 
+// 13 - Hilbert insertion order keeps all vertices, nearby ones together
+template<>
+template<>
+void object::test<13>
+()
+{
+    IncrementalDelaunayTriangulator::VertexList vertices;
+    for(int i = 0; i < 16; i++) {
+        for(int j = 0; j < 16; j++) {
+            vertices.emplace_back(i, j);
+        }
+    }
+    IncrementalDelaunayTriangulator::VertexList sorted(vertices);
+    DelaunayTriangulationBuilder::sortForInsertion(sorted);
+
+    ensure_equals(sorted.size(), vertices.size());
+    for(std::size_t i = 1; i < sorted.size(); i++) {
+        // Consecutive cells of a Hilbert curve are adjacent
+        ensure_equals(sorted[i].getCoordinate().distance(sorted[i - 1].getCoordinate()), 1.0);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(vertices.begin(), vertices.end());
+    for(std::size_t i = 0; i < sorted.size(); i++) {
+        ensure(sorted[i].equals(vertices[i]));
+    }
+}
+
+// 14 - Random sites in Hilbert order give the same triangulation
+template<>
+template<>
+void object::test<14>
+()
+{
+    std::default_random_engine e(12345);
+    std::uniform_real_distribution<> dis(0, 100);
+    std::vector<Coordinate> coords(5000);
+    for(Coordinate& c : coords) {
+        c = Coordinate(dis(e), dis(e));
+    }
+    CoordinateArraySequence seq(new std::vector<Coordinate>(coords));
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder lexBuilder;
+    lexBuilder.setSites(seq);
+    auto expected = lexBuilder.getTriangles(geomFact);
+
+    DelaunayTriangulationBuilder builder;
+    builder.setHilbertOrder(true);
+    builder.setSites(seq);
+    auto triangles = builder.getTriangles(geomFact);
+
+    expected->normalize();
+    triangles->normalize();
+    ensure_equals(triangles->getNumGeometries(), expected->getNumGeometries());
+    ensure(triangles->equalsExact(expected.get()));
+}
+
 } // namespace tut
@@ -0,0 +1,217 @@
+//
+// Test Suite for geos::triangulate::PolygonTriangulator
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/PolygonTriangulator.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <cmath>
+#include <map>
+#include <utility>
+
+using namespace geos::triangulate;
+using namespace geos::geom;
+using namespace geos::io;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_polygontriangulator_data {
+    WKTReader reader;
+
+    void
+    checkTriangulation(const std::string& wkt, std::size_t expectedNumTriangles, bool isDelaunay = false)
+    {
+        auto geom = reader.read(wkt);
+        PolygonTriangulator triangulator(*geom);
+        triangulator.setDelaunay(isDelaunay);
+
+        ensure_equals(triangulator.getNumTriangles(), expectedNumTriangles);
+
+        const std::vector<std::uint32_t>& tri = triangulator.getTriangleIndices();
+        for(std::uint32_t v : tri) {
+            ensure(v < triangulator.getNumVertices());
+        }
+
+        auto result = triangulator.getResult();
+        ensure_equals(result->getNumGeometries(), expectedNumTriangles);
+        ensure_distance(result->getArea(), geom->getArea(), 1e-9 * geom->getArea());
+        // triangles do not overlap and cover the input
+        for(std::size_t i = 0; i < result->getNumGeometries(); i++) {
+            const Geometry* t = result->getGeometryN(i);
+            ensure("triangle is not CCW", signedArea(t) > 0);
+            ensure(geom->covers(t->getCentroid().get()));
+        }
+    }
+
+    static double
+    signedArea(const Geometry* tri)
+    {
+        auto pts = tri->getCoordinates();
+        const Coordinate& a = pts->getAt(0);
+        const Coordinate& b = pts->getAt(1);
+        const Coordinate& c = pts->getAt(2);
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    }
+};
+
+typedef test_group<test_polygontriangulator_data> group;
+typedef group::object object;
+
+group test_polygontriangulator_group("geos::triangulate::PolygonTriangulator");
+
+//
+// Test Cases
+//
+
+// 1 - Square, indexes of the input vertices
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", 2);
+
+    auto geom = reader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    PolygonTriangulator triangulator(*geom);
+    ensure_equals(triangulator.getNumVertices(), 5u);
+    for(std::uint32_t v : triangulator.getTriangleIndices()) {
+        // the closing coordinate is never used
+        ensure(v < 4);
+    }
+}
+
+// 2 - Clockwise shell gives counter-clockwise triangles
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 0 10, 5 5, 10 10, 10 0, 0 0))", 3);
+}
+
+// 3 - Polygon with holes: n + 2h - 2 triangles
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (10 10, 10 40, 40 40, 40 10, 10 10), (60 60, 60 90, 90 90, 90 60, 60 60))",
+                       12 + 2 * 2 - 2);
+}
+
+// 4 - Vertex indexes run across the rings of a MultiPolygon
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto geom = reader.read("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0), (22 2, 22 8, 28 8, 28 2, 22 2)))");
+    PolygonTriangulator triangulator(*geom);
+    ensure_equals(triangulator.getNumVertices(), 4u + 5u + 5u);
+    ensure_equals(triangulator.getNumTriangles(), 1u + 8u);
+
+    const std::vector<std::uint32_t>& tri = triangulator.getTriangleIndices();
+    // the first polygon comes first
+    ensure_equals(tri[0] + tri[1] + tri[2], 0u + 1u + 2u);
+    for(std::size_t i = 3; i < tri.size(); i++) {
+        ensure(tri[i] >= 4 && tri[i] != 8 && tri[i] != 13);
+    }
+    checkTriangulation(geom->toString(), 9);
+}
+
+// 5 - Hole touching the shell, which makes a ring of 8 vertices
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkTriangulation("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (0 5, 5 8, 5 2, 0 5))", 6);
+}
+
+// 6 - Large polygon, clipped with the Z-order index
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::string wkt = "POLYGON ((";
+    const std::size_t n = 500;
+    for(std::size_t i = 0; i <= n; i++) {
+        double angle = 2 * M_PI * static_cast<double>(i % n) / n;
+        double r = (i % 2 == 0) ? 100 : 60 + 30 * std::sin(7 * angle);
+        if(i > 0) {
+            wkt += ", ";
+        }
+        wkt += std::to_string(r * std::cos(angle)) + " " + std::to_string(r * std::sin(angle));
+    }
+    wkt += "), (-10 -10, -10 10, 10 10, 10 -10, -10 -10))";
+    checkTriangulation(wkt, n + 4 + 2 - 2);
+    checkTriangulation(wkt, n + 4 + 2 - 2, true);
+}
+
+// 7 - Delaunay refinement flips the interior edges only
+template<>
+template<>
+void object::test<7>
+()
+{
+    const char* wkt = "POLYGON ((0 0, 100 0, 100 1, 50 2, 0 1, 0 0))";
+    checkTriangulation(wkt, 3, true);
+
+    auto geom = reader.read(wkt);
+    PolygonTriangulator triangulator(*geom);
+    triangulator.setDelaunay(true);
+    auto result = triangulator.getResult();
+
+    // every interior edge is locally Delaunay
+    const std::vector<std::uint32_t>& tri = triangulator.getTriangleIndices();
+    auto pt = [&geom](std::uint32_t v) {
+        return geom->getCoordinates()->getAt(v);
+    };
+    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> opposite;
+    for(std::size_t t = 0; t < tri.size(); t += 3) {
+        for(std::size_t k = 0; k < 3; k++) {
+            opposite[std::make_pair(tri[t + k], tri[t + (k + 1) % 3])] = tri[t + (k + 2) % 3];
+        }
+    }
+    for(const auto& e : opposite) {
+        auto twin = opposite.find(std::make_pair(e.first.second, e.first.first));
+        if(twin == opposite.end()) {
+            continue;
+        }
+        ensure(!geos::geom::TrianglePredicate::isInCircleRobust(
+                   pt(e.first.first), pt(e.first.second), pt(e.second), pt(twin->second)));
+    }
+}
+
+// 8 - Empty and non-polygonal inputs
+template<>
+template<>
+void object::test<8>
+()
+{
+    auto empty = reader.read("POLYGON EMPTY");
+    PolygonTriangulator triangulator(*empty);
+    ensure_equals(triangulator.getNumTriangles(), 0u);
+    ensure(triangulator.getResult()->isEmpty());
+
+    auto line = reader.read("LINESTRING (0 0, 1 1)");
+    try {
+        PolygonTriangulator bad(*line);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -17,8 +17,10 @@
 #include <geos/geom/GeometryFactory.h>
 
 #include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Point.h>
 //#include <stdio.h>
 #include <iostream>
+#include <random>
 using namespace std;
 using namespace geos::triangulate;
 using namespace geos::triangulate::quadedge;
@@ -59,7 +61,7 @@ readTextOrHex(const char* wkt)
 
 //helper function for funning triangulation
 void
-runVoronoi(const char* sitesWkt, const char* expectedWkt, const double tolerance)
+runVoronoi(const char* sitesWkt, const char* expectedWkt, const double tolerance, bool isOrdered = false)
 {
     WKTWriter writer;
     geos::triangulate::VoronoiDiagramBuilder builder;
@@ -71,6 +73,7 @@ runVoronoi(const char* sitesWkt, const char* expectedWkt, const double tolerance
 
     //set Tolerance:
     builder.setTolerance(tolerance);
+    builder.setOrdered(isOrdered);
     results = builder.getDiagram(geomFact);
 
     results->normalize();
@@ -231,6 +234,141 @@ void object::test<10>
         "GEOMETRYCOLLECTION (POLYGON ((193602.7711332133 469345.898980198, 193604.4418848486 469348.6016666667, 193605.9466666667 469348.6016666667, 193605.9466666667 469347.7638144172, 193603.2325 469345.391, 193602.9475 469345.391, 193602.8169643859 469345.5051185583, 193602.7711332133 469345.898980198)), POLYGON ((193601.8569454336 469344.9208636514, 193601.865 469344.9666851849, 193602.2037556305 469345.52375, 193602.2585544897 469345.5401343054, 193602.4642389841 469345.148354316, 193602.4577210526 469345.065, 193602.0579897448 469344.3617689955, 193601.8569454336 469344.9208636514)), POLYGON ((193601.2583333333 469342.0043333333, 193601.2583333333 469345.18625, 193601.5616666667 469345.18625, 193601.8569454336 469344.9208636514, 193602.0579897448 469344.3617689955, 193602.0222507725 469343.9301164729, 193601.5161595486 469342.0043333333, 193601.2583333333 469342.0043333333)), POLYGON ((193600.8486366758 469348.6016666667, 193604.4418848486 469348.6016666667, 193602.7711332133 469345.898980198, 193602.3274661311 469345.7182269423, 193601.865 469346.1338755144, 193601.5616666667 469346.6791265432, 193600.8486366758 469348.6016666667)), POLYGON ((193599.3943641253 469348.6016666667, 193600.8486366758 469348.6016666667, 193601.5616666667 469346.6791265432, 193601.5616666667 469345.52375, 193601.2583333333 469345.52375, 193600.955 469345.7963755144, 193599.3943641253 469348.6016666667)), POLYGON ((193602.4577210526 469345.065, 193602.4642389841 469345.148354316, 193602.8169643859 469345.5051185583, 193602.9475 469345.391, 193602.9475 469345.065, 193602.4577210526 469345.065)), POLYGON ((193602.2585544897 469345.5401343054, 193602.3274661311 469345.7182269423, 193602.7711332133 469345.898980198, 193602.8169643859 469345.5051185583, 193602.4642389841 469345.148354316, 193602.2585544897 469345.5401343054)), POLYGON ((193602.0222507725 469343.9301164729, 193602.0579897448 469344.3617689955, 193602.4577210526 469345.065, 193602.9475 469345.065, 193602.9475 469344.739, 193602.0222507725 469343.9301164729)), POLYGON ((193601.865 469345.52375, 193601.865 469346.1338755144, 193602.3274661311 469345.7182269423, 193602.2585544897 469345.5401343054, 193602.2037556305 469345.52375, 193601.865 469345.52375)), POLYGON ((193601.5616666667 469345.18625, 193601.5616666667 469345.52375, 193601.865 469345.52375, 193601.865 469344.9666851849, 193601.8569454336 469344.9208636514, 193601.5616666667 469345.18625)), POLYGON ((193601.5161595486 469342.0043333333, 193602.0222507725 469343.9301164729, 193602.9475 469344.739, 193603.2325 469344.739, 193603.2325 469342.0043333333, 193601.5161595486 469342.0043333333)), POLYGON ((193598.2316666667 469345.18625, 193598.2316666667 469348.6016666667, 193599.3943641253 469348.6016666667, 193600.955 469345.7963755144, 193600.955 469345.18625, 193598.2316666667 469345.18625)), POLYGON ((193603.2325 469345.065, 193603.2325 469345.391, 193605.9466666667 469347.7638144172, 193605.9466666667 469345.065, 193603.2325 469345.065)), POLYGON ((193603.2325 469344.739, 193603.2325 469345.065, 193605.9466666667 469345.065, 193605.9466666667 469344.739, 193603.2325 469344.739)), POLYGON ((193603.2325 469342.0043333333, 193603.2325 469344.739, 193605.9466666667 469344.739, 193605.9466666667 469342.0043333333, 193603.2325 469342.0043333333)), POLYGON ((193602.9475 469345.065, 193602.9475 469345.391, 193603.2325 469345.391, 193603.2325 469345.065, 193602.9475 469345.065)), POLYGON ((193602.9475 469344.739, 193602.9475 469345.065, 193603.2325 469345.065, 193603.2325 469344.739, 193602.9475 469344.739)), POLYGON ((193601.5616666667 469345.52375, 193601.5616666667 469346.6791265432, 193601.865 469346.1338755144, 193601.865 469345.52375, 193601.5616666667 469345.52375)), POLYGON ((193601.2583333333 469345.18625, 193601.2583333333 469345.52375, 193601.5616666667 469345.52375, 193601.5616666667 469345.18625, 193601.2583333333 469345.18625)), POLYGON ((193600.955 469345.18625, 193600.955 469345.7963755144, 193601.2583333333 469345.52375, 193601.2583333333 469345.18625, 193600.955 469345.18625)), POLYGON ((193600.955 469342.0043333333, 193600.955 469345.18625, 193601.2583333333 469345.18625, 193601.2583333333 469342.0043333333, 193600.955 469342.0043333333)), POLYGON ((193598.2316666667 469342.0043333333, 193598.2316666667 469345.18625, 193600.955 469345.18625, 193600.955 469342.0043333333, 193598.2316666667 469342.0043333333)), POLYGON ((193601.865 469344.9666851849, 193601.865 469345.52375, 193602.2037556305 469345.52375, 193601.865 469344.9666851849)))";
 
     runVoronoi(wkt, expected, 0);
+    runVoronoi(wkt, expected, 0, true);
+}
+
+// Cells in input site order, one per distinct site
+template<>
+template<>
+void object::test<11>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    auto sites = readTextOrHex("MULTIPOINT ((150 200), (180 270), (150 200), (275 163), (180 270), (30 40), (100 100))");
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(*sites);
+    builder.setOrdered(true);
+    auto cells = builder.getDiagram(geomFact);
+
+    const std::size_t firstOccurrence[] = { 0, 1, 3, 5, 6 };
+    ensure_equals(cells->getNumGeometries(), 5u);
+    for(std::size_t i = 0; i < cells->getNumGeometries(); i++) {
+        std::unique_ptr<Point> site(geomFact.createPoint(*sites->getGeometryN(firstOccurrence[i])->getCoordinate()));
+        ensure(cells->getGeometryN(i)->contains(site.get()));
+    }
+
+    // same cells as the unordered diagram, whose cells refer to their site
+    VoronoiDiagramBuilder unorderedBuilder;
+    unorderedBuilder.setSites(*sites);
+    auto expected = unorderedBuilder.getDiagram(geomFact);
+    for(std::size_t i = 0; i < expected->getNumGeometries(); i++) {
+        const Geometry* cell = expected->getGeometryN(i);
+        const Coordinate* site = static_cast<const Coordinate*>(cell->getUserData());
+        std::unique_ptr<Point> pt(geomFact.createPoint(*site));
+        ensure(cell->contains(pt.get()));
+    }
+    cells->normalize();
+    expected->normalize();
+    ensure(cells->equalsExact(expected.get(), 1e-7));
+}
+
+// Ordered cells of random sites cover the diagram envelope
+template<>
+template<>
+void object::test<12>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    std::default_random_engine e(12);
+    std::uniform_real_distribution<> dis(0, 100);
+    std::vector<Coordinate> coords(2000);
+    for(Coordinate& c : coords) {
+        c = Coordinate(dis(e), dis(e));
+    }
+    CoordinateArraySequence seq(std::move(coords));
+
+    Envelope clipEnv(-50, 200, -50, 150);
+    VoronoiDiagramBuilder builder;
+    builder.setSites(seq);
+    builder.setClipEnvelope(&clipEnv);
+    builder.setOrdered(true);
+    auto cells = builder.getDiagram(geomFact);
+
+    ensure_equals(cells->getNumGeometries(), seq.size());
+    double area = 0;
+    for(std::size_t i = 0; i < cells->getNumGeometries(); i++) {
+        const Geometry* cell = cells->getGeometryN(i);
+        ensure(cell->isValid());
+        std::unique_ptr<Point> site(geomFact.createPoint(seq.getAt(i)));
+        ensure(cell->covers(site.get()));
+        area += cell->getArea();
+    }
+    ensure_distance(area, cells->getEnvelopeInternal()->getArea(), 1e-6);
+
+    VoronoiDiagramBuilder unorderedBuilder;
+    unorderedBuilder.setSites(seq);
+    unorderedBuilder.setClipEnvelope(&clipEnv);
+    auto expected = unorderedBuilder.getDiagram(geomFact);
+    cells->normalize();
+    expected->normalize();
+    ensure(cells->equalsExact(expected.get(), 1e-7));
+}
+
+// Ordered cells of a single site and of collinear sites
+template<>
+template<>
+void object::test<13>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    VoronoiDiagramBuilder builder;
+    auto site = readTextOrHex("POINT (10 10)");
+    Envelope clipEnv(0, 20, 0, 20);
+    builder.setSites(*site);
+    builder.setClipEnvelope(&clipEnv);
+    builder.setOrdered(true);
+    auto cells = builder.getDiagram(geomFact);
+    ensure_equals(cells->getNumGeometries(), 1u);
+    ensure_equals(cells->getGeometryN(0)->getArea(), 400.0);
+
+    auto sites = readTextOrHex("MULTIPOINT ((20 20), (0 0), (10 10))");
+    VoronoiDiagramBuilder lineBuilder;
+    lineBuilder.setSites(*sites);
+    lineBuilder.setOrdered(true);
+    cells = lineBuilder.getDiagram(geomFact);
+    auto expected = readTextOrHex("GEOMETRYCOLLECTION (POLYGON ((-10 40, 40 40, 40 -10, -10 40)), POLYGON ((30 -20, -20 -20, -20 30, 30 -20)), POLYGON ((30 -20, -20 30, -20 40, -10 40, 40 -10, 40 -20, 30 -20)))");
+    ensure(cells->equalsExact(expected.get(), 1e-7));
+}
+
+// Ordered cells built over several threads keep the input order
+template<>
+template<>
+void object::test<14>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    std::default_random_engine e(14);
+    std::uniform_real_distribution<> dis(0, 100);
+    std::vector<Coordinate> coords(5000);
+    for(Coordinate& c : coords) {
+        c = Coordinate(dis(e), dis(e));
+    }
+    CoordinateArraySequence seq(std::move(coords));
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(seq);
+    builder.setOrdered(true);
+    auto expected = builder.getDiagram(geomFact);
+
+    VoronoiDiagramBuilder threadedBuilder;
+    threadedBuilder.setSites(seq);
+    threadedBuilder.setOrdered(true);
+    threadedBuilder.setNumThreads(4);
+    auto cells = threadedBuilder.getDiagram(geomFact);
+
+    ensure_equals(cells->getNumGeometries(), seq.size());
+    ensure(cells->equalsExact(expected.get()));
 }
 
 } // namespace tut
@@ -0,0 +1,128 @@
+//
+// Test Suite for geos::util::CancellationToken
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/CancellationToken.h>
+#include <geos/util/GEOSException.h>
+#include <geos/util/Interrupt.h>
+// std
+#include <chrono>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_cancellationtoken_data {
+    static bool
+    interruptOnThirdCall(void* userData)
+    {
+        int* calls = static_cast<int*>(userData);
+        return ++(*calls) == 3;
+    }
+
+    static bool
+    interrupted()
+    {
+        try {
+            GEOS_CHECK_FOR_INTERRUPTS();
+        }
+        catch(const geos::util::GEOSException&) {
+            return true;
+        }
+        return false;
+    }
+};
+
+typedef test_group<test_cancellationtoken_data> group;
+typedef group::object object;
+
+group test_cancellationtoken_group("geos::util::CancellationToken");
+
+//
+// Test Cases
+//
+
+// Requests only interrupt while the token is current
+template<>
+template<>
+void object::test<1>
+()
+{
+    geos::util::CancellationToken token;
+    token.request();
+    ensure(token.isRequested());
+    ensure_not(interrupted());
+
+    {
+        geos::util::CancellationScope scope(&token);
+        ensure(geos::util::CancellationScope::current() == &token);
+        ensure(interrupted());
+        // request is cleared once processed
+        ensure_not(token.isRequested());
+        ensure_not(interrupted());
+    }
+
+    ensure(geos::util::CancellationScope::current() == nullptr);
+}
+
+// Scopes nest
+template<>
+template<>
+void object::test<2>
+()
+{
+    geos::util::CancellationToken outer;
+    geos::util::CancellationToken inner;
+
+    geos::util::CancellationScope outerScope(&outer);
+    {
+        geos::util::CancellationScope innerScope(&inner);
+        outer.request();
+        ensure_not(interrupted());
+    }
+    ensure(interrupted());
+}
+
+// Deadlines
+template<>
+template<>
+void object::test<3>
+()
+{
+    geos::util::CancellationToken token;
+    geos::util::CancellationScope scope(&token);
+
+    token.setTimeout(std::chrono::hours(1));
+    ensure(token.hasDeadline());
+    ensure_not(interrupted());
+
+    token.setDeadline(geos::util::CancellationToken::Clock::now() - std::chrono::seconds(1));
+    ensure(interrupted());
+    // deadline stays in effect
+    ensure(interrupted());
+
+    token.clearDeadline();
+    ensure_not(interrupted());
+}
+
+// Callbacks
+template<>
+template<>
+void object::test<4>
+()
+{
+    int calls = 0;
+    geos::util::CancellationToken token;
+    token.setCallback(interruptOnThirdCall, &calls);
+
+    geos::util::CancellationScope scope(&token);
+    ensure_not(interrupted());
+    ensure_not(interrupted());
+    ensure(interrupted());
+    ensure_equals(calls, 3);
+}
+
+} // namespace tut
@@ -0,0 +1,138 @@
+//
+// Test Suite for geos::util::OperationStats
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/OperationStats.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+// std
+#include <memory>
+
+using geos::util::OperationStats;
+using geos::util::OperationStatsScope;
+using geos::operation::overlayng::OverlayNG;
+using geos::operation::overlayng::OverlayNGRobust;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_operationstats_data {
+    geos::io::WKTReader reader;
+
+    std::unique_ptr<geos::geom::Geometry>
+    read(const char* wkt)
+    {
+        return std::unique_ptr<geos::geom::Geometry>(reader.read(wkt));
+    }
+};
+
+typedef test_group<test_operationstats_data> group;
+typedef group::object object;
+
+group test_operationstats_group("geos::util::OperationStats");
+
+//
+// Test Cases
+//
+
+// Nothing is recorded without a current collector
+template<>
+template<>
+void object::test<1>
+()
+{
+    OperationStats stats;
+    ensure(stats.isEmpty());
+    ensure(OperationStats::current() == nullptr);
+
+    OperationStats::count(OperationStats::SEGMENTS_NODED, 5);
+    ensure(stats.isEmpty());
+
+    {
+        OperationStatsScope scope(&stats);
+        ensure(OperationStats::current() == &stats);
+        OperationStats::count(OperationStats::SEGMENTS_NODED, 5);
+    }
+    ensure(OperationStats::current() == nullptr);
+    ensure_equals(stats.getCount(OperationStats::SEGMENTS_NODED), 5u);
+    ensure_not(stats.isEmpty());
+}
+
+// Nested scopes restore the previous collector, merge and reset
+template<>
+template<>
+void object::test<2>
+()
+{
+    OperationStats outer;
+    OperationStats inner;
+    {
+        OperationStatsScope scope1(&outer);
+        {
+            OperationStatsScope scope2(&inner);
+            OperationStats::count(OperationStats::NODED_EDGES, 2);
+        }
+        OperationStats::count(OperationStats::NODED_EDGES);
+    }
+    ensure_equals(inner.getCount(OperationStats::NODED_EDGES), 2u);
+    ensure_equals(outer.getCount(OperationStats::NODED_EDGES), 1u);
+
+    outer.merge(inner);
+    ensure_equals(outer.getCount(OperationStats::NODED_EDGES), 3u);
+
+    outer.reset();
+    ensure(outer.isEmpty());
+}
+
+// An overlay records its phases and noding counters
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto a = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+
+    OperationStats stats;
+    {
+        OperationStatsScope scope(&stats);
+        auto result = OverlayNGRobust::Overlay(a.get(), b.get(), OverlayNG::INTERSECTION);
+        ensure_equals(result->getArea(), 25.0);
+    }
+
+    ensure_equals(stats.getCount(OperationStats::SEGMENTS_NODED), 8u);
+    ensure(stats.getCount(OperationStats::NODED_EDGES) > 0);
+    ensure_equals(stats.getCount(OperationStats::INTERSECTIONS_FOUND), 2u);
+    ensure_equals(stats.getCount(OperationStats::OVERLAY_SNAPPING_TRIES), 0u);
+    ensure(stats.getTime(OperationStats::NODING) > 0);
+    ensure(stats.getTime(OperationStats::LABELLING) > 0);
+    ensure(stats.getTime(OperationStats::RESULT_BUILD) > 0);
+}
+
+// A buffer records its offset curve generation
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto a = read("LINESTRING (0 0, 10 0, 10 10)");
+
+    OperationStats stats;
+    {
+        OperationStatsScope scope(&stats);
+        auto result = a->buffer(1.0);
+        ensure(!result->isEmpty());
+    }
+
+    ensure(stats.getCount(OperationStats::SEGMENTS_NODED) > 0);
+    ensure(stats.getTime(OperationStats::BUFFER_CURVES) > 0);
+    ensure(stats.getTime(OperationStats::NODING) > 0);
+}
+
+} // namespace tut